@@ -301,13 +301,21 @@ namespace WarzoneCard {
 
     }
 
-    Hand::Hand(const Hand& other) { this->handCards = other.handCards; }
+    Hand::Hand(const Hand& other) {
+
+        //Hands own their cards (see ~Hand), so copies get their own
+        for(Card* c : other.handCards) { handCards.push_back(new Card(*c)); }
+
+    }
 
     Hand& Hand::operator=(const Hand& other) {
 
         if (this != &other) {
 
-            this->handCards = other.handCards;
+            for(Card* c : handCards) { delete c; }
+            handCards.clear();
+
+            for(Card* c : other.handCards) { handCards.push_back(new Card(*c)); }
 
         }
 
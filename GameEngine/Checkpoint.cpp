@@ -0,0 +1,227 @@
+#include "Checkpoint.h"
+
+#include <cstring>
+#include <fstream>
+
+#include "../Card/Card.h"
+#include "../Order/Order.h"
+
+namespace WarzoneEngine {
+
+    namespace {
+
+        //File offset of every section, derived from the header counts
+        struct CheckpointLayout {
+
+            uint64_t owners, armies, players, queue, orders, truces, cards, strings, end;
+
+        };
+
+        uint64_t align8(uint64_t offset) { return (offset + 7) & ~static_cast<uint64_t>(7); }
+
+        CheckpointLayout layoutOf(const CheckpointHeader& h) {
+
+            CheckpointLayout layout;
+            layout.owners = align8(sizeof(CheckpointHeader));
+            layout.armies = align8(layout.owners + static_cast<uint64_t>(h.numTerritories) * sizeof(uint16_t));
+            layout.players = align8(layout.armies + static_cast<uint64_t>(h.numTerritories) * sizeof(int32_t));
+            layout.queue = align8(layout.players + static_cast<uint64_t>(h.numPlayers) * sizeof(CheckpointPlayer));
+            layout.orders = align8(layout.queue + static_cast<uint64_t>(h.numQueued) * sizeof(uint16_t));
+            layout.truces = align8(layout.orders + static_cast<uint64_t>(h.numOrders) * sizeof(CheckpointOrder));
+            layout.cards = align8(layout.truces + static_cast<uint64_t>(h.numTruces) * sizeof(uint16_t));
+            layout.strings = align8(layout.cards + h.numCards);
+            layout.end = layout.strings + h.stringBytes;
+
+            return layout;
+
+        }
+
+        //Whether [first, first + count) lies inside a section of size total
+        bool inRange(uint32_t first, uint32_t count, uint64_t total) {
+
+            return static_cast<uint64_t>(first) + count <= total;
+
+        }
+
+    }
+
+    bool writeCheckpoint(const string& path, CheckpointData& data) {
+
+        CheckpointHeader& h = data.header;
+        h.magic = CHECKPOINT_MAGIC;
+        h.version = CHECKPOINT_VERSION;
+        h.numTerritories = static_cast<uint32_t>(data.owners.size());
+        h.numPlayers = static_cast<uint16_t>(data.players.size());
+        h.numQueued = static_cast<uint32_t>(data.queue.size());
+        h.numOrders = static_cast<uint32_t>(data.orders.size());
+        h.numTruces = static_cast<uint32_t>(data.truces.size());
+        h.numCards = static_cast<uint32_t>(data.cards.size());
+        h.stringBytes = static_cast<uint32_t>(data.strings.size());
+
+        CheckpointLayout layout = layoutOf(h);
+        h.fileSize = layout.end;
+
+        //Assembled in memory and written once, padding bytes stay zero
+        vector<uint8_t> image(layout.end, 0);
+
+        auto put = [&image](uint64_t offset, const void* bytes, size_t size) {
+
+            if(size > 0) { memcpy(image.data() + offset, bytes, size); }
+
+        };
+
+        put(0, &h, sizeof(h));
+        put(layout.owners, data.owners.data(), data.owners.size() * sizeof(uint16_t));
+        put(layout.armies, data.armies.data(), data.armies.size() * sizeof(int32_t));
+        put(layout.players, data.players.data(), data.players.size() * sizeof(CheckpointPlayer));
+        put(layout.queue, data.queue.data(), data.queue.size() * sizeof(uint16_t));
+        put(layout.orders, data.orders.data(), data.orders.size() * sizeof(CheckpointOrder));
+        put(layout.truces, data.truces.data(), data.truces.size() * sizeof(uint16_t));
+        put(layout.cards, data.cards.data(), data.cards.size());
+        put(layout.strings, data.strings.data(), data.strings.size());
+
+        ofstream out(path, ios::binary | ios::trunc);
+        if(!out.is_open()) { return false; }
+
+        out.write(reinterpret_cast<const char*>(image.data()), static_cast<streamsize>(image.size()));
+        out.flush();
+
+        return out.good();
+
+    }
+
+    // ================= CheckpointReader ================= //
+
+    CheckpointReader::CheckpointReader()
+        : header(nullptr), owners(nullptr), armies(nullptr), players(nullptr), queue(nullptr),
+          orders(nullptr), truces(nullptr), cards(nullptr), strings(nullptr) {}
+
+    bool CheckpointReader::open(const string& path) {
+
+        close();
+
+        if(!file.open(path) || file.size() < sizeof(CheckpointHeader)) {
+
+            close();
+            return false;
+
+        }
+
+        const uint8_t* base = file.data();
+        header = reinterpret_cast<const CheckpointHeader*>(base);
+
+        if(header -> magic != CHECKPOINT_MAGIC || header -> version != CHECKPOINT_VERSION ||
+           header -> fileSize != file.size() || layoutOf(*header).end != file.size()) {
+
+            close();
+            return false;
+
+        }
+
+        //The mapping is page aligned and every section starts on 8 bytes, so the typed views are aligned
+        CheckpointLayout layout = layoutOf(*header);
+        owners = reinterpret_cast<const uint16_t*>(base + layout.owners);
+        armies = reinterpret_cast<const int32_t*>(base + layout.armies);
+        players = reinterpret_cast<const CheckpointPlayer*>(base + layout.players);
+        queue = reinterpret_cast<const uint16_t*>(base + layout.queue);
+        orders = reinterpret_cast<const CheckpointOrder*>(base + layout.orders);
+        truces = reinterpret_cast<const uint16_t*>(base + layout.truces);
+        cards = base + layout.cards;
+        strings = reinterpret_cast<const char*>(base + layout.strings);
+
+        if(!validate()) {
+
+            close();
+            return false;
+
+        }
+
+        return true;
+
+    }
+
+    void CheckpointReader::close() {
+
+        file.close();
+        header = nullptr;
+        owners = nullptr;
+        armies = nullptr;
+        players = nullptr;
+        queue = nullptr;
+        orders = nullptr;
+        truces = nullptr;
+        cards = nullptr;
+        strings = nullptr;
+
+    }
+
+    bool CheckpointReader::validate() const {
+
+        const CheckpointHeader& h = *header;
+
+        auto isLivePlayer = [this, &h](uint16_t id) { return id < h.numPlayers && players[id].present != 0; };
+        auto isTerritory = [&h](int32_t index) { return index >= -1 && index < static_cast<int64_t>(h.numTerritories); };
+
+        if(!inRange(h.mapPathLength, h.mapNameLength, h.stringBytes)) { return false; }
+        if(h.numDeckCards > h.numCards) { return false; }
+        if(h.currentPlayer != CHECKPOINT_NO_PLAYER && !isLivePlayer(h.currentPlayer)) { return false; }
+
+        for(uint32_t i = 0; i < h.numTerritories; i++) {
+
+            if(owners[i] != CHECKPOINT_NO_PLAYER && !isLivePlayer(owners[i])) { return false; }
+
+        }
+
+        for(uint16_t id = 0; id < h.numPlayers; id++) {
+
+            const CheckpointPlayer& p = players[id];
+            if(p.present == 0) { continue; }
+
+            bool ok = p.role <= 1 &&
+                      inRange(p.nameOffset, p.nameLength, h.stringBytes) &&
+                      inRange(p.strategyOffset, p.strategyLength, h.stringBytes) &&
+                      inRange(p.firstOrder, p.numOrders, h.numOrders) &&
+                      inRange(p.firstTruce, p.numTruces, h.numTruces) &&
+                      inRange(p.firstCard, p.numCards, h.numCards - h.numDeckCards);
+
+            if(!ok) { return false; }
+
+        }
+
+        for(uint32_t i = 0; i < h.numQueued; i++) {
+
+            if(!isLivePlayer(queue[i])) { return false; }
+
+        }
+
+        for(uint32_t i = 0; i < h.numOrders; i++) {
+
+            const CheckpointOrder& o = orders[i];
+
+            bool ok = o.type < WarzoneOrder::ORDER_TYPE_COUNT &&
+                      isLivePlayer(o.issuer) &&
+                      (o.targetPlayer == CHECKPOINT_NO_PLAYER || isLivePlayer(o.targetPlayer)) &&
+                      isTerritory(o.source) && isTerritory(o.target);
+
+            if(!ok) { return false; }
+
+        }
+
+        for(uint32_t i = 0; i < h.numTruces; i++) {
+
+            if(!isLivePlayer(truces[i])) { return false; }
+
+        }
+
+        for(uint32_t i = 0; i < h.numCards; i++) {
+
+            if(cards[i] < static_cast<uint8_t>(WarzoneCard::CardType::Bomb) ||
+               cards[i] > static_cast<uint8_t>(WarzoneCard::CardType::Diplomacy)) { return false; }
+
+        }
+
+        return true;
+
+    }
+
+}
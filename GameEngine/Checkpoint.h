@@ -0,0 +1,204 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "Map/MappedFile.h"
+
+using namespace std;
+
+namespace WarzoneEngine {
+
+    //File identification, "WZCP" read as a little-endian integer
+    const uint32_t CHECKPOINT_MAGIC = 0x50435A57;
+    const uint16_t CHECKPOINT_VERSION = 1;
+
+    //Player index standing for "no player" (unowned territory, order without target player, no current player)
+    const uint16_t CHECKPOINT_NO_PLAYER = UINT16_MAX;
+
+    //CheckpointHeader::flags bits
+    const uint32_t CHECKPOINT_PARALLEL_ISSUE = 1u << 0;
+    const uint32_t CHECKPOINT_COMPACT_ORDERS = 1u << 1;
+    const uint32_t CHECKPOINT_PARALLEL_EXECUTE = 1u << 2;
+    const uint32_t CHECKPOINT_BALANCED_ASSIGNMENT = 1u << 3;
+    const uint32_t CHECKPOINT_HAS_DECK = 1u << 4;
+
+    /**
+     * @struct CheckpointHeader
+     * @brief First bytes of a checkpoint file: engine scalars and the size of every section that follows.
+     *
+     * Sections follow in this order, each starting on an 8-byte boundary: territory owners (uint16_t),
+     * territory armies (int32_t), players (CheckpointPlayer, by player index), turn queue (uint16_t),
+     * pending orders (CheckpointOrder), truces (uint16_t), cards (uint8_t CardType, hands first, then the deck)
+     * and strings (map path, map name, then player names and strategy names).
+     */
+    struct CheckpointHeader {
+
+        uint32_t magic;
+        uint16_t version;
+        uint8_t state;                    //EngineState value
+        uint8_t step;                     //TurnStep value, the phase stepping resumes at
+        uint64_t fileSize;                //Whole file, checked against the mapping before anything else is read
+        uint64_t mapHash;                 //MappedFile::hashBytes() of the map file contents
+        uint32_t rngSeed;
+        int32_t turn;
+        int32_t maxTurns;
+        int32_t ordersEliminatedLastTurn;
+        uint32_t flags;                   //CHECKPOINT_* bits
+        uint32_t numTerritories;
+        uint16_t numPlayers;              //Player index count, eliminated players leave an empty slot
+        uint16_t currentPlayer;
+        uint32_t numQueued;
+        uint32_t numOrders;
+        uint32_t numTruces;
+        uint32_t numCards;
+        uint32_t numDeckCards;            //Last numDeckCards entries of the card section
+        uint32_t mapPathLength;
+        uint32_t mapNameLength;
+        uint32_t stringBytes;
+        uint32_t reservedTail;            //Zero, keeps the header a multiple of 8 bytes
+
+    };
+
+    static_assert(sizeof(CheckpointHeader) == 88, "CheckpointHeader is part of the file format");
+
+    /**
+     * @struct CheckpointPlayer
+     * @brief One player slot, with ranges into the order, truce, card and string sections
+     */
+    struct CheckpointPlayer {
+
+        uint32_t nameOffset;
+        uint32_t nameLength;
+        uint32_t strategyOffset;
+        uint32_t strategyLength;          //0 for the built-in default behaviour
+        int32_t reinforcementPool;
+        uint32_t firstOrder;
+        uint32_t numOrders;
+        uint32_t firstTruce;
+        uint32_t numTruces;
+        uint32_t firstCard;
+        uint32_t numCards;
+        uint8_t present;                  //0 if the player was eliminated
+        uint8_t role;                     //PlayerRole value
+        uint8_t generateCard;
+        uint8_t reserved;
+
+    };
+
+    static_assert(sizeof(CheckpointPlayer) == 48, "CheckpointPlayer is part of the file format");
+
+    /**
+     * @struct CheckpointOrder
+     * @brief One pending order, territories by dense index and players by player index
+     */
+    struct CheckpointOrder {
+
+        int32_t source;
+        int32_t target;
+        int32_t numArmies;
+        uint16_t issuer;
+        uint16_t targetPlayer;            //CHECKPOINT_NO_PLAYER if the order has none
+        uint8_t type;                     //WarzoneOrder::OrderType value
+        uint8_t reserved[3];
+
+    };
+
+    static_assert(sizeof(CheckpointOrder) == 20, "CheckpointOrder is part of the file format");
+
+    /**
+     * @struct CheckpointData
+     * @brief A checkpoint being written: the header and every section. Counts and sizes are filled by writeCheckpoint().
+     */
+    struct CheckpointData {
+
+        CheckpointHeader header;
+        vector<uint16_t> owners;
+        vector<int32_t> armies;
+        vector<CheckpointPlayer> players;
+        vector<uint16_t> queue;
+        vector<CheckpointOrder> orders;
+        vector<uint16_t> truces;
+        vector<uint8_t> cards;
+        string strings;
+
+    };
+
+    /**
+     * @brief Writes a checkpoint file in one go.
+     *
+     * Values are written in host byte order; checkpoints are meant to be read back on the same kind of machine.
+     * @param path File path, created or truncated
+     * @param data Checkpoint to write, its header counts are set from the sections
+     * @return false if the file could not be written
+     */
+    bool writeCheckpoint(const string& path, CheckpointData& data);
+
+    // ================= CheckpointReader ================= //
+    /**
+     * @class CheckpointReader
+     * @brief Maps a checkpoint file and validates it in place, then hands out typed views of its sections.
+     *
+     * Nothing is copied or parsed: open() checks the header, the section sizes and every index and range
+     * inside the sections, so the engine can rebuild the game without further bounds checks.
+     * Views stay valid until the reader is closed or destroyed.
+     */
+    class CheckpointReader {
+
+        private:
+
+            WarzoneMap::MappedFile file;
+            const CheckpointHeader* header;
+            const uint16_t* owners;
+            const int32_t* armies;
+            const CheckpointPlayer* players;
+            const uint16_t* queue;
+            const CheckpointOrder* orders;
+            const uint16_t* truces;
+            const uint8_t* cards;
+            const char* strings;
+
+            bool validate() const;
+
+        public:
+
+            /**
+             * @brief Default constructor, nothing is open
+             */
+            CheckpointReader();
+
+            /**
+             * @brief Maps and validates a checkpoint file
+             * @param path File path
+             * @return false if the file cannot be read, is not a checkpoint, has an unsupported version or is inconsistent
+             */
+            bool open(const string& path);
+
+            /**
+             * @brief Unmaps the file
+             */
+            void close();
+
+            //-- Section views, valid after a successful open() --//
+
+            const CheckpointHeader& getHeader() const { return *header; }
+            const uint16_t* getOwners() const { return owners; }
+            const int32_t* getArmies() const { return armies; }
+            const CheckpointPlayer* getPlayers() const { return players; }
+            const uint16_t* getQueue() const { return queue; }
+            const CheckpointOrder* getOrders() const { return orders; }
+            const uint16_t* getTruces() const { return truces; }
+            const uint8_t* getCards() const { return cards; }
+
+            /**
+             * @brief A string of the string section
+             * @param offset Offset in the section
+             * @param length Length in bytes
+             * @return Copy of the string
+             */
+            string getString(uint32_t offset, uint32_t length) const { return string(strings + offset, length); }
+
+    };
+
+}
@@ -1,6 +1,10 @@
 #include "GameEngine.h"
 #include <sstream>
 #include <algorithm>
+#include <atomic>
+#include <map>
+#include <random>
+#include <thread>
 
 namespace WarzoneEngine {
 
@@ -28,6 +32,24 @@ namespace WarzoneEngine {
     
     }
 
+    std::ostream& operator<<(std::ostream& os, const StalemateStats& stats) {
+
+        os << "[Stalemate] Turns tracked: " << stats.turnsTracked
+           << ", territory changes: " << stats.ownershipChanges << " (last turn: " << stats.ownershipChangesLastTurn << ")\n";
+        os << "[Stalemate] Turns without progress: " << stats.turnsWithoutProgress
+           << " (longest streak: " << stats.longestNoProgressStreak << "), repeated boards: " << stats.repeatedBoards << "\n";
+        os << "[Stalemate] Board fingerprint: " << hex << stats.fingerprint << dec << "\n";
+
+        if(stats.declared){
+            os << (stats.adjudicatedWinner.empty()
+                ? string("[Stalemate] Game declared a draw.\n")
+                : "[Stalemate] Game adjudicated to " + stats.adjudicatedWinner + ".\n");
+        }
+
+        return os;
+
+    }
+
     /*------------------------------------------GAME ENGINE--------------------------------------------*/
 
     //-- Constructors, Destructor, Copy Constructor, Assignment Operator, Stream Insertion Operator --//
@@ -38,8 +60,23 @@ namespace WarzoneEngine {
         gameMap = nullptr;
         deck = nullptr;
         players = {};
+        neutral = nullptr;
+        playerIndexCount = 0;
         turn = 1;
         maxTurns = INT_MAX;
+        nextStep = TurnStep::Reinforcement;
+        rngSeed = static_cast<unsigned int>(TimeUtil::getSystemTimeNano());
+        parallelIssueOrders = false;
+        compactOrdersEnabled = true;
+        parallelExecuteOrders = false;
+        parallelExecuteMinBatch = PARALLEL_EXECUTE_MIN_BATCH;
+        parallelBatchesLastTurn = 0;
+        balancedAssignment = false;
+        ordersEliminatedLastTurn = 0;
+        mapHash = 0;
+        recordHeaderWritten = false;
+        recordedBoardHash = 0;
+        replayBattleSeed = 0;
         playerQueue = {};
         currentPlayer = nullptr;
 
@@ -51,37 +88,37 @@ namespace WarzoneEngine {
 
     GameEngine::GameEngine(const GameEngine& other) {
 
+        StateJournal::Scope recording(nullptr); //Claiming the copied territories must not land in other's journal
+
         //Copy all attributes
         state = other.state;
         gameMap = other.gameMap ? new Map(*other.gameMap) : nullptr;
         deck = other.deck ? new Deck(*other.deck) : nullptr;
         turn = other.turn;
         maxTurns = other.maxTurns;
-
-        for(Player* p : other.players){ 
-            
-            if(p != nullptr){ players.push_back(new Player(*p)); }
-
-        }
-
-        queue<Player*> tempQueue = other.playerQueue; //Set up temp queue to copy from
-        while (!tempQueue.empty()) {
-            
-            string name = tempQueue.front() -> getPlayerName(); //Peek at front of queue
-            Player* found = findPlayerByName(name); //See if player exists in copied list
-            
-            if(found){ playerQueue.push(found); }
-            
-            tempQueue.pop(); //Remove from temp queue
-
-        }
-
-        currentPlayer = nullptr;
-        if (other.currentPlayer){
-         
-            currentPlayer = findPlayerByName(other.currentPlayer -> getPlayerName());
-
-        }
+        nextStep = other.nextStep;
+        rngSeed = other.rngSeed;
+        parallelIssueOrders = other.parallelIssueOrders;
+        compactOrdersEnabled = other.compactOrdersEnabled;
+        parallelExecuteOrders = other.parallelExecuteOrders;
+        parallelExecuteMinBatch = other.parallelExecuteMinBatch;
+        parallelBatchesLastTurn = other.parallelBatchesLastTurn;
+        balancedAssignment = other.balancedAssignment;
+        orderStats.setEnabled(other.orderStats.isEnabled());
+        ordersEliminatedLastTurn = other.ordersEliminatedLastTurn;
+        stalemateRules = other.stalemateRules;
+        stalemateStats = other.stalemateStats;
+        zobristOwnerKeys = other.zobristOwnerKeys;
+        zobristArmyKeys = other.zobristArmyKeys;
+        lastOwners = other.lastOwners;
+        recentFingerprints = other.recentFingerprints;
+        mapPath = other.mapPath;
+        mapHash = other.mapHash;
+        recordHeaderWritten = false; //Recording stays with the original engine
+        recordedBoardHash = 0;
+        replayBattleSeed = 0;
+
+        copyPlayersFrom(other);
 
     }
 
@@ -89,6 +126,7 @@ namespace WarzoneEngine {
         
         if (this != &other) {
 
+            StateJournal::Scope recording(nullptr);
             clearGame();
             state = other.state;
 
@@ -97,31 +135,95 @@ namespace WarzoneEngine {
             deck = other.deck ? new Deck(*other.deck) : nullptr;
             turn = other.turn;
             maxTurns = other.maxTurns;
+            nextStep = other.nextStep;
+            rngSeed = other.rngSeed;
+            parallelIssueOrders = other.parallelIssueOrders;
+            compactOrdersEnabled = other.compactOrdersEnabled;
+            parallelExecuteOrders = other.parallelExecuteOrders;
+            parallelExecuteMinBatch = other.parallelExecuteMinBatch;
+            parallelBatchesLastTurn = other.parallelBatchesLastTurn;
+            balancedAssignment = other.balancedAssignment;
+            orderStats.setEnabled(other.orderStats.isEnabled());
+            ordersEliminatedLastTurn = other.ordersEliminatedLastTurn;
+            stalemateRules = other.stalemateRules;
+            stalemateStats = other.stalemateStats;
+            zobristOwnerKeys = other.zobristOwnerKeys;
+            zobristArmyKeys = other.zobristArmyKeys;
+            lastOwners = other.lastOwners;
+            recentFingerprints = other.recentFingerprints;
+            mapPath = other.mapPath;
+            mapHash = other.mapHash;
+
+            //Clone Players, queue and current player
+            copyPlayersFrom(other);
 
-            //Clone Players
-            for(Player* p : other.players){
-                
-                players.push_back(new Player(*p));
+        }
 
-            }
+        return *this;
 
-            //Clone Player Queue
-            queue<Player*> tempQueue = other.playerQueue;
-            while (!tempQueue.empty()) {
-                
-                string name = tempQueue.front() -> getPlayerName();
-                Player* found = findPlayerByName(name);
-                if(found){ playerQueue.push(found); }
-                tempQueue.pop();
+    }
+
+    void GameEngine::copyPlayersFrom(const GameEngine& other) {
+
+        playerIndexCount = other.playerIndexCount;
+        neutral = nullptr;
+
+        //Copied territories still name other's players as owners, the copied players claim them back below
+        if(gameMap != nullptr){ for(Territory* t : gameMap -> getTerritories()){ t -> setOwner(nullptr); } }
+
+        unordered_map<Continent*, long long> emptyHashMap;
+        if(gameMap != nullptr){ emptyHashMap = gameMap -> buildEmptyContinentHashmap(); }
+
+        vector<Player*> byIndex(playerIndexCount, nullptr);
+        for(Player* p : other.players){
+
+            if(p == nullptr){ continue; }
+
+            Player* copy = gameMap != nullptr ? new Player(*p, gameMap -> getTerritories(), emptyHashMap) : new Player(*p);
+            players.push_back(copy);
+
+            if(copy -> getPlayerIndex() < playerIndexCount){ byIndex[copy -> getPlayerIndex()] = copy; }
+            if(copy -> isNeutral()){ neutral = copy; }
+
+        }
+
+        //Truces and pending orders need every copied player to exist first
+        if(gameMap != nullptr){
+
+            size_t k = 0;
+            for(Player* p : other.players){ if(p != nullptr){ players[k++] -> resolveReferencesFrom(*p, byIndex, gameMap -> getTerritories()); } }
+
+        }
+
+        //By index, or by position in players if the game has not numbered them yet
+        auto resolve = [&](const Player* p) -> Player* {
+
+            if(p == nullptr){ return nullptr; }
+            if(p -> getPlayerIndex() < playerIndexCount){ return byIndex[p -> getPlayerIndex()]; }
+
+            size_t k = 0;
+            for(Player* q : other.players){
+
+                if(q == nullptr){ continue; }
+                if(q == p){ return players[k]; }
+                k++;
 
             }
 
-            currentPlayer = nullptr;
-            if (other.currentPlayer){ currentPlayer = findPlayerByName(other.currentPlayer->getPlayerName()); }
+            return nullptr;
+
+        };
+
+        queue<Player*> tempQueue = other.playerQueue;
+        while(!tempQueue.empty()){
+
+            Player* found = resolve(tempQueue.front());
+            tempQueue.pop();
+            if(found){ playerQueue.push(found); }
 
         }
 
-        return *this;
+        currentPlayer = resolve(other.currentPlayer);
 
     }
 
@@ -147,7 +249,16 @@ namespace WarzoneEngine {
     void GameEngine::setDeck(Deck* d) { deck = d; }
 
     const vector<Player*>& GameEngine::getPlayers() const { return players; }
-    void GameEngine::setPlayers(const std::vector<Player*>& newPlayers) { players = newPlayers; }
+    void GameEngine::setPlayers(const std::vector<Player*>& newPlayers) {
+
+        players = newPlayers;
+        assignPlayerIndices();
+
+    }
+
+    Player* GameEngine::getNeutralPlayer() const { return neutral; }
+
+    uint16_t GameEngine::getPlayerIndexCount() const { return playerIndexCount; }
 
     int GameEngine::getTurn() const { return turn; }
     void GameEngine::setTurn(int turn){ this -> turn = turn; }
@@ -155,6 +266,95 @@ namespace WarzoneEngine {
     int GameEngine::getMaxTurns() const { return maxTurns; }
     void GameEngine::setMaxTurns(int maxTurns){ this -> maxTurns = maxTurns; }
 
+    unsigned int GameEngine::getRngSeed() const { return rngSeed; }
+    void GameEngine::setRngSeed(unsigned int seed){ this -> rngSeed = seed; }
+
+    bool GameEngine::getParallelIssueOrders() const { return parallelIssueOrders; }
+    void GameEngine::setParallelIssueOrders(bool enabled){ this -> parallelIssueOrders = enabled; }
+
+    bool GameEngine::getCompactOrders() const { return compactOrdersEnabled; }
+    void GameEngine::setCompactOrders(bool enabled){ this -> compactOrdersEnabled = enabled; }
+
+    int GameEngine::getOrdersEliminatedLastTurn() const { return ordersEliminatedLastTurn; }
+
+    bool GameEngine::getParallelExecuteOrders() const { return parallelExecuteOrders; }
+    void GameEngine::setParallelExecuteOrders(bool enabled){ this -> parallelExecuteOrders = enabled; }
+
+    size_t GameEngine::getParallelExecuteMinBatch() const { return parallelExecuteMinBatch; }
+    void GameEngine::setParallelExecuteMinBatch(size_t minBatch){ this -> parallelExecuteMinBatch = max<size_t>(minBatch, 1); }
+
+    int GameEngine::getParallelBatchesLastTurn() const { return parallelBatchesLastTurn; }
+
+    bool GameEngine::getBalancedAssignment() const { return balancedAssignment; }
+    void GameEngine::setBalancedAssignment(bool enabled){ this -> balancedAssignment = enabled; }
+
+    bool GameEngine::getCollectOrderStats() const { return orderStats.isEnabled(); }
+    void GameEngine::setCollectOrderStats(bool enabled){ orderStats.setEnabled(enabled); }
+
+    OrderStatsSnapshot GameEngine::getOrderStats() const { return orderStats.snapshot(); }
+    void GameEngine::resetOrderStats(){ orderStats.reset(); }
+
+    const StalemateRules& GameEngine::getStalemateRules() const { return stalemateRules; }
+    void GameEngine::setStalemateRules(const StalemateRules& rules){
+
+        this -> stalemateRules = rules;
+        resetStalemateTracking();
+
+    }
+
+    const StalemateStats& GameEngine::getStalemateStats() const { return stalemateStats; }
+
+    size_t GameEngine::checkpoint() {
+
+        //Tracking is rewritten wholesale every turn, so it is saved instead of journaled
+        stalemateCheckpoints.push_back(StalemateTracking{stalemateStats, lastOwners, recentFingerprints});
+        return journal.checkpoint();
+
+    }
+
+    bool GameEngine::rollback() {
+
+        bool rolledBack = journal.rollback();
+
+        if(rolledBack && !stalemateCheckpoints.empty()) {
+
+            StalemateTracking& saved = stalemateCheckpoints.back();
+            stalemateStats = saved.stats;
+            lastOwners.swap(saved.lastOwners);
+            recentFingerprints.swap(saved.recentFingerprints);
+            stalemateCheckpoints.pop_back();
+
+        }
+
+        releaseEliminatedPlayers();
+        return rolledBack;
+
+    }
+
+    bool GameEngine::commitCheckpoint() {
+
+        bool committed = journal.commit();
+        if(committed && !stalemateCheckpoints.empty()) { stalemateCheckpoints.pop_back(); }
+
+        releaseEliminatedPlayers();
+        return committed;
+
+    }
+
+    StateJournal* GameEngine::recordingJournal() { return journal.getDepth() > 0 ? &journal : nullptr; }
+
+    bool GameEngine::startRecording(const string& path) {
+
+        recordHeaderWritten = false; //Header and board are written lazily, by the first recorded turn
+        recordedBoardHash = 0;
+        return recorder.open(path);
+
+    }
+
+    void GameEngine::stopRecording() { recorder.close(); }
+
+    bool GameEngine::isRecording() const { return recorder.isOpen(); }
+
     queue<Player*> GameEngine::getPlayerQueue() const { return playerQueue; }
     void GameEngine::setPlayerQueue(const queue<Player*>& q) { playerQueue = q; }
 
@@ -201,6 +401,8 @@ namespace WarzoneEngine {
 
     void GameEngine::setState(const EngineState& gameState){ state = gameState;}
 
+    TurnStep GameEngine::getNextStep() const { return nextStep; }
+
     /*--------------------------------------Helper & Internal Methods--------------------------------------------*/
 
     bool GameEngine::isCurrentStateCorrect(EngineState expected, const string& cmd) {
@@ -225,10 +427,17 @@ namespace WarzoneEngine {
 
         for(Player* p : players){ delete p; } //All players can be deleted directly
         players.clear();
+        for(Player* p : eliminatedPlayers){ delete p; }
+        eliminatedPlayers.clear();
+        neutral = nullptr;
+        playerIndexCount = 0;
 
         delete gameMap;
         gameMap = nullptr;
 
+        journal.clear(); //Entries point into the deleted game
+        stalemateCheckpoints.clear();
+
         while(!playerQueue.empty()){ playerQueue.pop(); } //Clear the queue
         currentPlayer = nullptr; //Previously deleted in players loop
 
@@ -272,7 +481,7 @@ namespace WarzoneEngine {
             if(curr == nullptr) { continue; }
 
             //Skip the neutral player so it never enters the shuffled rotation
-            if(curr -> getPlayerName() == "Neutral") { continue; }
+            if(curr -> isNeutral()) { continue; }
 
             tempPlayers.push_back(curr);
         }
@@ -347,27 +556,84 @@ namespace WarzoneEngine {
 
     string GameEngine::assignTerritories(bool surpressOutput) {
 
+        StateJournal::Scope recording(recordingJournal());
+
         // Get all territories from the map
         vector<Territory*> terrs = gameMap -> getTerritories();
         if(terrs.empty()){ return "[Assignment] No territories available for assignment.\n"; }
 
-        if(players.empty()){ return "[Assignment] No players available for assignment.\n"; } // Avoid division by zero
-        int terrPerPlayer = static_cast<int>(terrs.size() / (players.size() - 1)); // -1 to account for neutral player
+        vector<Player*> assignees;
+        for(Player* p : players) {
+
+            if(p != nullptr && p != neutral) { assignees.push_back(p); } // Skip neutral player
+
+        }
+
+        if(assignees.empty()){ return "[Assignment] No players available for assignment.\n"; } // Avoid division by zero
+        size_t terrPerPlayer = terrs.size() / assignees.size();
+        size_t numAssigned = terrPerPlayer * assignees.size();
+
+        //Fisher-Yates shuffle on a generator seeded from the game seed, so setups are uniform and reproducible
+        unsigned long long mixed = static_cast<unsigned long long>(rngSeed) ^ 0xA0761D6478BD642Full;
+        mixed ^= mixed >> 29;
+        mt19937 rng(static_cast<unsigned int>(mixed ^ (mixed >> 32)));
+
+        for(size_t i = terrs.size() - 1; i > 0; i--) {
+
+            size_t j = static_cast<size_t>(rng() % (i + 1));
+            swap(terrs[i], terrs[j]);
+
+        }
+
+        //Balanced mode: group the assigned territories by continent (continents in random order), then deal them out
+        //round-robin, so every player starts with an even share of every continent. Leftovers stay random.
+        if(balancedAssignment) {
+
+            const vector<Continent*>& continents = gameMap -> getContinents();
+
+            vector<size_t> continentOrder(continents.size());
+            for(size_t c = 0; c < continentOrder.size(); c++) { continentOrder[c] = c; }
+            for(size_t c = continentOrder.size(); c > 1; c--) { swap(continentOrder[c - 1], continentOrder[rng() % c]); }
+
+            unordered_map<const Continent*, size_t> bucketOf;
+            bucketOf.reserve(continents.size());
+            for(size_t c = 0; c < continentOrder.size(); c++) { bucketOf[continents[continentOrder[c]]] = c; }
+
+            //Stable counting sort by bucket, territories without a known continent go last
+            vector<size_t> bucketStart(continents.size() + 2, 0);
+            vector<size_t> terrBucket(numAssigned);
+
+            for(size_t i = 0; i < numAssigned; i++) {
+
+                auto it = (terrs[i] != nullptr) ? bucketOf.find(terrs[i] -> getContinent()) : bucketOf.end();
+                terrBucket[i] = (it != bucketOf.end()) ? it -> second : continents.size();
+                bucketStart[terrBucket[i] + 1]++;
+
+            }
+
+            for(size_t b = 1; b < bucketStart.size(); b++) { bucketStart[b] += bucketStart[b - 1]; }
+
+            vector<Territory*> grouped(numAssigned);
+            for(size_t i = 0; i < numAssigned; i++) { grouped[bucketStart[terrBucket[i]]++] = terrs[i]; }
+
+            //Deal: the k-th grouped territory goes to player k % players, stored in that player's slice
+            for(size_t k = 0; k < numAssigned; k++) { terrs[(k % assignees.size()) * terrPerPlayer + k / assignees.size()] = grouped[k]; }
+
+        }
 
         ostringstream output;
         if(surpressOutput == false){ output << "\n[Assignment] === Assigning Territories to Players ===\n"; }
 
-        for(Player* p : players) {
+        //Each player takes a contiguous slice of the shuffled territories
+        for(size_t k = 0; k < assignees.size(); k++) {
 
-            if(p == nullptr || p->getPlayerName() == "Neutral") { continue; } // Skip neutral player
+            Player* p = assignees[k];
 
             if(surpressOutput == false){ output << "[Assignment] " << p -> getPlayerName() << " receives: "; }
 
-            for(int i = 0; i < terrPerPlayer && !terrs.empty(); i++) {
+            for(size_t i = 0; i < terrPerPlayer; i++) {
 
-                // Pick random available territory
-                size_t randomIndex = static_cast<size_t>(TimeUtil::getSystemTimeMillis() % terrs.size());
-                Territory* selected = terrs[randomIndex];
+                Territory* selected = terrs[k * terrPerPlayer + i];
 
                 if(selected == nullptr){ continue; } //Skip null territories
 
@@ -377,11 +643,9 @@ namespace WarzoneEngine {
                 if(surpressOutput == false){
 
                     output << selected -> getID(); //Print assigned territory
-                    if(i < terrPerPlayer - 1 && terrs.size() > 1) output << ", "; //Manage commas
+                    if(i < terrPerPlayer - 1) output << ", "; //Manage commas
 
                 }
-
-                terrs.erase(terrs.begin() + randomIndex); //Remove from available territories
             
             }
 
@@ -390,12 +654,12 @@ namespace WarzoneEngine {
         }
 
         // Assign leftover territories to the Neutral player
-        Player* neutralPlayer = findPlayerByName("Neutral");
-        if(neutralPlayer && !terrs.empty()) { //If neutral player exists and there are leftover territories
+        Player* neutralPlayer = neutral;
+        if(neutralPlayer && numAssigned < terrs.size()) { //If neutral player exists and there are leftover territories
 
             if(surpressOutput == false){ output << "[Assignment] Neutral player receives leftover territories: "; }
             
-            for(size_t i = 0; i < terrs.size(); i++) {
+            for(size_t i = numAssigned; i < terrs.size(); i++) {
                 
                 Territory* t = terrs[i];
                 if(t == nullptr){ continue; }
@@ -422,7 +686,9 @@ namespace WarzoneEngine {
     }
 
     void GameEngine::handleBombOrder(Player* p, Player* neutralPlayer, Order* issuedOrder, bool surpressOutput, ostringstream& output) {
-        
+
+        StateJournal::Scope recording(recordingJournal());
+
         //Player bombs the strongest enemy, not under truce. Avoid Neutral player if possible
         vector<Territory*> candidateTargets = p -> getBombCandidates();
 
@@ -509,6 +775,8 @@ namespace WarzoneEngine {
 
     void GameEngine::handleBlockadeOrder(Player* p, Player* neutralPlayer, Order* issuedOrder, bool surpressOutput, ostringstream& output) {
 
+        StateJournal::Scope recording(recordingJournal());
+
         //Player blockades their most outmatched owned territory
         vector<Territory*> borderTerritories = p -> getTerritoriesAdjacentToEnemy();
         
@@ -562,10 +830,24 @@ namespace WarzoneEngine {
 
     void GameEngine::handleAirliftOrder(Player* p, Player* neutralPlayer, Order* issuedOrder, bool surpressOutput, ostringstream& output) {
 
+        StateJournal::Scope recording(recordingJournal());
+
         //Player airlifts armies from the deepest region to the most threatened border territory
 
         vector<Territory*> owned = p -> getOwnedTerritories().getTerritories(); //Get Owned territories
-        vector<Territory*> borderTerritories = p -> getTerritoriesAdjacentToEnemy(); //Get border territories
+
+        //Distance of every owned territory to its nearest frontline, reused between calls on this thread
+        thread_local FrontlineField field;
+        if(gameMap != nullptr) { gameMap -> computeFrontlineField(p, field); }
+        else { field.distance.clear(); }
+
+        auto frontlineDistance = [](Territory* t) {
+            size_t index = static_cast<size_t>(t -> getIndex());
+            return index < field.distance.size() ? field.distance[index] : -1;
+        };
+
+        vector<Territory*> borderTerritories;
+        for(Territory* t : owned) { if(t != nullptr && frontlineDistance(t) == 0) { borderTerritories.push_back(t); } }
 
         if(owned.size() < 2 || borderTerritories.empty()) {  //This should not happen
             
@@ -600,15 +882,31 @@ namespace WarzoneEngine {
         }
 
         // ----------------------- Simplified Strategy ----------------------- //
-        // Source: territory with the MOST armies (regardless of border/internal)
-        // Target: MOST threatened border territory
+        // Source: interior territory with the MOST armies, the deepest one on ties (cut off from every frontline counts
+        //         as deepest); the strongest territory overall if no interior one can spare an army
+        // Target: MOST threatened frontline territory
         // Amount: Half of source armies (at least 1 moved, at least 1 left behind)
         // ------------------------------------------------------------------- //
 
-        //Sort all owned territories by army count (descending) to pick the strongest as source
-        sort(owned.begin(), owned.end(), Territory::territoryNumArmiesCompareDescend);
+        auto depthOf = [&](Territory* t) { int distance = frontlineDistance(t); return distance < 0 ? INT_MAX : distance; };
+
+        Territory* source = nullptr;
+        for(Territory* t : owned) {
+
+            if(t == nullptr || t -> getNumArmies() <= 1 || frontlineDistance(t) == 0) { continue; }
+
+            if(source == nullptr || t -> getNumArmies() > source -> getNumArmies() ||
+               (t -> getNumArmies() == source -> getNumArmies() && depthOf(t) > depthOf(source))) { source = t; }
+
+        }
+
+        if(source == nullptr) {
 
-        Territory* source = owned.front();
+            //Sort all owned territories by army count (descending) to pick the strongest as source
+            sort(owned.begin(), owned.end(), Territory::territoryNumArmiesCompareDescend);
+            source = owned.front();
+
+        }
         if(source == nullptr){ 
 
             issuedOrder -> setEffect("[IssueOrder] Player: " + p -> getPlayerName() 
@@ -693,7 +991,13 @@ namespace WarzoneEngine {
 
     void GameEngine::handleNegotiateOrder(Player* p, Player* neutralPlayer, vector<Player*> neutrals, Order* issuedOrder, bool surpressOutput, ostringstream& output) {
 
-        unordered_map<Player*, long long> enemyThreatLevel;
+        StateJournal::Scope recording(recordingJournal());
+
+        //Threat per player index, threatened marks the players that got a score at all
+        vector<long long> enemyThreatLevel(playerIndexCount, 0);
+        vector<char> threatened(playerIndexCount, 0);
+        bool anyThreat = false;
+
         vector<Territory*> borderTerrs = p -> getTerritoriesAdjacentToEnemy();
         if(borderTerrs.empty()) { return; }
 
@@ -715,10 +1019,15 @@ namespace WarzoneEngine {
                 if(enemy == nullptr || enemy == p){ continue; }
                 if(find(neutrals.begin(), neutrals.end(), enemy) != neutrals.end()){ continue; }
 
-                enemyThreatLevel[enemy] += neigh -> getNumArmies() + rankWeight;
+                uint16_t enemyIndex = enemy -> getPlayerIndex();
+                if(enemyIndex >= playerIndexCount){ continue; }
+
+                threatened[enemyIndex] = 1;
+                anyThreat = true;
+                enemyThreatLevel[enemyIndex] += neigh -> getNumArmies() + rankWeight;
                 Continent* playerCont = border -> getContinent();
                 Continent* enemyCont = neigh -> getContinent();
-                if(playerCont != nullptr && enemyCont == playerCont) { enemyThreatLevel[enemy] += 50; }
+                if(playerCont != nullptr && enemyCont == playerCont) { enemyThreatLevel[enemyIndex] += 50; }
 
             }
         }
@@ -741,7 +1050,7 @@ namespace WarzoneEngine {
 
             for(Player* enemy : players) {
 
-                if(enemy == nullptr || enemy == p){ continue; }
+                if(enemy == nullptr || enemy == p || enemy -> getPlayerIndex() >= playerIndexCount){ continue; }
                 if(find(neutrals.begin(), neutrals.end(), enemy) != neutrals.end()){ continue; }
 
                 const unordered_map<Continent*, long long>& enemyHashMap = enemy -> getContinentLookupTablePlayer();
@@ -753,18 +1062,24 @@ namespace WarzoneEngine {
 
                 double controlRatio = static_cast<double>(enemySum) / static_cast<double>(masterSum);
                 long long continentThreat = static_cast<long long>(BASE_CONTINENT_THREAT * controlRatio * static_cast<double>(bonusValue));
-                enemyThreatLevel[enemy] += continentThreat;
+                threatened[enemy -> getPlayerIndex()] = 1;
+                anyThreat = true;
+                enemyThreatLevel[enemy -> getPlayerIndex()] += continentThreat;
             }
         }
 
-        if(enemyThreatLevel.empty()){ return; }
+        if(!anyThreat){ return; }
 
+        //Walk players in game order, so threat ties resolve the same way on every run
         Player* targetPlayer = nullptr;
         long long maxThreat = -1;
-        for(pair<Player*, long long> entry : enemyThreatLevel) {
-            if(entry.second > maxThreat) { 
-                maxThreat = entry.second;
-                targetPlayer = entry.first;
+        for(Player* enemy : players) {
+            if(enemy == nullptr || enemy -> getPlayerIndex() >= playerIndexCount) { continue; }
+
+            uint16_t enemyIndex = enemy -> getPlayerIndex();
+            if(threatened[enemyIndex] && enemyThreatLevel[enemyIndex] > maxThreat) { 
+                maxThreat = enemyThreatLevel[enemyIndex];
+                targetPlayer = enemy;
             }
         }
 
@@ -786,1075 +1101,2478 @@ namespace WarzoneEngine {
         }
     }
 
-    void GameEngine::issueOrdersPhase(bool surpressOutput, ostringstream& output) {
+    unsigned int GameEngine::decisionSeedFor(size_t playerPosition) const {
 
-        Player* neutralPlayer = nullptr;
+        //Mix seed, turn and position so neighbouring turns/players get unrelated streams
+        unsigned long long mixed = static_cast<unsigned long long>(rngSeed);
+        mixed ^= static_cast<unsigned long long>(turn) * 0x9E3779B97F4A7C15ull;
+        mixed ^= static_cast<unsigned long long>(playerPosition + 1) * 0xC2B2AE3D27D4EB4Full;
+        mixed ^= mixed >> 31;
 
-        //Get neutral player
-        for(Player* p : players) {
+        return static_cast<unsigned int>(mixed ^ (mixed >> 32));
 
-            if(p != nullptr && p -> getPlayerName() == "Neutral"){ 
-                
-                neutralPlayer = p; 
-                break;
+    }
 
-            }
+    uint64_t GameEngine::computeFingerprint(vector<uint16_t>& owners) const {
+
+        const vector<Territory*>& territories = gameMap -> getTerritories();
+        size_t slots = static_cast<size_t>(playerIndexCount) + 1;
+
+        owners.resize(territories.size());
+        uint64_t fingerprint = 0;
+
+        for(size_t i = 0; i < territories.size(); i++) {
+
+            Player* owner = territories[i] -> getOwner();
+            uint16_t index = owner != nullptr ? owner -> getPlayerIndex() : PLAYER_NO_INDEX;
+            owners[i] = index < playerIndexCount ? static_cast<uint16_t>(index + 1) : 0;
+
+            //Owners are classic Zobrist keys; army counts are unbounded, so each is mixed into its territory's key
+            uint64_t armies = zobristArmyKeys[i] ^ static_cast<uint64_t>(territories[i] -> getNumArmies());
+            armies = (armies ^ (armies >> 30)) * 0xBF58476D1CE4E5B9ull;
+            armies = (armies ^ (armies >> 27)) * 0x94D049BB133111EBull;
+            armies ^= armies >> 31;
+
+            fingerprint ^= zobristOwnerKeys[i * slots + owners[i]] ^ armies;
 
         }
 
-        for(Player* p : players) {
+        return fingerprint;
 
-            if(p != nullptr && p == neutralPlayer){ continue; } //Skip null or neutral players
+    }
 
-            if(!surpressOutput){ 
-                
-                output << "[IssueOrder] Player: " << p -> getPlayerName() 
-                       << " is beginning their IssueOrder phase:\n\n"; 
-            
-            }
+    void GameEngine::resetStalemateTracking() {
 
-            //Let player decide what orders to issue (Deploy + Card + Advance + Defend)
-            string issueOrderResults = p -> issueOrder(surpressOutput, deck, neutralPlayer);
+        stalemateStats = StalemateStats();
+        recentFingerprints.clear();
+        lastOwners.clear();
 
-            //Retrieve all orders issued by this player
-            OrderList* playerOrders = p -> getPlayerOrders();
-            vector<Order*> orders = playerOrders -> getOrders();
+        if(stalemateRules.noProgressTurns <= 0 || gameMap == nullptr) { return; }
 
-            if(orders.empty()){ 
-                
-                if(!surpressOutput){ 
-                    output << "[IssueOrder] Player: " << p -> getPlayerName() 
-                           << " issued no orders this turn.\n"; 
-                }
-                continue; 
-            
-            }
+        size_t numTerritories = gameMap -> getTerritories().size();
+        size_t numKeys = numTerritories * (static_cast<size_t>(playerIndexCount) + 1);
 
-            //Intialize vector that contains all neutral enemies
-            vector<Player*> neutrals = p -> getNeutralEnemies();
-            neutrals.push_back(neutralPlayer); //Add neutral player
+        //Fixed seed: fingerprints only ever compare boards of the same game
+        if(zobristArmyKeys.size() != numTerritories || zobristOwnerKeys.size() != numKeys) {
 
-            //Iterate through every order and handle appropriately
-            for(Order* issuedOrder : orders) {
+            mt19937_64 keyGenerator(0x5A0B2157A1E3C0DEull);
+            zobristOwnerKeys.resize(numKeys);
+            zobristArmyKeys.resize(numTerritories);
+            for(uint64_t& key : zobristOwnerKeys) { key = keyGenerator(); }
+            for(uint64_t& key : zobristArmyKeys) { key = keyGenerator(); }
 
-                if(issuedOrder == nullptr){ continue; }
+        }
 
-                switch(issuedOrder -> getOrderType()) {
+        stalemateStats.fingerprint = computeFingerprint(lastOwners);
 
-                    case(OrderType::Deploy): {
+    }
 
-                        //Deploy handled automatically in reinforcement phase, just print result
-                        if(!surpressOutput){ 
-                            output << "[IssueOrder] " << p -> getPlayerName() 
-                                   << " has a DEPLOY order prepared.\n"; 
-                        }
+    bool GameEngine::trackProgress() {
 
-                    } break;
+        if(stalemateRules.noProgressTurns <= 0 || gameMap == nullptr) { return false; }
 
-                    case(OrderType::Advance): {
+        //Players joined or the map changed since tracking started
+        size_t slots = static_cast<size_t>(playerIndexCount) + 1;
+        if(lastOwners.size() != gameMap -> getTerritories().size() || zobristOwnerKeys.size() != lastOwners.size() * slots) {
 
-                        //Advance orders are handled separately (Attack/Defend logic)
-                        if(!surpressOutput){ 
-                            output << "[IssueOrder] " << p -> getPlayerName() 
-                                   << " has an ADVANCE order queued.\n"; 
-                        }
+            resetStalemateTracking();
+            return false;
 
-                    } break;
+        }
 
-                    case(OrderType::Bomb): { 
+        vector<uint16_t> owners;
+        uint64_t fingerprint = computeFingerprint(owners);
 
-                        handleBombOrder(p, neutralPlayer, issuedOrder, surpressOutput, output);
-                    
-                    } break;
+        int changes = 0;
+        for(size_t i = 0; i < owners.size(); i++) { if(owners[i] != lastOwners[i]) { changes++; } }
+        lastOwners.swap(owners);
 
-                    case(OrderType::Blockade): { 
+        bool repeated = find(recentFingerprints.begin(), recentFingerprints.end(), fingerprint) != recentFingerprints.end();
+        recentFingerprints.push_back(fingerprint);
+        if(recentFingerprints.size() > static_cast<size_t>(stalemateRules.noProgressTurns)) { recentFingerprints.pop_front(); }
 
-                        handleBlockadeOrder(p, neutralPlayer, issuedOrder, surpressOutput, output);
-                    
-                    } break;
+        StalemateStats& stats = stalemateStats;
+        stats.fingerprint = fingerprint;
+        stats.ownershipChangesLastTurn = changes;
+        stats.ownershipChanges += changes;
+        stats.turnsTracked++;
+        if(repeated) { stats.repeatedBoards++; }
 
-                    case(OrderType::Airlift): { 
+        stats.turnsWithoutProgress = (changes > 0 && !repeated) ? 0 : stats.turnsWithoutProgress + 1;
+        stats.longestNoProgressStreak = max(stats.longestNoProgressStreak, stats.turnsWithoutProgress);
 
-                        handleAirliftOrder(p, neutralPlayer, issuedOrder, surpressOutput, output);
-                    
-                    } break;
+        return stats.turnsWithoutProgress >= stalemateRules.noProgressTurns;
 
-                    case(OrderType::Negotiate): { 
+    }
 
-                        handleNegotiateOrder(p, neutralPlayer, neutrals, issuedOrder, surpressOutput, output);
-                    
-                    } break;
+    Player* GameEngine::adjudicateWinner() const {
 
-                    default: {
+        Player* best = nullptr;
+        size_t bestTerritories = 0;
+        long long bestArmies = 0;
 
-                        if(!surpressOutput){ 
-                            output << "[IssueOrder] Error: Unknown order type encountered while issuing orders for player: "
-                                   << p -> getPlayerName() << ".\n"; 
-                        }
+        for(Player* p : players) {
 
-                    } break;
+            if(p == nullptr || p == neutral) { continue; }
 
-                }
+            size_t owned = p -> getOwnedTerritories().size();
+            if(owned == 0) { continue; }
 
-            }
+            long long armies = 0;
+            for(Territory* t : p -> getOwnedTerritories().getTerritories()) { armies += t -> getNumArmies(); }
 
-            if(!surpressOutput) { output << issueOrderResults; }
+            bool better = best == nullptr || owned > bestTerritories ||
+                          (owned == bestTerritories && (armies > bestArmies ||
+                          (armies == bestArmies && p -> getPlayerIndex() < best -> getPlayerIndex())));
 
-        }
+            if(better) {
 
-    }
-    
-    void GameEngine::executeOrdersPhase(bool surpressOutput, ostringstream& output) {
-        // --------- Setup (copied from engineExecuteOrder) ---------
-        vector<Player*> ordered; 
-        queue<Player*> tempQueue = playerQueue; 
+                best = p;
+                bestTerritories = owned;
+                bestArmies = armies;
 
-        Player* neutralPlayer = nullptr;
-        for (Player* p : players) {
-            if (p != nullptr && p->getPlayerName() == "Neutral") {
-                neutralPlayer = p;
-                break;
             }
+
         }
 
-        while (!tempQueue.empty()) {
+        return best;
 
-            Player* tempPlayer = tempQueue.front();
-            tempQueue.pop();
-            if (tempPlayer == neutralPlayer) continue;
-            ordered.push_back(tempPlayer);
-        
-        }
+    }
 
-        vector<Player*> toDelete;
+    void GameEngine::releaseEliminatedPlayers() {
 
-        //---------------------------- Execute Orders ----------------------------//
+        if(journal.getDepth() > 0) { return; }
 
-        // ---------------------------- First Pass: Execute ALL Deploy Orders (Round-Robin) ----------------------------
-        bool anyDeploysRemaining = true;
+        for(Player* p : eliminatedPlayers) { delete p; }
+        eliminatedPlayers.clear();
 
-        queue<Player*> deployQueue = playerQueue; 
-        queue<Player*> activeDeployers; 
+    }
 
-        while (anyDeploysRemaining) {
-            anyDeploysRemaining = false;
+    void GameEngine::undoQueueRemoval(const JournalEntry& entry) {
 
-            while (!deployQueue.empty()) {
-                Player* p = deployQueue.front();
-                deployQueue.pop();
+        GameEngine* engine = static_cast<GameEngine*>(entry.object);
+        if(entry.value < 0) { return; } //The player was not queued
 
-                if (p == nullptr) continue;
-                if (p->getPlayerName() == "Neutral") continue;
+        //Back to its old position, turn order depends on it
+        queue<Player*> restored;
+        long long position = 0;
 
-                OrderList* orders = p->getPlayerOrders();
-                if (!orders || orders->size() == 0) continue;
+        for(; !engine -> playerQueue.empty(); position++) {
 
-                Order* o = orders->peek();
-                if (o == nullptr) { orders->removeOrder(0); continue; }
+            if(position == entry.value) { restored.push(static_cast<Player*>(entry.pointer)); }
+            restored.push(engine -> playerQueue.front());
+            engine -> playerQueue.pop();
 
-                if (o->getOrderType() == OrderType::Deploy) {
-                    anyDeploysRemaining = true;
+        }
 
-                    pair<bool, string> validationResult = o->validate();
-                    if (!validationResult.first) {
-                        if (!surpressOutput) {
-                            output << "[ExecuteOrder] " << p->getPlayerName()
-                                << " executes an invalid Deploy:\nReason: "
-                                << validationResult.second << "\n";
-                        }
+        if(position <= entry.value) { restored.push(static_cast<Player*>(entry.pointer)); }
+        engine -> playerQueue = restored;
 
-                        orders->removeOrder(0);
+    }
 
-                        Order* nextTop = (orders ? orders->peek() : nullptr);
-                        if (nextTop != nullptr && nextTop->getOrderType() == OrderType::Deploy) {
-                            activeDeployers.push(p);
-                        }
-                        continue;
-                    }
+    void GameEngine::undoPlayerErase(const JournalEntry& entry) {
 
-                    if (!surpressOutput) {
-                        output << "[ExecuteOrder] " << p->getPlayerName()
-                            << " Executes a Deploy order\n"
-                            << "[ExecuteOrder] Order effect: " << o->getEffect() << "\n\n";
-                    }
+        GameEngine* engine = static_cast<GameEngine*>(entry.object);
+        Player* p = static_cast<Player*>(entry.pointer);
 
-                    o->execute();
+        engine -> players.insert(engine -> players.begin() + entry.value, p);
 
-                    if (!surpressOutput) {
-                        output << "[ExecuteOrder] " << p->getPlayerName()
-                            << " successfully executed a Deploy order.\n"
-                            << o->getEffect() << "\n\n";
-                    }
+        vector<Player*>& kept = engine -> eliminatedPlayers;
+        kept.erase(remove(kept.begin(), kept.end(), p), kept.end());
 
-                    orders->removeOrder(0);
+    }
 
-                    Order* nextTop = (orders ? orders->peek() : nullptr);
-                    if (nextTop != nullptr && nextTop->getOrderType() == OrderType::Deploy) {
-                        activeDeployers.push(p);
-                    }
+    unsigned long long GameEngine::battleSeedForTurn() const {
 
-                } else {
-                    continue; // skip non-Deploys in this phase
-                }
-            }
+        //Same mixing as decisionSeedFor(), with a position no player has
+        unsigned long long mixed = static_cast<unsigned long long>(rngSeed);
+        mixed ^= static_cast<unsigned long long>(turn) * 0x9E3779B97F4A7C15ull;
+        mixed ^= 0xD6E8FEB86659FD93ull;
+        mixed ^= mixed >> 31;
 
-            deployQueue = activeDeployers;
-            while (!activeDeployers.empty()) activeDeployers.pop();
+        return mixed != 0 ? mixed : 1; //0 would mean clock-based rolls
+
+    }
+
+    void GameEngine::issueOrdersForPlayer(Player* p, Player* neutralPlayer, Deck* gameDeck, bool surpressOutput, ostringstream& output) {
+
+        if(!surpressOutput){ 
+            
+            output << "[IssueOrder] Player: " << p -> getPlayerName() 
+                   << " is beginning their IssueOrder phase:\n\n"; 
+        
         }
 
-        // ---------------------------- Second Pass: Execute ALL Other Orders (Round-Robin) ----------------------------
-        bool anyOrdersRemaining = true;
+        //Let player decide what orders to issue (Deploy + Card + Advance + Defend), observers hear about it once
+        OrderList* playerOrders = p -> getPlayerOrders();
+        if(playerOrders != nullptr) { playerOrders -> beginBatch(); }
 
-        queue<Player*> mainQueue = playerQueue;
-        queue<Player*> activeExecutors;
+        string issueOrderResults = p -> issueOrder(surpressOutput, gameDeck, neutralPlayer);
 
-        while (anyOrdersRemaining) {
-            anyOrdersRemaining = false;
+        if(playerOrders != nullptr) { playerOrders -> endBatch(); }
 
-            while (!mainQueue.empty()) {
-                Player* p = mainQueue.front();
-                mainQueue.pop();
+        finalizeIssuedOrders(p, neutralPlayer, issueOrderResults, surpressOutput, output);
 
-                if (p == nullptr || p->getPlayerName() == "Neutral") continue;
+    }
 
-                OrderList* orders = p->getPlayerOrders();
-                if (!orders || orders->size() == 0) continue;
+    void GameEngine::finalizeIssuedOrders(Player* p, Player* neutralPlayer, const string& issueOrderResults, bool surpressOutput, ostringstream& output) {
 
-                Order* o = orders->peek();
-                if (o == nullptr) { orders->removeOrder(0); continue; }
+        //Retrieve all orders issued by this player
+        OrderList* playerOrders = p -> getPlayerOrders();
+        vector<Order*>& orders = playerOrders -> getOrders(); //replaceOrder() swaps in place, so iterating the live list is safe
 
-                if (o->getOrderType() == OrderType::Deploy) {
-                    // keep them rotating if more remain behind deploys
-                    if (orders->size() > 1) activeExecutors.push(p);
-                    continue;
-                }
+        if(orders.empty()){ 
+            
+            if(!surpressOutput){ 
+                output << "[IssueOrder] Player: " << p -> getPlayerName() 
+                       << " issued no orders this turn.\n"; 
+            }
+            return; 
+        
+        }
 
-                anyOrdersRemaining = true;
+        //Intialize vector that contains all neutral enemies
+        vector<Player*> neutrals = p -> getNeutralEnemies();
+        neutrals.push_back(neutralPlayer); //Add neutral player
 
-                pair<bool, string> validationResult = o->validate();
-                if (!validationResult.first) {
-                    if (!surpressOutput) {
-                        output << "[ExecuteOrder]" << p->getPlayerName()
-                            << " executes an invalid order: " << *o 
-                            << ". Reason:\n" << validationResult.second << "\n";
-                    }
+        //Iterate through every order and handle appropriately
+        for(Order* issuedOrder : orders) {
 
-                    orders->removeOrder(0);
+            if(issuedOrder == nullptr){ continue; }
 
-                    Order* nextTop = (orders ? orders->peek() : nullptr);
-                    if (nextTop != nullptr) activeExecutors.push(p);
+            switch(issuedOrder -> getOrderType()) {
 
-                    continue;
-                }
+                case(OrderType::Deploy): {
 
-                if (!surpressOutput) {
-                    output << "[ExecuteOrder] " << p->getPlayerName()
-                        << " Executes: " << *o << "\n"
-                        << "[ExecuteOrder] Order effect: " << o->getEffect() << "\n\n";
-                }
+                    //Deploy handled automatically in reinforcement phase, just print result
+                    if(!surpressOutput){ 
+                        output << "[IssueOrder] " << p -> getPlayerName() 
+                               << " has a DEPLOY order prepared.\n"; 
+                    }
 
-                o->execute();
+                } break;
 
-                if (!surpressOutput) {
-                    output << "[ExecuteOrder] " << p->getPlayerName()
-                        << " is successful in issuing the order.\n"
-                        << o->getEffect() << "\n\n";
-                }
+                case(OrderType::Advance): {
 
-                orders->removeOrder(0);
+                    //Advance orders are handled separately (Attack/Defend logic)
+                    if(!surpressOutput){ 
+                        output << "[IssueOrder] " << p -> getPlayerName() 
+                               << " has an ADVANCE order queued.\n"; 
+                    }
 
-                Order* nextTop = (orders ? orders->peek() : nullptr);
-                if (nextTop != nullptr) activeExecutors.push(p);
-            }
+                } break;
 
-            mainQueue = activeExecutors;
-            while (!activeExecutors.empty()) activeExecutors.pop();
-        }
+                case(OrderType::Bomb): { 
 
-        // ----------------------------- Clearing Truces / Collecting Cards -----------------------------
-        for (Player* p: players) {
-            if (!p) continue;
+                    handleBombOrder(p, neutralPlayer, issuedOrder, surpressOutput, output);
+                
+                } break;
 
-            p->clearNeutralEnemies();
+                case(OrderType::Blockade): { 
 
-            if (p->getGenerateCardThisTurn()) {
-                Deck* gameDeck = deck;
-                if (gameDeck && p->getHand()) {
-                    Card* c = gameDeck->draw();
-                    if (c) p->getHand()->addCardToHand(c);
-                }
-            }
-        }
+                    handleBlockadeOrder(p, neutralPlayer, issuedOrder, surpressOutput, output);
+                
+                } break;
 
-        //---------------------------- Eliminate Players ----------------------------
-        for (auto it = players.begin(); it != players.end();) {
-            Player* p = *it;
+                case(OrderType::Airlift): { 
 
-            if (p == nullptr || p->getPlayerName() == "Neutral") {
-                it++;
-                continue;
-            }
+                    handleAirliftOrder(p, neutralPlayer, issuedOrder, surpressOutput, output);
+                
+                } break;
 
-            int terrCount = static_cast<int>(p->getOwnedTerritories().size());
-            if (terrCount == 0) {
+                case(OrderType::Negotiate): { 
 
-                if (!surpressOutput) {
-                    output << "[" << p->getPlayerName() << "] has been eliminated from the game.\n";
-                }
+                    handleNegotiateOrder(p, neutralPlayer, neutrals, issuedOrder, surpressOutput, output);
+                
+                } break;
 
-                queue<Player*> newQueue;
-                while (!playerQueue.empty()) {
-                    Player* front = playerQueue.front();
-                    playerQueue.pop();
-                    if (front != p) newQueue.push(front);
-                }
-                playerQueue = newQueue;
+                default: {
+
+                    if(!surpressOutput){ 
+                        output << "[IssueOrder] Error: Unknown order type encountered while issuing orders for player: "
+                               << p -> getPlayerName() << ".\n"; 
+                    }
+
+                } break;
 
-                toDelete.push_back(p);
-                it = players.erase(it);
-                continue;
             }
 
-            it++;
         }
 
-        // ---------------------------- Win Condition Check ----------------------------
-        int activePlayers = 0;
-        Player* potentialWinner = nullptr;
-        bool hasWon = false;
-        bool controlsMap = false;
+        if(!surpressOutput) { output << issueOrderResults; }
 
-        for (Player* p : players) { 
-            if (p == nullptr) continue;
-            if (p->getPlayerName() == "Neutral") continue;
+    }
 
-            int terrCount = static_cast<int>(p->getOwnedTerritories().size()); 
-            if (terrCount > 0) { 
-                activePlayers++;
-                potentialWinner = p;
-            }
-        }
+    vector<Player*> GameEngine::prepareIssuers(Player*& neutralPlayer) {
 
-        if (activePlayers == 1 && potentialWinner != nullptr) { 
-            hasWon = true;
-            currentPlayer = potentialWinner;
-        }
+        neutralPlayer = neutral;
 
-        const unordered_map<Continent*, long long>& refTable = gameMap->getContinentLookupTable(); 
+        //Collect issuing players, and seed their decisions for this turn
+        vector<Player*> issuers;
 
-        for (Player* p : ordered) {
-            if (p == nullptr) continue;
-            if (find(toDelete.begin(), toDelete.end(), p) != toDelete.end()) continue;
+        for(size_t i = 0; i < players.size(); i++) {
 
-            if (p->controlsMap(refTable)) {
-                currentPlayer = p;
-                controlsMap = true;
-                break;
-            }
-        }
+            Player* p = players[i];
+            if(p == nullptr || p == neutralPlayer){ continue; } //Skip null or neutral players
+
+            p -> seedDecisionRng(decisionSeedFor(i));
+            issuers.push_back(p);
 
-        //---------------------------- Deferred Cleanup ----------------------------
-        for (Player* dead : toDelete) {
-            if (dead != nullptr) {
-                if (!surpressOutput) {
-                    output << "[ExecuteOrders] Deleting player object for " << dead->getPlayerName() << "\n";
-                }
-                delete dead;
-            }
         }
-        toDelete.clear();
 
-        setTurn(getTurn() + 1); // increment turn
+        return issuers;
 
-        //---------------------------- Phase Transition (append messages) ----------------------------
-        if (getTurn() > maxTurns) {
-            state = EngineState::Win; // force game termination
+    }
 
-            if (!surpressOutput) {
-                output << "\n=== GAME ENDED: MAXIMUM TURN LIMIT REACHED ===\n"
-                    << "[ExecuteOrder] The maximum number of turns (" << maxTurns << ") has been reached.\n"
-                    << "[ExecuteOrder] No further rounds will be played. Game over.\n";
-            }
-            return;
-        } 
-        else if (hasWon && controlsMap) {
-            state = EngineState::Win;
+    void GameEngine::issueOrdersPhase(bool surpressOutput, ostringstream& output) {
 
-            if (!surpressOutput) {
-                output << "\n=== WINNER DETECTED ===\n"
-                    << currentPlayer->getPlayerName()
-                    << " has won! They control all continents on the map!\n"
-                    << "[ExecuteOrder] Win condition triggered.";
-            }
-            return;
-        } 
-        else if (hasWon) {
-            state = EngineState::Win;
+        StateJournal::Scope recording(recordingJournal());
 
-            if (!surpressOutput) {
-                output << "\n=== WINNER DETECTED ===\n"
-                    << currentPlayer->getPlayerName()
-                    << " has won! They have elimnated all non-neutral enemies!\n"
-                    << "[ExecuteOrder] Win condition triggered.";
-            }
+        Player* neutralPlayer = nullptr;
+        vector<Player*> issuers = prepareIssuers(neutralPlayer);
 
-            return;
-        
-        } else {
+        //Strategies that touch the board or the console while issuing force a sequential phase
+        bool concurrentSafe = true;
 
-            if (!surpressOutput) {
-                output << "[ExecuteOrder] All orders executed successfully. "
-                    << "Proceeding to next turn’s Reinforcement phase.\n";
-            }
+        for(Player* p : issuers) {
+
+            if(p -> getStrategy() != nullptr && !p -> getStrategy() -> canIssueConcurrently()) { concurrentSafe = false; }
 
-            return;
         }
 
-    }
+        //Journal recording is single threaded too
+        if(!parallelIssueOrders || !concurrentSafe || issuers.size() < 2 || journal.getDepth() > 0) {
 
-    bool GameEngine::startAgain() {
+            for(Player* p : issuers) { issueOrdersForPlayer(p, neutralPlayer, deck, surpressOutput, output); }
+            return;
 
-        if(state != EngineState::Win) { //Can only restart after game has been won
+        }
 
-            cout << "[Warning] You can only restart the game when someone has won." << endl;
-            return false;
+        //Parallel mode: nothing mutates the board during this phase, so every player decides against the same state.
+        //Each player writes to its own log buffer and holds its used cards instead of touching the shared deck.
+        vector<ostringstream> playerOutputs(issuers.size());
+        atomic<size_t> nextIssuer(0);
 
-        }
+        auto worker = [&]() {
 
-        string response;
+            size_t i;
+            while((i = nextIssuer.fetch_add(1)) < issuers.size()) {
 
-        while(true) {
+                issueOrdersForPlayer(issuers[i], neutralPlayer, nullptr, surpressOutput, playerOutputs[i]);
 
-            cout << "\n[WIN] The game has ended. Would you like to start a new game? (yes, y / no, n): ";
-            cin.ignore(numeric_limits<streamsize>::max(), '\n');
-            getline(std::cin, response);
+            }
 
-            // Trim whitespace and convert to lowercase
-            response.erase(remove_if(response.begin(), response.end(), ::isspace), response.end());
-            transform(response.begin(), response.end(), response.begin(), ::tolower);
+        };
 
-            clearGame(); //Clear all game data, since no matter the response, it must be reset
+        unsigned int numThreads = max(1u, thread::hardware_concurrency());
+        numThreads = min(numThreads, static_cast<unsigned int>(issuers.size()));
 
-            if(response == "yes" || response == "y") {
+        vector<thread> workers;
+        for(unsigned int i = 1; i < numThreads; i++) { workers.emplace_back(worker); }
+        worker(); //Calling thread participates too
+        for(thread& w : workers) { w.join(); }
 
-                state = EngineState::Start;
-                cout << "\n[GameEngine] The game has been reset. You may now load a new map and begin again.\n";
-                return true;
+        //Serialize shared side effects in player order, exactly as the sequential run would have produced them
+        for(size_t i = 0; i < issuers.size(); i++) {
 
-            } else if(response == "no" || response == "n") {
-              
-                state = EngineState::End;
-                cout << "\n[GameEngine] Exiting the game. See you next time!\n";
-                return false;
-            
-            } else { cout << "\n[GameEngine] Invalid input. Please type 'yes' or 'no'."; }
+            issuers[i] -> returnPendingCards(deck);
+            output << playerOutputs[i].str();
 
         }
 
     }
+    
+    int GameEngine::compactOrders(bool surpressOutput, ostringstream& output) {
 
-    pair<int, string> GameEngine::computeReinforcementFor(Player* p, bool surpressOutput) const {
-        
-        // ---------------- Safety Checks ---------------- //
-        if(p == nullptr || gameMap == nullptr) { 
-            
-            return {0, "[Reinforcement] Error: Invalid player or map pointer."}; 
-        
-        }
-
-        // ---------------- Base Calculation ---------------- //
-        int ownedTerrs = static_cast<int>(p -> getOwnedTerritories().size());
-        int baseArmies = max(3, static_cast<int>(ownedTerrs / 3));
-        int bonusArmies = 0;
-        int reinforcementPool = p -> getReinforcementPool();
+        ordersEliminatedLastTurn = 0;
+        if(!compactOrdersEnabled || gameMap == nullptr) { return 0; }
 
-        unordered_map<Continent*, long long> continentLookupTable = gameMap -> getContinentLookupTable();
+        //Players whose orders will execute this turn, in queue order
+        vector<Player*> executors;
+        queue<Player*> tempQueue = playerQueue;
 
-        ostringstream desc;
-        if(!surpressOutput) {
+        while(!tempQueue.empty()) {
 
-            desc << "[Reinforcement] Calculating reinforcement for player: " 
-                 << p -> getPlayerName() << "\n"
-                 << "[Reinforcement] Base armies from territories (" 
-                 << ownedTerrs << " owned): " << baseArmies << "\n";
+            Player* p = tempQueue.front();
+            tempQueue.pop();
+            if(p != nullptr && p -> getPlayerOrders() != nullptr && p != neutral) { executors.push_back(p); }
 
         }
 
-        // ---------------- Continent Bonus Calculation ---------------- //
-        for(Continent* c : gameMap -> getContinents()) {
+        //How many pending orders (any player, any type) read or write each territory
+        const vector<Territory*>& territories = gameMap -> getTerritories();
+        vector<int> targetedBy(territories.size(), 0);
+        vector<int> touchedBy(territories.size(), 0);
 
-            if(c == nullptr){ continue; } //Skip null pointers
+        auto inRange = [&territories](int index) { return index >= 0 && index < static_cast<int>(territories.size()); };
 
-            //If player controls entire continent, apply bonus
-            if(p -> controlsContinent(continentLookupTable, c)) {
+        for(Player* p : executors) {
 
-                bonusArmies += c -> getBonusValue();
+            for(Order* o : p -> getPlayerOrders() -> getOrders()) {
 
-                if(!surpressOutput){
+                if(o == nullptr) { continue; }
 
-                    desc << "[Reinforcement] " << p -> getPlayerName()
-                        << " receives +" << c -> getBonusValue()
-                        << " bonus armies for controlling the continent: " 
-                        << c -> getID() << "\n";
+                OrderRecord record = o -> toRecord();
+                if(inRange(record.target)) { targetedBy[record.target]++; touchedBy[record.target]++; }
+                if(inRange(record.source)) { touchedBy[record.source]++; }
 
-                }
             }
+
         }
 
-        // ---------------- Final Computation ---------------- //
-        int totalArmies = baseArmies + bonusArmies + reinforcementPool;
+        for(Player* p : executors) {
 
-        if(!surpressOutput){
+            OrderList* orders = p -> getPlayerOrders();
+            vector<Order*>& pending = orders -> getOrders();
 
-            desc << "[Reinforcement] Final reinforcement pool contribution: " 
-                << reinforcementPool << "\n"
-                << "[Reinforcement] Total armies calculated for deployment: " 
-                << totalArmies << "\n";
+            //Friendly Advances grouped by edge, in issue order
+            map<pair<int, int>, vector<int>> friendlyEdges;
 
-        }
+            //A Deploy queued after other orders blocks the rest of the list in the second pass, so nothing past it is merged
+            bool seenNonDeploy = false;
+            bool blocked = false;
 
-        return { totalArmies, desc.str() };
-    
-    }
+            for(size_t i = 0; i < pending.size(); i++) {
 
-    Player* GameEngine::findPlayerByName(const string& name) const {
-        
+                Order* o = pending[i];
+                if(o == nullptr) { seenNonDeploy = true; continue; }
+
+                OrderRecord record = o -> toRecord();
+                if(record.type == OrderType::Deploy) { blocked = blocked || seenNonDeploy; continue; }
+
+                seenNonDeploy = true;
+                if(record.type != OrderType::Advance && record.type != OrderType::Airlift) { continue; }
+                if(!inRange(record.source) || !inRange(record.target)) { continue; }
+
+                Territory* source = territories[record.source];
+                Territory* target = territories[record.target];
+
+                //Armies on a source only grow through orders that target it, so without one they can only shrink
+                bool sourceFixed = targetedBy[record.source] == 0;
+                bool failsOnArmies = record.type == OrderType::Advance
+                    ? source -> getNumArmies() < record.numArmies || source -> getNumArmies() <= 1
+                    : source -> getNumArmies() <= 1 || record.numArmies > source -> getNumArmies() - 1;
+
+                bool provablyFails = record.numArmies <= 0 || (sourceFixed && failsOnArmies);
+                if(record.type == OrderType::Advance) { provablyFails = provablyFails || find(source -> getNeighbors().begin(), source -> getNeighbors().end(), target) == source -> getNeighbors().end(); }
+
+                if(provablyFails) {
+
+                    orders -> elideOrder(static_cast<int>(i));
+                    ordersEliminatedLastTurn++;
+                    continue;
+
+                }
+
+                if(!blocked && record.type == OrderType::Advance && source -> getOwner() == p && target -> getOwner() == p) {
+
+                    friendlyEdges[{ record.source, record.target }].push_back(static_cast<int>(i));
+
+                }
+
+            }
+
+            //Merge moves along the same friendly edge, if nothing else this turn reads or writes either end
+            for(auto& edge : friendlyEdges) {
+
+                const vector<int>& group = edge.second;
+                int groupSize = static_cast<int>(group.size());
+
+                if(groupSize < 2) { continue; }
+                if(touchedBy[edge.first.first] != groupSize || touchedBy[edge.first.second] != groupSize) { continue; }
+
+                //Replay the group on the source's army count to get what actually moves
+                int available = territories[edge.first.first] -> getNumArmies();
+                int moved = 0;
+
+                for(int index : group) {
+
+                    int requested = pending[index] -> toRecord().numArmies;
+                    if(available < requested || available <= 1) { continue; } //Would fail, moves nothing
+
+                    int step = min(requested, available - 1);
+                    available -= step;
+                    moved += step;
+
+                }
+
+                for(size_t k = 0; k < group.size(); k++) {
+
+                    if(k == 0 && moved > 0) {
+
+                        orders -> replaceOrder(group[k], new Advance(p, territories[edge.first.first], territories[edge.first.second], moved));
+                        continue;
+
+                    }
+
+                    orders -> elideOrder(group[k]);
+                    ordersEliminatedLastTurn++;
+
+                }
+
+            }
+
+        }
+
+        if(!surpressOutput) {
+
+            output << "[CompactOrders] " << ordersEliminatedLastTurn << " order(s) eliminated before execution.\n\n";
+
+        }
+
+        return ordersEliminatedLastTurn;
+
+    }
+
+    int GameEngine::executeDeploysBatched() {
+
+        if(gameMap == nullptr) { return 0; }
+
+        const vector<Territory*>& territories = gameMap -> getTerritories();
+        const int numTerritories = static_cast<int>(territories.size());
+
+        //Gather: the Deploys the round-robin pass would run are exactly the leading Deploys of each list
+        vector<int32_t> targets;
+        vector<int32_t> deltas;
+        vector<Player*> issuers;
+
+        queue<Player*> tempQueue = playerQueue;
+
+        while(!tempQueue.empty()) {
+
+            Player* p = tempQueue.front();
+            tempQueue.pop();
+
+            if(p == nullptr || p == neutral || p -> getPlayerOrders() == nullptr) { continue; }
+
+            OrderList* orders = p -> getPlayerOrders();
+
+            while(orders -> size() > 0 && orders -> peek() != nullptr && orders -> peek() -> getOrderType() == OrderType::Deploy) {
+
+                const OrderRecord* record = orders -> peekRecord();
+                OrderRecord deploy = record != nullptr ? *record : orders -> peek() -> toRecord();
+
+                targets.push_back(deploy.target);
+                deltas.push_back(deploy.numArmies);
+                issuers.push_back(deploy.issuer);
+                orders -> popFront();
+
+            }
+
+        }
+
+        //Validate in bulk: Deploys never change ownership, so every check sees the same board
+        long long started = orderStats.start();
+        vector<int> armyDelta(numTerritories, 0);
+        vector<bool> valid(targets.size(), false);
+        int applied = 0;
+
+        for(size_t i = 0; i < targets.size(); i++) {
+
+            int32_t t = targets[i];
+            if(t < 0 || t >= numTerritories || issuers[i] == nullptr || deltas[i] <= 0) { continue; }
+            if(territories[t] -> getOwner() != issuers[i]) { continue; }
+
+            armyDelta[t] += deltas[i]; //Scatter-add
+            valid[i] = true;
+            applied++;
+
+        }
+
+        for(int t = 0; t < numTerritories; t++) {
+
+            if(armyDelta[t] != 0) { territories[t] -> setNumArmies(territories[t] -> getNumArmies() + armyDelta[t]); }
+
+        }
+
+        if(started != 0 && !targets.empty()) { //Each Deploy is charged an equal share of the batch
+
+            long long share = (orderStats.start() - started) / static_cast<long long>(targets.size());
+
+            for(size_t i = 0; i < targets.size(); i++) {
+
+                orderStats.recordElapsed(OrderType::Deploy, valid[i] ? ExecutionResult::Success : ExecutionResult::Invalid, share);
+
+            }
+
+        }
+
+        return applied;
+
+    }
+
+    //Records scanned when forming one batch, bounds the cost of long dependency chains
+    static const size_t EXECUTE_SCHEDULE_WINDOW = 1024;
+
+    void GameEngine::executeRecordsConcurrently(const vector<OrderRecord>& schedule) {
+
+        const vector<Territory*>& territories = gameMap -> getTerritories();
+        const int numTerritories = static_cast<int>(territories.size());
+
+        //Resource ids: one per territory, then two per player index (owned territories + card flag, truce list).
+        //Players without an index share one last pair, which only costs parallelism
+        const int numResources = numTerritories + 2 * (static_cast<int>(playerIndexCount) + 1);
+        vector<size_t> readStamp(numResources, 0);
+        vector<size_t> writeStamp(numResources, 0);
+
+        auto territoriesOf = [&](const Player* p) {
+
+            int index = min(static_cast<int>(p -> getPlayerIndex()), static_cast<int>(playerIndexCount));
+            return numTerritories + 2 * index;
+
+        };
+
+        auto trucesOf = [&](const Player* p) { return territoriesOf(p) + 1; };
+
+        //Everything a record reads or writes, worked out against the board as it stands before its batch runs
+        auto accessOf = [&](const OrderRecord& r, vector<int>& reads, vector<int>& writes) {
+
+            reads.clear();
+            writes.clear();
+            if(r.issuer == nullptr) { return; } //Fails validation without reading anything
+
+            bool hasSource = r.source >= 0 && r.source < numTerritories;
+            bool hasTarget = r.target >= 0 && r.target < numTerritories;
+
+            switch(r.type) {
+
+                case OrderType::Deploy:
+                    if(hasTarget) { writes.push_back(r.target); }
+                    reads.push_back(territoriesOf(r.issuer));
+                    break;
+
+                case OrderType::Advance: {
+                    if(hasSource) { writes.push_back(r.source); }
+                    if(!hasTarget) { break; }
+                    writes.push_back(r.target);
+                    reads.push_back(trucesOf(r.issuer));
+
+                    Player* defender = territories[r.target] -> getOwner();
+                    if(defender == r.issuer) { reads.push_back(territoriesOf(r.issuer)); break; }
+
+                    //A conquest moves the territory between both players and earns the attacker a card
+                    writes.push_back(territoriesOf(r.issuer));
+                    if(defender != nullptr) { writes.push_back(territoriesOf(defender)); }
+                    break;
+                }
+
+                case OrderType::Bomb:
+                    if(hasTarget) { writes.push_back(r.target); }
+                    reads.push_back(territoriesOf(r.issuer));
+                    reads.push_back(trucesOf(r.issuer));
+                    break;
+
+                case OrderType::Blockade:
+                    if(hasTarget) { writes.push_back(r.target); }
+                    writes.push_back(territoriesOf(r.issuer));
+                    if(r.targetPlayer != nullptr) { writes.push_back(territoriesOf(r.targetPlayer)); }
+                    break;
+
+                case OrderType::Airlift:
+                    if(hasSource) { writes.push_back(r.source); }
+                    if(hasTarget) { writes.push_back(r.target); }
+                    reads.push_back(territoriesOf(r.issuer));
+                    break;
+
+                case OrderType::Negotiate:
+                    writes.push_back(trucesOf(r.issuer));
+                    if(r.targetPlayer != nullptr) { writes.push_back(trucesOf(r.targetPlayer)); }
+                    break;
+
+            }
+
+        };
+
+        vector<size_t> pending(schedule.size());
+        for(size_t i = 0; i < pending.size(); i++) { pending[i] = i; }
+
+        vector<size_t> batch;
+        vector<size_t> deferred;
+        vector<int> reads;
+        vector<int> writes;
+        size_t stamp = 0;
+
+        while(!pending.empty()) {
+
+            //Greedy batch: a record joins unless it conflicts with an earlier record of this scan, run or deferred.
+            //Deferred records keep their claims, so nothing overtakes a record it depends on.
+            stamp++;
+            batch.clear();
+            deferred.clear();
+
+            for(size_t k = 0; k < pending.size(); k++) {
+
+                if(k == EXECUTE_SCHEDULE_WINDOW) {
+
+                    deferred.insert(deferred.end(), pending.begin() + k, pending.end());
+                    break;
+
+                }
+
+                accessOf(schedule[pending[k]], reads, writes);
+
+                bool conflict = false;
+                for(int w : writes) { conflict = conflict || writeStamp[w] == stamp || readStamp[w] == stamp; }
+                for(int r : reads) { conflict = conflict || writeStamp[r] == stamp; }
+
+                for(int w : writes) { writeStamp[w] = stamp; }
+                for(int r : reads) { readStamp[r] = stamp; }
+
+                if(conflict) { deferred.push_back(pending[k]); } else { batch.push_back(pending[k]); }
+
+            }
+
+            //Records of a batch touch disjoint state, so any interleaving gives the sequential result
+            if(batch.size() < parallelExecuteMinBatch) {
+
+                for(size_t index : batch) { WarzoneOrder::executeRecord(schedule[index], territories, &orderStats); }
+
+            } else {
+
+                atomic<size_t> nextRecord(0);
+                unsigned long long battleSeed = BattleDice::getSeed(); //Per thread, workers take the phase's seed
+
+                auto worker = [&]() {
+
+                    BattleDice::setSeed(battleSeed);
+
+                    size_t i;
+                    while((i = nextRecord.fetch_add(1)) < batch.size()) { WarzoneOrder::executeRecord(schedule[batch[i]], territories, &orderStats); }
+
+                };
+
+                //At least a quarter of the minimum batch per thread
+                unsigned int numThreads = max(1u, thread::hardware_concurrency());
+                numThreads = min(numThreads, static_cast<unsigned int>(batch.size() / max<size_t>(parallelExecuteMinBatch / 4, 1)));
+                parallelBatchesLastTurn++;
+
+                vector<thread> workers;
+                for(unsigned int i = 1; i < numThreads; i++) { workers.emplace_back(worker); }
+                worker(); //Calling thread participates too
+                for(thread& w : workers) { w.join(); }
+
+            }
+
+            pending.swap(deferred);
+
+        }
+
+    }
+
+    void GameEngine::executeOrdersPhase(bool surpressOutput, ostringstream& output) {
+
+        StateJournal::Scope recording(recordingJournal());
+        OrderStats::Scope statsSink(&orderStats); //Orders executed through the class API record here too
+
+        // --------- Setup (copied from engineExecuteOrder) ---------
+        vector<Player*> ordered; 
+        queue<Player*> tempQueue = playerQueue; 
+
+        while (!tempQueue.empty()) {
+
+            Player* tempPlayer = tempQueue.front();
+            tempQueue.pop();
+            if (tempPlayer == neutral) continue;
+            ordered.push_back(tempPlayer);
+        
+        }
+
+        vector<Player*> toDelete;
+
+        //Battles roll from a per-turn seed, so recorded turns replay identically
+        unsigned long long battleSeed = replayBattleSeed != 0 ? replayBattleSeed : battleSeedForTurn();
+        BattleDice::setSeed(battleSeed);
+
+        //Recorded as issued, before compaction touches the lists
+        if (recorder.isOpen() && gameMap != nullptr) recordTurn(battleSeed);
+
+        //Drop orders that cannot succeed and merge repeated friendly moves before anything executes
+        compactOrders(surpressOutput, output);
+
+        //Observers of each list hear about the whole phase once, instead of once per executed order
+        //Silent runs execute compact order records instead, skipping effect strings and order notifications
+        bool useRecords = surpressOutput && gameMap != nullptr;
+
+        //Which record runs when depends only on the lists, never on results, so records can be collected first and run afterwards
+        bool deferRecords = useRecords && parallelExecuteOrders && journal.getDepth() == 0; //The journal is single threaded
+        parallelBatchesLastTurn = 0;
+        vector<OrderRecord> schedule;
+
+        for (Player* p : ordered) {
+            if (p && p->getPlayerOrders()) {
+                p->getPlayerOrders()->beginBatch();
+                if (useRecords) p->getPlayerOrders()->compileRecords();
+            }
+        }
+
+        //---------------------------- Execute Orders ----------------------------//
+
+        //Silent runs apply every leading Deploy at once, the round-robin pass below then finds none left
+        if (useRecords) executeDeploysBatched();
+
+        // ---------------------------- First Pass: Execute ALL Deploy Orders (Round-Robin) ----------------------------
+        bool anyDeploysRemaining = true;
+
+        queue<Player*> deployQueue = playerQueue; 
+        queue<Player*> activeDeployers; 
+
+        while (anyDeploysRemaining) {
+            anyDeploysRemaining = false;
+
+            while (!deployQueue.empty()) {
+                Player* p = deployQueue.front();
+                deployQueue.pop();
+
+                if (p == nullptr || p == neutral) continue;
+
+                OrderList* orders = p->getPlayerOrders();
+                if (!orders || orders->size() == 0) continue;
+
+                Order* o = orders->peek();
+                if (o == nullptr) continue; //Elided slot, it takes its turn in the second pass
+
+                if (o->getOrderType() == OrderType::Deploy) {
+                    anyDeploysRemaining = true;
+
+                    const OrderRecord* record = orders->peekRecord();
+                    if (record != nullptr) {
+                        if (deferRecords) schedule.push_back(*record);
+                        else WarzoneOrder::executeRecord(*record, gameMap->getTerritories(), &orderStats);
+                        orders->popFront();
+
+                        Order* nextTop = orders->peek();
+                        if (nextTop != nullptr && nextTop->getOrderType() == OrderType::Deploy) {
+                            activeDeployers.push(p);
+                        }
+                        continue;
+                    }
+
+                    //Validated exactly once, the message is only built when it gets printed
+                    long long started = orderStats.start();
+                    ValidationStatus status = o->check();
+                    if (status != ValidationStatus::Valid) {
+                        orderStats.record(OrderType::Deploy, ExecutionResult::Invalid, started);
+                        if (!surpressOutput) {
+                            output << "[ExecuteOrder] " << p->getPlayerName()
+                                << " executes an invalid Deploy:\nReason: "
+                                << o->validationMessage(status) << "\n";
+                        }
+
+                        orders->popFront();
+
+                        Order* nextTop = (orders ? orders->peek() : nullptr);
+                        if (nextTop != nullptr && nextTop->getOrderType() == OrderType::Deploy) {
+                            activeDeployers.push(p);
+                        }
+                        continue;
+                    }
+
+                    if (!surpressOutput) {
+                        output << "[ExecuteOrder] " << p->getPlayerName()
+                            << " Executes a Deploy order\n"
+                            << "[ExecuteOrder] Order effect: " << o->getEffect() << "\n\n";
+                    }
+
+                    bool succeeded = o->executeValidated();
+                    orderStats.record(OrderType::Deploy, succeeded ? ExecutionResult::Success : ExecutionResult::Failure, started);
+
+                    if (!surpressOutput) {
+                        output << "[ExecuteOrder] " << p->getPlayerName()
+                            << " successfully executed a Deploy order.\n"
+                            << o->getEffect() << "\n\n";
+                    }
+
+                    orders->popFront();
+
+                    Order* nextTop = (orders ? orders->peek() : nullptr);
+                    if (nextTop != nullptr && nextTop->getOrderType() == OrderType::Deploy) {
+                        activeDeployers.push(p);
+                    }
+
+                } else {
+                    continue; // skip non-Deploys in this phase
+                }
+            }
+
+            deployQueue = activeDeployers;
+            while (!activeDeployers.empty()) activeDeployers.pop();
+        }
+
+        // ---------------------------- Second Pass: Execute ALL Other Orders (Round-Robin) ----------------------------
+        bool anyOrdersRemaining = true;
+
+        queue<Player*> mainQueue = playerQueue;
+        queue<Player*> activeExecutors;
+
+        while (anyOrdersRemaining) {
+            anyOrdersRemaining = false;
+
+            while (!mainQueue.empty()) {
+                Player* p = mainQueue.front();
+                mainQueue.pop();
+
+                if (p == nullptr || p == neutral) continue;
+
+                OrderList* orders = p->getPlayerOrders();
+                if (!orders || orders->size() == 0) continue;
+
+                Order* o = orders->peek();
+                if (o == nullptr) { //Elided by compactOrders(), consumes its round-robin turn like the failing order it replaced
+                    anyOrdersRemaining = true;
+                    orders->popFront();
+                    if (orders->size() > 0) activeExecutors.push(p);
+                    continue;
+                }
+
+                if (o->getOrderType() == OrderType::Deploy) {
+                    // keep them rotating if more remain behind deploys
+                    if (orders->size() > 1) activeExecutors.push(p);
+                    continue;
+                }
+
+                anyOrdersRemaining = true;
+
+                const OrderRecord* record = orders->peekRecord();
+                if (record != nullptr) {
+                    if (deferRecords) schedule.push_back(*record);
+                    else WarzoneOrder::executeRecord(*record, gameMap->getTerritories(), &orderStats);
+                    orders->popFront();
+
+                    if (orders->size() > 0) activeExecutors.push(p);
+                    continue;
+                }
+
+                long long started = orderStats.start();
+                ValidationStatus status = o->check();
+                if (status != ValidationStatus::Valid) {
+                    orderStats.record(o->getOrderType(), ExecutionResult::Invalid, started);
+                    if (!surpressOutput) {
+                        output << "[ExecuteOrder]" << p->getPlayerName()
+                            << " executes an invalid order: " << *o 
+                            << ". Reason:\n" << o->validationMessage(status) << "\n";
+                    }
+
+                    orders->popFront();
+
+                    if (orders->size() > 0) activeExecutors.push(p);
+
+                    continue;
+                }
+
+                if (!surpressOutput) {
+                    output << "[ExecuteOrder] " << p->getPlayerName()
+                        << " Executes: " << *o << "\n"
+                        << "[ExecuteOrder] Order effect: " << o->getEffect() << "\n\n";
+                }
+
+                bool succeeded = o->executeValidated();
+                orderStats.record(o->getOrderType(), succeeded ? ExecutionResult::Success : ExecutionResult::Failure, started);
+
+                if (!surpressOutput) {
+                    output << "[ExecuteOrder] " << p->getPlayerName()
+                        << " is successful in issuing the order.\n"
+                        << o->getEffect() << "\n\n";
+                }
+
+                orders->popFront();
+
+                if (orders->size() > 0) activeExecutors.push(p);
+            }
+
+            mainQueue = activeExecutors;
+            while (!activeExecutors.empty()) activeExecutors.pop();
+        }
+
+        if (deferRecords) executeRecordsConcurrently(schedule);
+
+        for (Player* p : ordered) {
+            if (p && p->getPlayerOrders()) p->getPlayerOrders()->endBatch();
+        }
+
+        // ----------------------------- Clearing Truces / Collecting Cards -----------------------------
+        for (Player* p: players) {
+            if (!p) continue;
+
+            p->clearNeutralEnemies();
+
+            if (p->getGenerateCardThisTurn()) {
+                Deck* gameDeck = deck;
+                if (gameDeck && p->getHand()) {
+                    Card* c = gameDeck->draw();
+                    if (c) p->getHand()->addCardToHand(c);
+                }
+            }
+        }
+
+        //---------------------------- Eliminate Players ----------------------------
+        for (auto it = players.begin(); it != players.end();) {
+            Player* p = *it;
+
+            if (p == nullptr || p == neutral) {
+                it++;
+                continue;
+            }
+
+            int terrCount = static_cast<int>(p->getOwnedTerritories().size());
+            if (terrCount == 0) {
+
+                if (!surpressOutput) {
+                    output << "[" << p->getPlayerName() << "] has been eliminated from the game.\n";
+                }
+
+                queue<Player*> newQueue;
+                long long queuePosition = -1;
+                for (long long position = 0; !playerQueue.empty(); position++) {
+                    Player* front = playerQueue.front();
+                    playerQueue.pop();
+                    if (front != p) newQueue.push(front);
+                    else queuePosition = position;
+                }
+                playerQueue = newQueue;
+
+                StateJournal::record(undoQueueRemoval, this, p, queuePosition);
+                StateJournal::record(undoPlayerErase, this, p, it - players.begin());
+                toDelete.push_back(p);
+                it = players.erase(it);
+                continue;
+            }
+
+            it++;
+        }
+
+        // ---------------------------- Win Condition Check ----------------------------
+        int activePlayers = 0;
+        Player* potentialWinner = nullptr;
+        bool hasWon = false;
+        bool controlsMap = false;
+
+        for (Player* p : players) { 
+            if (p == nullptr || p == neutral) continue;
+
+            int terrCount = static_cast<int>(p->getOwnedTerritories().size()); 
+            if (terrCount > 0) { 
+                activePlayers++;
+                potentialWinner = p;
+            }
+        }
+
+        if (activePlayers == 1 && potentialWinner != nullptr) { 
+            hasWon = true;
+            currentPlayer = potentialWinner;
+        }
+
+        const unordered_map<Continent*, long long>& refTable = gameMap->getContinentLookupTable(); 
+
+        for (Player* p : ordered) {
+            if (p == nullptr) continue;
+            if (find(toDelete.begin(), toDelete.end(), p) != toDelete.end()) continue;
+
+            if (p->controlsMap(refTable)) {
+                currentPlayer = p;
+                controlsMap = true;
+                break;
+            }
+        }
+
+        //---------------------------- Deferred Cleanup ----------------------------
+        for (Player* dead : toDelete) {
+            if (dead != nullptr) {
+                //rollback() may still bring the player back
+                if (journal.getDepth() > 0) {
+                    eliminatedPlayers.push_back(dead);
+                    continue;
+                }
+                if (!surpressOutput) {
+                    output << "[ExecuteOrders] Deleting player object for " << dead->getPlayerName() << "\n";
+                }
+                delete dead;
+            }
+        }
+        toDelete.clear();
+
+        if (recorder.isOpen() && gameMap != nullptr) {
+            recordedBoardHash = boardHash();
+            recorder.writeBoardHash(recordedBoardHash);
+        }
+
+        setTurn(getTurn() + 1); // increment turn
+
+        bool stalemate = !hasWon && trackProgress();
+
+        //---------------------------- Phase Transition (append messages) ----------------------------
+        if (getTurn() > maxTurns) {
+            state = EngineState::Win; // force game termination
+
+            if (!surpressOutput) {
+                output << "\n=== GAME ENDED: MAXIMUM TURN LIMIT REACHED ===\n"
+                    << "[ExecuteOrder] The maximum number of turns (" << maxTurns << ") has been reached.\n"
+                    << "[ExecuteOrder] No further rounds will be played. Game over.\n";
+            }
+            return;
+        } 
+        else if (hasWon && controlsMap) {
+            state = EngineState::Win;
+
+            if (!surpressOutput) {
+                output << "\n=== WINNER DETECTED ===\n"
+                    << currentPlayer->getPlayerName()
+                    << " has won! They control all continents on the map!\n"
+                    << "[ExecuteOrder] Win condition triggered.";
+            }
+            return;
+        } 
+        else if (hasWon) {
+            state = EngineState::Win;
+
+            if (!surpressOutput) {
+                output << "\n=== WINNER DETECTED ===\n"
+                    << currentPlayer->getPlayerName()
+                    << " has won! They have elimnated all non-neutral enemies!\n"
+                    << "[ExecuteOrder] Win condition triggered.";
+            }
+
+            return;
+        
+        } else if (stalemate) {
+            state = EngineState::Win;
+            stalemateStats.declared = true;
+
+            Player* winner = stalemateRules.resolution == StalemateResolution::Adjudicate ? adjudicateWinner() : nullptr;
+            if (winner != nullptr) {
+                currentPlayer = winner;
+                stalemateStats.adjudicatedWinner = winner->getPlayerName();
+            }
+
+            if (!surpressOutput) {
+                output << "\n=== GAME ENDED: STALEMATE ===\n"
+                    << "[ExecuteOrder] No progress for " << stalemateStats.turnsWithoutProgress << " turns.\n"
+                    << (winner != nullptr
+                        ? "[ExecuteOrder] " + winner->getPlayerName() + " is adjudicated the winner.\n"
+                        : string("[ExecuteOrder] The game is declared a draw.\n"));
+            }
+
+            return;
+
+        } else {
+
+            if (!surpressOutput) {
+                output << "[ExecuteOrder] All orders executed successfully. "
+                    << "Proceeding to next turn’s Reinforcement phase.\n";
+            }
+
+            return;
+        }
+
+    }
+
+    uint64_t GameEngine::boardHash() const {
+
+        uint64_t hash = 0xCBF29CE484222325ull; //FNV-1a offset basis
+        if(gameMap == nullptr) { return hash; }
+
+        auto mix = [&hash](uint64_t value) {
+
+            for(int byte = 0; byte < 8; byte++) {
+
+                hash ^= (value >> (byte * 8)) & 0xFF;
+                hash *= 0x100000001B3ull; //FNV-1a prime
+
+            }
+
+        };
+
+        for(Territory* t : gameMap -> getTerritories()) {
+
+            if(t == nullptr) { continue; }
+
+            Player* owner = t -> getOwner();
+            mix(static_cast<uint64_t>(t -> getIndex()));
+            mix(static_cast<uint64_t>(t -> getNumArmies()));
+            mix(owner != nullptr ? static_cast<uint64_t>(StringHandling::hashStringToNum(owner -> getPlayerName())) : 0);
+
+        }
+
+        return hash;
+
+    }
+
+    void GameEngine::recordTurn(unsigned long long battleSeed) {
+
+        const vector<Territory*>& territories = gameMap -> getTerritories();
+        bool firstTurn = !recordHeaderWritten;
+
+        //Replay ids are player indices, players eliminated before the recording started leave an empty name
+        if(firstTurn) {
+
+            vector<string> names(playerIndexCount);
+            for(Player* p : players) {
+
+                if(p != nullptr && p -> getPlayerIndex() < playerIndexCount) { names[p -> getPlayerIndex()] = p -> getPlayerName(); }
+
+            }
+
+            recorder.writeHeader(rngSeed, mapPath, names);
+            recordHeaderWritten = true;
+
+        }
+
+        auto idOf = [this](Player* p) -> uint16_t {
+
+            if(p == nullptr || p -> getPlayerIndex() >= playerIndexCount) { return REPLAY_NO_PLAYER; }
+            return p -> getPlayerIndex();
+
+        };
+
+        //Orders alone cannot rebuild the board if something else changed it since the last turn (setup, Cheater conquests)
+        if(firstTurn || boardHash() != recordedBoardHash) {
+
+            ReplayBoard board;
+            board.owners.reserve(territories.size());
+            board.armies.reserve(territories.size());
+
+            for(Territory* t : territories) {
+
+                board.owners.push_back(t != nullptr ? idOf(t -> getOwner()) : REPLAY_NO_PLAYER);
+                board.armies.push_back(t != nullptr ? t -> getNumArmies() : 0);
+
+            }
+
+            recorder.writeBoard(board);
+
+        }
+
+        ReplayTurn recorded;
+        recorded.turn = turn;
+        recorded.battleSeed = battleSeed;
+
+        queue<Player*> tempQueue = playerQueue;
+        while(!tempQueue.empty()) {
+
+            Player* p = tempQueue.front();
+            tempQueue.pop();
+
+            recorded.queue.push_back(idOf(p));
+            recorded.orders.emplace_back();
+
+            if(p == nullptr || p -> getPlayerOrders() == nullptr) { continue; }
+
+            vector<ReplayOrder>& orders = recorded.orders.back();
+            for(Order* o : p -> getPlayerOrders() -> getOrders()) {
+
+                if(o == nullptr) { continue; }
+
+                OrderRecord record = o -> toRecord();
+                orders.push_back(ReplayOrder{static_cast<uint8_t>(record.type), idOf(record.issuer), idOf(record.targetPlayer),
+                                             record.source, record.target, record.numArmies});
+
+            }
+
+        }
+
+        recorder.writeTurn(recorded);
+
+    }
+
+    bool GameEngine::startAgain() {
+
+        if(state != EngineState::Win) { //Can only restart after game has been won
+
+            cout << "[Warning] You can only restart the game when someone has won." << endl;
+            return false;
+
+        }
+
+        string response;
+
+        while(true) {
+
+            cout << "\n[WIN] The game has ended. Would you like to start a new game? (yes, y / no, n): ";
+            cin.ignore(numeric_limits<streamsize>::max(), '\n');
+            getline(std::cin, response);
+
+            // Trim whitespace and convert to lowercase
+            response.erase(remove_if(response.begin(), response.end(), ::isspace), response.end());
+            transform(response.begin(), response.end(), response.begin(), ::tolower);
+
+            clearGame(); //Clear all game data, since no matter the response, it must be reset
+
+            if(response == "yes" || response == "y") {
+
+                state = EngineState::Start;
+                cout << "\n[GameEngine] The game has been reset. You may now load a new map and begin again.\n";
+                return true;
+
+            } else if(response == "no" || response == "n") {
+              
+                state = EngineState::End;
+                cout << "\n[GameEngine] Exiting the game. See you next time!\n";
+                return false;
+            
+            } else { cout << "\n[GameEngine] Invalid input. Please type 'yes' or 'no'."; }
+
+        }
+
+    }
+
+    pair<int, string> GameEngine::computeReinforcementFor(Player* p, bool surpressOutput) const {
+        
+        // ---------------- Safety Checks ---------------- //
+        if(p == nullptr || gameMap == nullptr) { 
+            
+            return {0, "[Reinforcement] Error: Invalid player or map pointer."}; 
+        
+        }
+
+        // ---------------- Base Calculation ---------------- //
+        int ownedTerrs = static_cast<int>(p -> getOwnedTerritories().size());
+        int baseArmies = max(3, static_cast<int>(ownedTerrs / 3));
+        int bonusArmies = 0;
+        int reinforcementPool = p -> getReinforcementPool();
+
+        const unordered_map<Continent*, long long>& continentLookupTable = gameMap -> getContinentLookupTable();
+
+        ostringstream desc;
+        if(!surpressOutput) {
+
+            desc << "[Reinforcement] Calculating reinforcement for player: " 
+                 << p -> getPlayerName() << "\n"
+                 << "[Reinforcement] Base armies from territories (" 
+                 << ownedTerrs << " owned): " << baseArmies << "\n";
+
+        }
+
+        // ---------------- Continent Bonus Calculation ---------------- //
+        for(Continent* c : gameMap -> getContinents()) {
+
+            if(c == nullptr){ continue; } //Skip null pointers
+
+            //If player controls entire continent, apply bonus
+            if(p -> controlsContinent(continentLookupTable, c)) {
+
+                bonusArmies += c -> getBonusValue();
+
+                if(!surpressOutput){
+
+                    desc << "[Reinforcement] " << p -> getPlayerName()
+                        << " receives +" << c -> getBonusValue()
+                        << " bonus armies for controlling the continent: " 
+                        << c -> getID() << "\n";
+
+                }
+            }
+        }
+
+        // ---------------- Final Computation ---------------- //
+        int totalArmies = baseArmies + bonusArmies + reinforcementPool;
+
+        if(!surpressOutput){
+
+            desc << "[Reinforcement] Final reinforcement pool contribution: " 
+                << reinforcementPool << "\n"
+                << "[Reinforcement] Total armies calculated for deployment: " 
+                << totalArmies << "\n";
+
+        }
+
+        return { totalArmies, desc.str() };
+    
+    }
+
+    void GameEngine::computeReinforcements(vector<int>& reinforcements) const {
+
+        const size_t numPlayers = playerIndexCount;
+        reinforcements.assign(numPlayers, 0);
+        if(gameMap == nullptr) { return; }
+
+        const vector<Territory*>& territories = gameMap -> getTerritories();
+        const uint16_t unowned = playerIndexCount; //Unowned territories, or owners without an index
+
+        //Owner of each territory as a player index
+        vector<uint16_t> ownerOf(territories.size(), unowned);
+        for(size_t i = 0; i < territories.size(); i++) {
+
+            Player* owner = territories[i] != nullptr ? territories[i] -> getOwner() : nullptr;
+            if(owner != nullptr && owner -> getPlayerIndex() < playerIndexCount) { ownerOf[i] = owner -> getPlayerIndex(); }
+
+        }
+
+        //Territories owned per player index, the last slot collects unowned territories
+        vector<int> ownedCount(numPlayers + 1, 0);
+        for(uint16_t owner : ownerOf) { ownedCount[owner]++; }
+
+        //A continent pays its bonus to the player owning all of its territories
+        vector<int> bonusArmies(numPlayers + 1, 0);
+        int sharedBonus = 0;
+
+        for(Continent* c : gameMap -> getContinents()) {
+
+            if(c == nullptr) { continue; }
+
+            uint16_t soleOwner = unowned;
+            bool first = true;
+            bool mixed = false;
+
+            for(Territory* t : c -> getTerritories()) {
+
+                if(t == nullptr || t -> getIndex() < 0 || static_cast<size_t>(t -> getIndex()) >= ownerOf.size()) { continue; }
+
+                uint16_t owner = ownerOf[t -> getIndex()];
+                if(first) { soleOwner = owner; first = false; }
+                else if(owner != soleOwner) { mixed = true; break; }
+
+            }
+
+            if(first) { sharedBonus += c -> getBonusValue(); } //No territories: the continent sums of every player match
+            else if(!mixed) { bonusArmies[soleOwner] += c -> getBonusValue(); }
+
+        }
+
+        for(Player* p : players) {
+
+            if(p == nullptr || p == neutral || p -> getPlayerIndex() >= playerIndexCount) { continue; }
+
+            uint16_t index = p -> getPlayerIndex();
+            int baseArmies = max(3, ownedCount[index] / 3);
+            reinforcements[index] = baseArmies + bonusArmies[index] + sharedBonus + p -> getReinforcementPool();
+
+        }
+
+    }
+
+    Player* GameEngine::findPlayerByName(const string& name) const {
+        
         for (Player* p : players) {
             
             if(p != nullptr && p -> getPlayerName() == name){ return p; }
 
         }
 
-        return nullptr;
-    
+        return nullptr;
+    
+    }
+
+    void GameEngine::assignPlayerIndices() {
+
+        neutral = nullptr;
+        playerIndexCount = static_cast<uint16_t>(players.size());
+
+        for(size_t i = 0; i < players.size(); i++) {
+
+            Player* p = players[i];
+            if(p == nullptr) { continue; }
+
+            p -> setPlayerIndex(static_cast<uint16_t>(i));
+
+            //One name check per player at setup, the hot paths compare against neutral instead
+            if(p -> isNeutral() || p -> getPlayerName() == "Neutral") {
+
+                p -> setRole(PlayerRole::Neutral);
+                neutral = p;
+
+            }
+
+        }
+
+    }
+
+    /*-------------------------------------------Game Commands---------------------------------------------------*/
+
+    string GameEngine::engineLoadMap(const string& path, bool surpressOutput){
+
+        string result;
+
+        if(!isCurrentStateCorrect(EngineState::Start, "loadmap")){
+            result = "[LoadMap] Error: Current state is not loadmap!";
+            logAndNotify(result);
+            return result;
+        }
+
+        clearGame(); //Reset current game data before loading new map
+
+        auto mapLoaded = [this, &path, &result, surpressOutput](uint64_t contentHash) {
+
+            state = EngineState::MapLoaded;
+            mapPath = path;
+            mapHash = contentHash; //Identifies the map contents for checkpoints
+            result = surpressOutput
+                ? "[LoadMap] Map loaded successfully, and is ready for validation."
+                : "[LoadMap] Map '" + gameMap -> getMapName() + "' successfully loaded from path '" + path + "' and is ready for validation.";
+
+            logAndNotify(result);
+            return result;
+
+        };
+
+        //A map any engine of the process already loaded is copied from the registry, sharing its topology and routing table
+        MapRegistry& registry = MapRegistry::getInstance();
+        uint64_t contentHash = 0;
+
+        if(MapRegistry::hashFile(path, contentHash)) {
+
+            gameMap = registry.acquire(path, contentHash);
+            if(gameMap != nullptr) { return mapLoaded(contentHash); }
+
+        }
+
+        MapLoader loader;
+        int loaderReturnCode = loader.importMapInfo(path);
+
+        string mapName = "Unknown Map";
+        if(loaderReturnCode != MAP_FILE_NOT_FOUND){
+            mapName = loader.getMapName();
+        }
+
+        // --- Handle Import Errors ---
+        if(loaderReturnCode != MAP_OK){
+
+            switch(loaderReturnCode){
+
+                case MAP_FILE_NOT_FOUND:
+                    result = surpressOutput
+                        ? "[LoadMap] Import failed: File not found."
+                        : "[LoadMap] Import failed: File not found at path '" + path + "' for map '" + mapName + "'.";
+                    break;
+
+                case MAP_INVALID_SECTION:
+                    result = surpressOutput
+                        ? "[LoadMap] Import failed: Invalid or missing section headers."
+                        : "[LoadMap] Import failed: Invalid or missing section headers in map file '" + path + "' (" + mapName + ").";
+                    break;
+
+                case MAP_PARSE_ERROR:
+                    result = surpressOutput
+                        ? "[LoadMap] Import failed: Syntax or formatting error while parsing."
+                        : "[LoadMap] Import failed: Syntax or formatting error while parsing map file '" + path + "' (" + mapName + ").";
+                    break;
+
+                default:
+                    result = surpressOutput
+                        ? "[LoadMap] Import failed: Unknown error while importing."
+                        : "[LoadMap] Import failed: Unknown error while importing map file '" + path + "' (" + mapName + ").";
+                    break;
+            }
+
+            logAndNotify(result);
+            return result;
+        }
+
+        pair<int, Map*> loadResults = loader.loadMap();
+        int loaderCode = loadResults.first;
+        gameMap = loadResults.second;
+
+        // --- Handle Build/Validation Errors ---
+        if(loaderCode != MAP_OK || gameMap == nullptr){
+            state = EngineState::Start;
+
+            switch(loaderCode){
+                case INVALID_MAP_PTR:
+                    result = surpressOutput
+                        ? "[LoadMap] Load failed: Map pointer returned null."
+                        : "[LoadMap] Load failed: Map pointer returned null for map '" + mapName + "' (" + path + ").";
+                    break;
+
+                case INVALID_AUTHOR:
+                    result = surpressOutput
+                        ? "[LoadMap] Load failed: Missing or invalid author field."
+                        : "[LoadMap] Load failed: Missing or invalid author field in map '" + mapName + "' (" + path + ").";
+                    break;
+
+                case INVALID_IMAGE:
+                    result = surpressOutput
+                        ? "[LoadMap] Load failed: Invalid image reference."
+                        : "[LoadMap] Load failed: Map image reference invalid or missing in '" + mapName + "' (" + path + ").";
+                    break;
+
+                case INVALID_WRAP:
+                    result = surpressOutput
+                        ? "[LoadMap] Load failed: Invalid wrapping metadata."
+                        : "[LoadMap] Load failed: Invalid wrapping information in '" + mapName + "' (" + path + ").";
+                    break;
+
+                case INVALID_SCROLL:
+                    result = surpressOutput
+                        ? "[LoadMap] Load failed: Invalid scroll field."
+                        : "[LoadMap] Load failed: Scroll behavior field invalid or missing in '" + mapName + "' (" + path + ").";
+                    break;
+
+                case INVALID_WARN:
+                    result = surpressOutput
+                        ? "[LoadMap] Load failed: Warning detected during parsing."
+                        : "[LoadMap] Load failed: Warning detected during parsing of map '" + mapName + "' (" + path + ").";
+                    break;
+
+                case INVALID_CONTINENT:
+                    result = surpressOutput
+                        ? "[LoadMap] Load failed: Invalid or disconnected continent definition."
+                        : "[LoadMap] Load failed: One or more continents are disconnected or improperly defined in '" + mapName + "' (" + path + ").";
+                    break;
+
+                case INVALID_TERRITORY:
+                    result = surpressOutput
+                        ? "[LoadMap] Load failed: Invalid territory definition."
+                        : "[LoadMap] Load failed: One or more territories are missing, duplicated, or mislinked in '" + mapName + "' (" + path + ").";
+                    break;
+
+                case INVALID_MAP_STRUCTURE:
+                    result = surpressOutput
+                        ? "[LoadMap] Load failed: Invalid map structure."
+                        : "[LoadMap] Load failed: Map graph is not connected or violates structure rules in '" + mapName + "' (" + path + ").";
+                    break;
+
+                default:
+                    result = surpressOutput
+                        ? "[LoadMap] Load failed: Unknown structural error."
+                        : "[LoadMap] Load failed: Unknown structural error while loading map '" + mapName + "' (" + path + ").";
+                    break;
+            }
+
+            logAndNotify(result);
+            return result;
+        }
+
+        // --- Successful Load ---
+        registry.add(path, loader.getSourceHash(), *gameMap);
+        return mapLoaded(loader.getSourceHash());
+    
+    }
+
+    string GameEngine::engineValidateMap(bool surpressOutput){
+
+        string result;
+
+        if(!isCurrentStateCorrect(EngineState::MapLoaded, "validatemap")){
+            result = "[ValidateMap] Error: Current state is not validatemap!";
+            logAndNotify(result);
+            return result;
+        }
+
+        // Validate Map
+        if(gameMap == nullptr){
+            state = EngineState::Start;
+            result = "[ValidateMap] No map to validate.";
+            logAndNotify(result);
+            return result;
+        }
+
+        if(!(gameMap->validate())){
+            state = EngineState::Start;
+            result = "[ValidateMap] Invalid map.";
+            logAndNotify(result);
+            return result;
+        }
+
+        state = EngineState::MapValidated;
+        result = surpressOutput
+            ? "[ValidateMap] Map validated successfully."
+            : "[ValidateMap] Map has been successfully validated.";
+
+        logAndNotify(result);
+        return result;
     }
 
-    /*-------------------------------------------Game Commands---------------------------------------------------*/
+    string GameEngine::engineAddPlayer(const string& name, bool surpressOutput){
 
-    string GameEngine::engineLoadMap(const string& path, bool surpressOutput){
+        string result;
+
+        if(state != EngineState::MapValidated && state != EngineState::PlayersAdded){
+            result = "[AddPlayer] Error: Not in a state to add players!";
+            logAndNotify(result);
+            return result;
+        }
+
+        if(name.empty()){
+            result = "[AddPlayer] Error: Player name cannot be empty!";
+            logAndNotify(result);
+            return result;
+        }
+
+        // Check if player with that name already exists
+        if(findPlayerByName(name) != nullptr){
+            result = "[AddPlayer] Error: Player with that name already exists!";
+            logAndNotify(result);
+            return result;
+        }
+
+        // Check if too many players have been added to the game
+        if(playerQueue.size() >= gameMap->getTerritories().size()){
+            result = "[AddPlayer] Error: Too many players have been added! " + name + " has NOT been added!";
+            logAndNotify(result);
+            return result;
+        }
+
+        addPlayerToQueue(name);
+        state = EngineState::PlayersAdded;
+
+        result = surpressOutput
+            ? "[AddPlayer] Player added successfully: " + name
+            : "[AddPlayer] Player: " + name + " has been added.";
+
+        logAndNotify(result);
+        return result;
+    
+    }
+
+    string GameEngine::engineGameStart(bool suppressOutput){
 
         string result;
 
-        if(!isCurrentStateCorrect(EngineState::Start, "loadmap")){
-            result = "[LoadMap] Error: Current state is not loadmap!";
+        if(!isCurrentStateCorrect(EngineState::PlayersAdded, "gamestart")){
+            result = "[GameStart] Error: Current state is not gamestart!";
             logAndNotify(result);
             return result;
         }
 
-        clearGame(); //Reset current game data before loading new map
+        if(playerQueue.size() < 2){
+            result = "[GameStart] Error: At least 2 players are required to play.";
+            logAndNotify(result);
+            return result;
+        }
 
-        MapLoader loader;
-        int loaderReturnCode = loader.importMapInfo(path);
+        if(gameMap == nullptr){
+            result = "[GameStart] Error: No map object was provided.";
+            logAndNotify(result);
+            return result;
+        }
 
-        string mapName = "Unknown Map";
-        if(loaderReturnCode != MAP_FILE_NOT_FOUND){
-            mapName = loader.getMapName();
+        ostringstream output;
+
+        //----- Shuffle Players -----
+        string shuffleResult = shufflePlayers(suppressOutput);
+        if(!suppressOutput){ output << shuffleResult; }
+
+        //Always set the game to have a neutral player to handle order logic
+        Player* neutralPlayer = new Player("Neutral", gameMap->buildEmptyContinentHashmap());
+        neutralPlayer->setRole(PlayerRole::Neutral);
+        players.push_back(neutralPlayer);
+        assignPlayerIndices();
+        if(!suppressOutput){ output << "[GameStart] Added neutral player.\n"; }
+
+        //----- Randomly Assign Territories -----
+        string assignResult = assignTerritories(suppressOutput);
+        if(!suppressOutput){ output << assignResult; }
+
+        //----- Instantiate deck with an appropriate number of cards -----
+        if(deck == nullptr){ deck = new Deck(static_cast<int>(players.size())); }
+        else{ deck->setNumOfPlayers(static_cast<int>(players.size())); }
+
+        //----- Reinforcement and Initial Cards -----
+        for(Player* p : players){
+
+            if(p == neutral){ continue; }
+
+            p->setReinforcementPool(50);
+            if(!suppressOutput){ output << p->getPlayerName() << " had 50 armies added to their reinforcement pool.\n"; }
+
+            if(deck != nullptr && p->getHand() != nullptr){
+
+                Card* c1 = deck->draw();
+                Card* c2 = deck->draw();
+
+                if(c1 != nullptr){ p->getHand()->addCardToHand(c1); }
+                if(c2 != nullptr){ p->getHand()->addCardToHand(c2); }
+
+                if(!suppressOutput){
+                    output << p->getPlayerName()
+                        << " had the following cards added to their hand: "
+                        << c1->getTypeString() << ", "
+                        << c2->getTypeString() << "\n";
+                }
+            }
         }
 
-        // --- Handle Import Errors ---
-        if(loaderReturnCode != MAP_OK){
+        resetStalemateTracking();
+        state = EngineState::AssignReinforcement;
 
-            switch(loaderReturnCode){
+        if(!suppressOutput){ output << "\n[GameEngine] Game setup complete, moving to reinforcement phase.\n"; }
 
-                case MAP_FILE_NOT_FOUND:
-                    result = surpressOutput
-                        ? "[LoadMap] Import failed: File not found."
-                        : "[LoadMap] Import failed: File not found at path '" + path + "' for map '" + mapName + "'.";
-                    break;
+        result = suppressOutput
+            ? "[GameEngine] Game setup complete, moving to reinforcement phase."
+            : output.str();
 
-                case MAP_INVALID_SECTION:
-                    result = surpressOutput
-                        ? "[LoadMap] Import failed: Invalid or missing section headers."
-                        : "[LoadMap] Import failed: Invalid or missing section headers in map file '" + path + "' (" + mapName + ").";
-                    break;
+        logAndNotify(result);
+        return result;
+    }
 
-                case MAP_PARSE_ERROR:
-                    result = surpressOutput
-                        ? "[LoadMap] Import failed: Syntax or formatting error while parsing."
-                        : "[LoadMap] Import failed: Syntax or formatting error while parsing map file '" + path + "' (" + mapName + ").";
-                    break;
+    string GameEngine::reinforcementPhase(bool surpressOutputs){
 
-                default:
-                    result = surpressOutput
-                        ? "[LoadMap] Import failed: Unknown error while importing."
-                        : "[LoadMap] Import failed: Unknown error while importing map file '" + path + "' (" + mapName + ").";
-                    break;
+        StateJournal::Scope recording(recordingJournal());
+
+        string result;
+        ostringstream output;
+
+        //Validate current state and prerequisites
+        if(!isCurrentStateCorrect(EngineState::AssignReinforcement, "assignreinforcement")){
+            result = "[AssignReinforcement] Error: Current state is not assignreinforcement!";
+            logAndNotify(result);
+            return result;
+        }
+
+        if(!gameMap){
+            result = "[AssignReinforcement] Error: No map object was provided.";
+            logAndNotify(result);
+            return result;
+        }
+
+        if(!surpressOutputs){
+            output << "\n[AssignReinforcement] === Assigning Reinforcements to Players ===\n\n";
+        }
+
+        //Silent runs compute every player at once, the per-player version also describes its computation
+        vector<int> reinforcements;
+        if(surpressOutputs){ computeReinforcements(reinforcements); }
+
+        //Assign reinforcement pools to each active player
+        for(Player* p : players){
+
+            if(p == nullptr || p == neutral){ continue; }
+
+            int numArmiesToAdd = 0;
+            if(surpressOutputs && p->getPlayerIndex() < reinforcements.size()){
+                numArmiesToAdd = reinforcements[p->getPlayerIndex()];
+            }
+            else{
+                pair<int, string> reinforcementInfo = computeReinforcementFor(p, surpressOutputs);
+                if(!surpressOutputs){ output << reinforcementInfo.second; }
+                numArmiesToAdd = reinforcementInfo.first;
+            }
+
+            if(numArmiesToAdd <= 0){
+                if(!surpressOutputs){
+                    output << "[AssignReinforcement] " << p->getPlayerName()
+                        << " receives 0 armies (no territories controlled).\n";
+                }
+                continue;
+            }
+
+            int previousPool = p->getReinforcementPool();
+            p->setReinforcementPool(previousPool + numArmiesToAdd);
+
+            if(!surpressOutputs){
+                output << "[AssignReinforcement] " << p->getPlayerName()
+                    << " receives " << numArmiesToAdd
+                    << " new armies (Pool: " << p->getReinforcementPool() << ").\n\n";
             }
+        }
+
+        if(!surpressOutputs){
+            output << "[AssignReinforcement] === All Reinforcements Assigned ===\n\n";
+        }
+
+        state = EngineState::IssueOrders;
+        nextStep = TurnStep::IssueOrders;
+
+        result = surpressOutputs
+            ? "[AssignReinforcement] Reinforcement phase executed successfully."
+            : output.str();
+
+        logAndNotify(result);
+        return result;
+    }
+
+    string GameEngine::engineIssueOrder(bool surpressOutput){
+
+        string result;
 
+        if(!isCurrentStateCorrect(EngineState::IssueOrders, "issueorder")){
+            result = "[IssueOrder] Error: Current state is not issueorder!";
             logAndNotify(result);
             return result;
         }
 
-        pair<int, Map*> loadResults = loader.loadMap();
-        int loaderCode = loadResults.first;
-        gameMap = loadResults.second;
+        ostringstream output;
 
-        // --- Handle Build/Validation Errors ---
-        if(loaderCode != MAP_OK || gameMap == nullptr){
-            state = EngineState::Start;
+        if(!surpressOutput){
+            output << "\n[IssueOrder] === Issuing Orders for Each Player ===\n\n";
+        }
 
-            switch(loaderCode){
-                case INVALID_MAP_PTR:
-                    result = surpressOutput
-                        ? "[LoadMap] Load failed: Map pointer returned null."
-                        : "[LoadMap] Load failed: Map pointer returned null for map '" + mapName + "' (" + path + ").";
-                    break;
+        issueOrdersPhase(surpressOutput, output);
+        nextStep = TurnStep::EndIssueOrders;
 
-                case INVALID_AUTHOR:
-                    result = surpressOutput
-                        ? "[LoadMap] Load failed: Missing or invalid author field."
-                        : "[LoadMap] Load failed: Missing or invalid author field in map '" + mapName + "' (" + path + ").";
-                    break;
+        if(!surpressOutput){
+            output << "[IssueOrder] === All Orders Successfully Issued ===\n";
+        }
 
-                case INVALID_IMAGE:
-                    result = surpressOutput
-                        ? "[LoadMap] Load failed: Invalid image reference."
-                        : "[LoadMap] Load failed: Map image reference invalid or missing in '" + mapName + "' (" + path + ").";
-                    break;
+        result = surpressOutput
+            ? "[IssueOrder] Orders issued successfully."
+            : output.str();
+
+        logAndNotify(result);
+        return result;
+    }
 
-                case INVALID_WRAP:
-                    result = surpressOutput
-                        ? "[LoadMap] Load failed: Invalid wrapping metadata."
-                        : "[LoadMap] Load failed: Invalid wrapping information in '" + mapName + "' (" + path + ").";
-                    break;
+    string GameEngine::engineEndIssueOrder(bool surpressOutput){
 
-                case INVALID_SCROLL:
-                    result = surpressOutput
-                        ? "[LoadMap] Load failed: Invalid scroll field."
-                        : "[LoadMap] Load failed: Scroll behavior field invalid or missing in '" + mapName + "' (" + path + ").";
-                    break;
+        string result;
 
-                case INVALID_WARN:
-                    result = surpressOutput
-                        ? "[LoadMap] Load failed: Warning detected during parsing."
-                        : "[LoadMap] Load failed: Warning detected during parsing of map '" + mapName + "' (" + path + ").";
-                    break;
+        //Validate current state before proceeding
+        if(!isCurrentStateCorrect(EngineState::IssueOrders, "endissueorders")){
+            result = "[EndIssueOrders] Error: Current state is not IssueOrders.";
+            logAndNotify(result);
+            return result;
+        }
 
-                case INVALID_CONTINENT:
-                    result = surpressOutput
-                        ? "[LoadMap] Load failed: Invalid or disconnected continent definition."
-                        : "[LoadMap] Load failed: One or more continents are disconnected or improperly defined in '" + mapName + "' (" + path + ").";
-                    break;
+        //Transition to next phase
+        state = EngineState::ExecuteOrders;
+        nextStep = TurnStep::ExecuteOrders;
 
-                case INVALID_TERRITORY:
-                    result = surpressOutput
-                        ? "[LoadMap] Load failed: Invalid territory definition."
-                        : "[LoadMap] Load failed: One or more territories are missing, duplicated, or mislinked in '" + mapName + "' (" + path + ").";
-                    break;
+        ostringstream output;
 
-                case INVALID_MAP_STRUCTURE:
-                    result = surpressOutput
-                        ? "[LoadMap] Load failed: Invalid map structure."
-                        : "[LoadMap] Load failed: Map graph is not connected or violates structure rules in '" + mapName + "' (" + path + ").";
-                    break;
+        if(!surpressOutput){
+            output << "[EndIssueOrders] All players: ";
 
-                default:
-                    result = surpressOutput
-                        ? "[LoadMap] Load failed: Unknown structural error."
-                        : "[LoadMap] Load failed: Unknown structural error while loading map '" + mapName + "' (" + path + ").";
-                    break;
+            for(size_t i = 0; i < players.size(); ++i){
+
+                if(players[i] != nullptr){
+                    output << players[i]->getPlayerName();
+                    if(i < players.size() - 1){ output << ", "; }
+                }
             }
 
-            logAndNotify(result);
-            return result;
+            output << " have finished issuing orders.\n";
         }
 
-        // --- Successful Load ---
-        state = EngineState::MapLoaded;
+        output << "[EndIssueOrders] Transitioning from IssueOrders phase to ExecuteOrders phase.";
+
         result = surpressOutput
-            ? "[LoadMap] Map loaded successfully, and is ready for validation."
-            : "[LoadMap] Map '" + mapName + "' successfully loaded from path '" + path + "' and is ready for validation.";
+            ? "[EndIssueOrders] Transitioned to ExecuteOrders phase."
+            : output.str();
 
         logAndNotify(result);
         return result;
-    
     }
 
-    string GameEngine::engineValidateMap(bool surpressOutput){
+    string GameEngine::engineExecuteOrder(bool surpressOutput){
 
         string result;
 
-        if(!isCurrentStateCorrect(EngineState::MapLoaded, "validatemap")){
-            result = "[ValidateMap] Error: Current state is not validatemap!";
+        //Validate current state
+        if(!isCurrentStateCorrect(EngineState::ExecuteOrders, "executeorder")){
+            result = "[ExecuteOrder] Error: Current state is not executeorder!";
             logAndNotify(result);
             return result;
         }
 
-        // Validate Map
-        if(gameMap == nullptr){
-            state = EngineState::Start;
-            result = "[ValidateMap] No map to validate.";
-            logAndNotify(result);
-            return result;
+        ostringstream output;
+
+        if(!surpressOutput){
+            output << "\n[ExecuteOrder] === Executing Orders for Each Player ===\n";
         }
 
-        if(!(gameMap->validate())){
-            state = EngineState::Start;
-            result = "[ValidateMap] Invalid map.";
+        //Delegate the heavy lifting
+        executeOrdersPhase(surpressOutput, output);
+        nextStep = TurnStep::EndExecuteOrders;
+
+        //Build result message based on state
+        if(state == EngineState::Win){
+            result = "[ExecuteOrder] Win condition triggered or maximum turns reached.";
+        }
+        else{
+            result = surpressOutput
+                ? "[ExecuteOrder] Orders executed successfully."
+                : output.str();
+        }
+
+        logAndNotify(result);
+        return result;
+    }
+
+    string GameEngine::engineEndExecuteOrder(bool surpressOutput){
+
+        string result;
+
+        if(!isCurrentStateCorrect(EngineState::ExecuteOrders, "endexecuteorder")){
+            result = "[EndExecuteOrder] Error: Current state is not endexecuteorder!";
             logAndNotify(result);
             return result;
         }
 
-        state = EngineState::MapValidated;
+        state = EngineState::AssignReinforcement;
+        nextStep = TurnStep::Reinforcement;
+
         result = surpressOutput
-            ? "[ValidateMap] Map validated successfully."
-            : "[ValidateMap] Map has been successfully validated.";
+            ? "[EndExecuteOrder] End of Turn: " + to_string(turn) + "\n[EndExecuteOrder] Returning to [AssignReinforcement]"
+            : "[EndExecuteOrder] Returning to [AssignReinforcement]";
 
         logAndNotify(result);
         return result;
+
     }
 
-    string GameEngine::engineAddPlayer(const string& name, bool surpressOutput){
+    string GameEngine::engineWin(){
 
         string result;
 
-        if(state != EngineState::MapValidated && state != EngineState::PlayersAdded){
-            result = "[AddPlayer] Error: Not in a state to add players!";
+        if(!isCurrentStateCorrect(EngineState::Win, "win")){
+            result = "[WIN] Error: Current state is not win!";
             logAndNotify(result);
             return result;
         }
 
-        if(name.empty()){
-            result = "[AddPlayer] Error: Player name cannot be empty!";
-            logAndNotify(result);
-            return result;
-        }
+        ostringstream output;
 
-        // Check if player with that name already exists
-        if(findPlayerByName(name) != nullptr){
-            result = "[AddPlayer] Error: Player with that name already exists!";
+        bool startNewGame = startAgain();
+
+        if(startNewGame){
+            
+            state = EngineState::Start;
+            output << "[GameEngine] Starting new game.";
+            result = output.str();
             logAndNotify(result);
             return result;
-        }
+        
+        } else {
 
-        // Check if too many players have been added to the game
-        if(playerQueue.size() >= gameMap->getTerritories().size()){
-            result = "[AddPlayer] Error: Too many players have been added! " + name + " has NOT been added!";
+            state = EngineState::End;
+            output << "[GameEngine] Terminating game.";
+            result = output.str();
             logAndNotify(result);
             return result;
+        
         }
 
-        addPlayerToQueue(name);
-        state = EngineState::PlayersAdded;
+    }
 
-        result = surpressOutput
-            ? "[AddPlayer] Player added successfully: " + name
-            : "[AddPlayer] Player: " + name + " has been added.";
+    string GameEngine::engineEnd(){
+
+        string result;
 
+        state = EngineState::End;
+        result = "[End] The program has now terminated. Thank you for playing!";
         logAndNotify(result);
         return result;
-    
     }
 
-    string GameEngine::engineGameStart(bool suppressOutput){
+    string GameEngine::replayGame(const string& path, bool surpressOutput) {
 
         string result;
 
-        if(!isCurrentStateCorrect(EngineState::PlayersAdded, "gamestart")){
-            result = "[GameStart] Error: Current state is not gamestart!";
+        if(!isCurrentStateCorrect(EngineState::Start, "replay")){
+            result = "[Replay] Error: Current state is not start!";
             logAndNotify(result);
             return result;
         }
 
-        if(playerQueue.size() < 2){
-            result = "[GameStart] Error: At least 2 players are required to play.";
+        ReplayReader reader;
+        uint32_t recordedSeed = 0;
+        string recordedMap;
+        vector<string> names;
+
+        if(!reader.open(path) || !reader.readHeader(recordedSeed, recordedMap, names)){
+            result = "[Replay] Error: '" + path + "' is not a readable replay file.";
             logAndNotify(result);
             return result;
         }
 
-        if(gameMap == nullptr){
-            result = "[GameStart] Error: No map object was provided.";
+        //----- Rebuild the recorded setup: map, then players by replay id -----
+        engineLoadMap(recordedMap, true);
+        if(state == EngineState::MapLoaded){ engineValidateMap(true); }
+
+        if(state != EngineState::MapValidated){
+            state = EngineState::Start;
+            result = "[Replay] Error: Recorded map '" + recordedMap + "' could not be loaded.";
             logAndNotify(result);
             return result;
         }
 
+        rngSeed = recordedSeed;
+
+        vector<Player*> byId; //Replay id -> live player, nullptr once eliminated
+        for(const string& name : names){
+
+            if(name.empty()){ byId.push_back(nullptr); continue; } //Eliminated before the recording started
+
+            Player* p = new Player(name, gameMap -> buildEmptyContinentHashmap());
+            players.push_back(p);
+            byId.push_back(p);
+
+        }
+
+        assignPlayerIndices();
+
+        auto playerOf = [&byId](uint16_t id) -> Player* { return id < byId.size() ? byId[id] : nullptr; };
+
+        const vector<Territory*>& territories = gameMap -> getTerritories();
+        state = EngineState::ExecuteOrders;
+
         ostringstream output;
+        int turnsReplayed = 0;
+        int divergedAt = -1;
+        bool truncated = false;
 
-        //----- Shuffle Players -----
-        string shuffleResult = shufflePlayers(suppressOutput);
-        if(!suppressOutput){ output << shuffleResult; }
+        for(char chunk = reader.nextChunk(); chunk != 0; chunk = reader.nextChunk()){
 
-        //Always set the game to have a neutral player to handle order logic
-        Player* neutral = new Player("Neutral", gameMap->buildEmptyContinentHashmap());
-        players.push_back(neutral);
-        if(!suppressOutput){ output << "[GameStart] Added neutral player.\n"; }
+            if(chunk == REPLAY_CHUNK_BOARD){
 
-        //----- Randomly Assign Territories -----
-        string assignResult = assignTerritories(suppressOutput);
-        if(!suppressOutput){ output << assignResult; }
+                ReplayBoard board;
+                if(!reader.readBoard(board) || board.owners.size() != territories.size()){ truncated = true; break; }
 
-        //----- Instantiate deck with an appropriate number of cards -----
-        if(deck == nullptr){ deck = new Deck(static_cast<int>(players.size())); }
-        else{ deck->setNumOfPlayers(static_cast<int>(players.size())); }
+                for(size_t i = 0; i < territories.size(); i++){
 
-        //----- Reinforcement and Initial Cards -----
-        for(Player* p : players){
+                    Territory* t = territories[i];
+                    if(t == nullptr){ continue; }
 
-            if(p->getPlayerName() == "Neutral"){ continue; }
+                    Player* owner = playerOf(board.owners[i]);
+                    if(owner != nullptr){ owner -> addOwnedTerritories(t); } //Moves it away from the previous owner
+                    else if(t -> getOwner() != nullptr){ t -> getOwner() -> removeOwnedTerritories(t); }
 
-            p->setReinforcementPool(50);
-            if(!suppressOutput){ output << p->getPlayerName() << " had 50 armies added to their reinforcement pool.\n"; }
+                    t -> setNumArmies(board.armies[i]);
 
-            if(deck != nullptr && p->getHand() != nullptr){
+                }
 
-                Card* c1 = deck->draw();
-                Card* c2 = deck->draw();
+            } else if(chunk == REPLAY_CHUNK_TURN){
 
-                if(c1 != nullptr){ p->getHand()->addCardToHand(c1); }
-                if(c2 != nullptr){ p->getHand()->addCardToHand(c2); }
+                ReplayTurn recorded;
+                if(!reader.readTurn(recorded)){ truncated = true; break; }
+
+                while(!playerQueue.empty()){ playerQueue.pop(); }
+
+                for(size_t k = 0; k < recorded.queue.size(); k++){
+
+                    Player* p = playerOf(recorded.queue[k]);
+                    if(p == nullptr){ continue; }
+
+                    playerQueue.push(p);
+
+                    for(const ReplayOrder& order : recorded.orders[k]){
+
+                        OrderRecord record{playerOf(order.issuer), playerOf(order.targetPlayer), order.source, order.target,
+                                           order.numArmies, static_cast<OrderType>(order.type)};
+
+                        Order* o = WarzoneOrder::makeOrder(record, territories);
+                        if(o != nullptr){ p -> getPlayerOrders() -> addOrder(o); }
+
+                    }
+
+                }
+
+                //Same turn and battle seed as the recorded phase, so every battle rolls the same
+                setTurn(recorded.turn);
+                replayBattleSeed = recorded.battleSeed;
+                executeOrdersPhase(surpressOutput, output);
+                replayBattleSeed = 0;
+                turnsReplayed++;
+
+                //executeOrdersPhase() deleted eliminated players
+                for(Player*& p : byId){
+
+                    if(p != nullptr && find(players.begin(), players.end(), p) == players.end()){ p = nullptr; }
 
-                if(!suppressOutput){
-                    output << p->getPlayerName()
-                        << " had the following cards added to their hand: "
-                        << c1->getTypeString() << ", "
-                        << c2->getTypeString() << "\n";
                 }
+
+            } else if(chunk == REPLAY_CHUNK_HASH){
+
+                uint64_t recordedHash = 0;
+                if(!reader.readBoardHash(recordedHash)){ truncated = true; break; }
+
+                if(divergedAt < 0 && recordedHash != boardHash()){ divergedAt = getTurn() - 1; }
+
+            } else {
+
+                truncated = true;
+                break;
+
             }
-        }
 
-        state = EngineState::AssignReinforcement;
+        }
 
-        if(!suppressOutput){ output << "\n[GameEngine] Game setup complete, moving to reinforcement phase.\n"; }
+        ostringstream summary;
+        if(!surpressOutput){ summary << output.str() << "\n"; }
 
-        result = suppressOutput
-            ? "[GameEngine] Game setup complete, moving to reinforcement phase."
-            : output.str();
+        summary << "[Replay] Replayed " << turnsReplayed << " turn(s) of '" << recordedMap << "'";
+        if(divergedAt >= 0){ summary << ", board diverged from the recording at turn " << divergedAt << "."; }
+        else{ summary << ", board matched the recording after every turn."; }
+        if(truncated){ summary << " The replay file ends with a truncated or unknown chunk."; }
 
+        result = summary.str();
         logAndNotify(result);
         return result;
+
     }
 
-    string GameEngine::reinforcementPhase(bool surpressOutputs){
+    bool GameEngine::saveCheckpoint(const string& path) {
 
-        string result;
-        ostringstream output;
+        if(gameMap == nullptr){ return false; }
 
-        //Validate current state and prerequisites
-        if(!isCurrentStateCorrect(EngineState::AssignReinforcement, "assignreinforcement")){
-            result = "[AssignReinforcement] Error: Current state is not assignreinforcement!";
-            logAndNotify(result);
-            return result;
-        }
+        //Players added before the game started have no index yet
+        for(Player* p : players){
+
+            if(p != nullptr && p -> getPlayerIndex() >= playerIndexCount){ assignPlayerIndices(); break; }
 
-        if(!gameMap){
-            result = "[AssignReinforcement] Error: No map object was provided.";
-            logAndNotify(result);
-            return result;
         }
 
-        if(!surpressOutputs){
-            output << "\n[AssignReinforcement] === Assigning Reinforcements to Players ===\n\n";
+        auto idOf = [this](const Player* p) -> uint16_t {
+
+            if(p == nullptr || p -> getPlayerIndex() >= playerIndexCount){ return CHECKPOINT_NO_PLAYER; }
+            return p -> getPlayerIndex();
+
+        };
+
+        CheckpointData data;
+        CheckpointHeader& h = data.header;
+        h = CheckpointHeader{};
+        h.state = static_cast<uint8_t>(state);
+        h.step = static_cast<uint8_t>(nextStep);
+        h.mapHash = mapHash;
+        h.rngSeed = rngSeed;
+        h.turn = turn;
+        h.maxTurns = maxTurns;
+        h.ordersEliminatedLastTurn = ordersEliminatedLastTurn;
+        h.flags = (parallelIssueOrders ? CHECKPOINT_PARALLEL_ISSUE : 0) |
+                  (compactOrdersEnabled ? CHECKPOINT_COMPACT_ORDERS : 0) |
+                  (parallelExecuteOrders ? CHECKPOINT_PARALLEL_EXECUTE : 0) |
+                  (balancedAssignment ? CHECKPOINT_BALANCED_ASSIGNMENT : 0) |
+                  (deck != nullptr ? CHECKPOINT_HAS_DECK : 0);
+        h.currentPlayer = idOf(currentPlayer);
+
+        h.mapPathLength = static_cast<uint32_t>(mapPath.size());
+        h.mapNameLength = static_cast<uint32_t>(gameMap -> getMapName().size());
+        data.strings = mapPath + gameMap -> getMapName();
+
+        //----- Board -----
+        const vector<Territory*>& territories = gameMap -> getTerritories();
+        data.owners.reserve(territories.size());
+        data.armies.reserve(territories.size());
+
+        for(Territory* t : territories){
+
+            data.owners.push_back(t != nullptr ? idOf(t -> getOwner()) : CHECKPOINT_NO_PLAYER);
+            data.armies.push_back(t != nullptr ? t -> getNumArmies() : 0);
+
         }
 
-        //Assign reinforcement pools to each active player
+        //----- Players, by index. Eliminated players keep an empty slot -----
+        data.players.assign(playerIndexCount, CheckpointPlayer{});
+
         for(Player* p : players){
 
-            if(p == nullptr || p->getPlayerName() == "Neutral"){ continue; }
+            uint16_t id = idOf(p);
+            if(id == CHECKPOINT_NO_PLAYER){ continue; }
 
-            pair<int, string> reinforcementInfo = computeReinforcementFor(p, surpressOutputs);
-            if(!surpressOutputs){ output << reinforcementInfo.second; }
+            CheckpointPlayer& saved = data.players[id];
+            saved.present = 1;
+            saved.role = static_cast<uint8_t>(p -> getRole());
+            saved.generateCard = p -> getGenerateCardThisTurn() ? 1 : 0;
+            saved.reinforcementPool = p -> getReinforcementPool();
 
-            int numArmiesToAdd = reinforcementInfo.first;
+            saved.nameOffset = static_cast<uint32_t>(data.strings.size());
+            saved.nameLength = static_cast<uint32_t>(p -> getPlayerName().size());
+            data.strings += p -> getPlayerName();
+
+            string strategyName = p -> getStrategy() != nullptr ? p -> getStrategy() -> getStrategyName() : "";
+            saved.strategyOffset = static_cast<uint32_t>(data.strings.size());
+            saved.strategyLength = static_cast<uint32_t>(strategyName.size());
+            data.strings += strategyName;
+
+            saved.firstOrder = static_cast<uint32_t>(data.orders.size());
+            if(p -> getPlayerOrders() != nullptr){
+
+                for(Order* o : p -> getPlayerOrders() -> getOrders()){
+
+                    if(o == nullptr){ continue; }
+
+                    OrderRecord record = o -> toRecord();
+                    CheckpointOrder savedOrder = {record.source, record.target, record.numArmies, idOf(record.issuer),
+                                             idOf(record.targetPlayer), static_cast<uint8_t>(record.type), {0, 0, 0}};
+                    data.orders.push_back(savedOrder);
 
-            if(numArmiesToAdd <= 0){
-                if(!surpressOutputs){
-                    output << "[AssignReinforcement] " << p->getPlayerName()
-                        << " receives 0 armies (no territories controlled).\n";
                 }
-                continue;
+
             }
+            saved.numOrders = static_cast<uint32_t>(data.orders.size()) - saved.firstOrder;
 
-            int previousPool = p->getReinforcementPool();
-            p->setReinforcementPool(previousPool + numArmiesToAdd);
+            saved.firstTruce = static_cast<uint32_t>(data.truces.size());
+            for(Player* enemy : p -> getNeutralEnemies()){
 
-            if(!surpressOutputs){
-                output << "[AssignReinforcement] " << p->getPlayerName()
-                    << " receives " << numArmiesToAdd
-                    << " new armies (Pool: " << p->getReinforcementPool() << ").\n\n";
-            }
-        }
+                uint16_t enemyId = idOf(enemy);
+                if(enemyId != CHECKPOINT_NO_PLAYER){ data.truces.push_back(enemyId); }
 
-        if(!surpressOutputs){
-            output << "[AssignReinforcement] === All Reinforcements Assigned ===\n\n";
-        }
+            }
+            saved.numTruces = static_cast<uint32_t>(data.truces.size()) - saved.firstTruce;
 
-        state = EngineState::IssueOrders;
+            saved.firstCard = static_cast<uint32_t>(data.cards.size());
+            if(p -> getHand() != nullptr){
 
-        result = surpressOutputs
-            ? "[AssignReinforcement] Reinforcement phase executed successfully."
-            : output.str();
+                for(Card* c : p -> getHand() -> getHandCards()){
 
-        logAndNotify(result);
-        return result;
-    }
+                    if(c != nullptr){ data.cards.push_back(static_cast<uint8_t>(c -> getType())); }
 
-    string GameEngine::engineIssueOrder(bool surpressOutput){
+                }
 
-        string result;
+            }
+            saved.numCards = static_cast<uint32_t>(data.cards.size()) - saved.firstCard;
 
-        if(!isCurrentStateCorrect(EngineState::IssueOrders, "issueorder")){
-            result = "[IssueOrder] Error: Current state is not issueorder!";
-            logAndNotify(result);
-            return result;
         }
 
-        ostringstream output;
+        //----- Deck cards come after every hand -----
+        size_t handCards = data.cards.size();
+        if(deck != nullptr){
+
+            for(Card* c : deck -> getCards()){
+
+                if(c != nullptr){ data.cards.push_back(static_cast<uint8_t>(c -> getType())); }
+
+            }
 
-        if(!surpressOutput){
-            output << "\n[IssueOrder] === Issuing Orders for Each Player ===\n\n";
         }
+        h.numDeckCards = static_cast<uint32_t>(data.cards.size() - handCards);
 
-        issueOrdersPhase(surpressOutput, output);
+        queue<Player*> tempQueue = playerQueue;
+        while(!tempQueue.empty()){
+
+            uint16_t id = idOf(tempQueue.front());
+            tempQueue.pop();
+            if(id != CHECKPOINT_NO_PLAYER){ data.queue.push_back(id); }
 
-        if(!surpressOutput){
-            output << "[IssueOrder] === All Orders Successfully Issued ===\n";
         }
 
-        result = surpressOutput
-            ? "[IssueOrder] Orders issued successfully."
-            : output.str();
+        return writeCheckpoint(path, data);
 
-        logAndNotify(result);
-        return result;
     }
 
-    string GameEngine::engineEndIssueOrder(bool surpressOutput){
+    string GameEngine::loadCheckpoint(const string& path, bool surpressOutput) {
 
         string result;
 
-        //Validate current state before proceeding
-        if(!isCurrentStateCorrect(EngineState::IssueOrders, "endissueorders")){
-            result = "[EndIssueOrders] Error: Current state is not IssueOrders.";
+        if(!isCurrentStateCorrect(EngineState::Start, "loadcheckpoint")){
+            result = "[Checkpoint] Error: Current state is not start!";
             logAndNotify(result);
             return result;
         }
 
-        //Transition to next phase
-        state = EngineState::ExecuteOrders;
-
-        ostringstream output;
+        //Every index and range in the file is checked here, nothing below needs to bounds check
+        CheckpointReader reader;
+        if(!reader.open(path) || reader.getHeader().state > static_cast<uint8_t>(EngineState::End) ||
+           reader.getHeader().step > static_cast<uint8_t>(TurnStep::EndExecuteOrders)){
+            result = "[Checkpoint] Error: '" + path + "' is not a valid checkpoint file.";
+            logAndNotify(result);
+            return result;
+        }
 
-        if(!surpressOutput){
-            output << "[EndIssueOrders] All players: ";
+        const CheckpointHeader& h = reader.getHeader();
+        string savedMapPath = reader.getString(0, h.mapPathLength);
+        string savedMapName = reader.getString(h.mapPathLength, h.mapNameLength);
 
-            for(size_t i = 0; i < players.size(); ++i){
+        //----- Same map as when the game was saved -----
+        engineLoadMap(savedMapPath, true);
+        if(state == EngineState::MapLoaded){ engineValidateMap(true); }
 
-                if(players[i] != nullptr){
-                    output << players[i]->getPlayerName();
-                    if(i < players.size() - 1){ output << ", "; }
-                }
-            }
+        bool sameMap = state == EngineState::MapValidated && mapHash == h.mapHash &&
+                       gameMap -> getMapName() == savedMapName && gameMap -> getTerritories().size() == h.numTerritories;
 
-            output << " have finished issuing orders.\n";
+        if(!sameMap){
+            clearGame();
+            state = EngineState::Start;
+            result = "[Checkpoint] Error: Map '" + savedMapPath + "' is missing, invalid, or differs from the one the game was saved with.";
+            logAndNotify(result);
+            return result;
         }
 
-        output << "[EndIssueOrders] Transitioning from IssueOrders phase to ExecuteOrders phase.";
-
-        result = surpressOutput
-            ? "[EndIssueOrders] Transitioned to ExecuteOrders phase."
-            : output.str();
-
-        logAndNotify(result);
-        return result;
-    }
+        const vector<Territory*>& territories = gameMap -> getTerritories();
+        const CheckpointPlayer* saved = reader.getPlayers();
+        const uint8_t* cards = reader.getCards();
+        unordered_map<Continent*, long long> emptyHashMap = gameMap -> buildEmptyContinentHashmap();
 
-    string GameEngine::engineExecuteOrder(bool surpressOutput){
+        //----- Players, by index -----
+        vector<Player*> byIndex(h.numPlayers, nullptr);
+        for(uint16_t id = 0; id < h.numPlayers; id++){
 
-        string result;
+            const CheckpointPlayer& s = saved[id];
+            if(s.present == 0){ continue; }
 
-        //Validate current state
-        if(!isCurrentStateCorrect(EngineState::ExecuteOrders, "executeorder")){
-            result = "[ExecuteOrder] Error: Current state is not executeorder!";
-            logAndNotify(result);
-            return result;
-        }
+            Player* p = new Player(reader.getString(s.nameOffset, s.nameLength), emptyHashMap);
+            p -> setPlayerIndex(id);
+            p -> setRole(static_cast<PlayerRole>(s.role));
+            p -> setReinforcementPool(s.reinforcementPool);
+            p -> setGenerateCardThisTurn(s.generateCard != 0);
 
-        ostringstream output;
+            if(s.strategyLength > 0){ p -> setStrategy(WarzonePlayer::createStrategy(reader.getString(s.strategyOffset, s.strategyLength))); }
 
-        if(!surpressOutput){
-            output << "\n[ExecuteOrder] === Executing Orders for Each Player ===\n";
-        }
+            for(uint32_t c = s.firstCard; c < s.firstCard + s.numCards; c++){ p -> getHand() -> addCardToHand(new Card(static_cast<CardType>(cards[c]))); }
 
-        //Delegate the heavy lifting
-        executeOrdersPhase(surpressOutput, output);
+            players.push_back(p);
+            byIndex[id] = p;
+            if(p -> isNeutral()){ neutral = p; }
 
-        //Build result message based on state
-        if(state == EngineState::Win){
-            result = "[ExecuteOrder] Win condition triggered or maximum turns reached.";
-        }
-        else{
-            result = surpressOutput
-                ? "[ExecuteOrder] Orders executed successfully."
-                : output.str();
         }
 
-        logAndNotify(result);
-        return result;
-    }
+        playerIndexCount = h.numPlayers;
 
-    string GameEngine::engineEndExecuteOrder(bool surpressOutput){
+        auto playerOf = [&byIndex](uint16_t id) -> Player* { return id != CHECKPOINT_NO_PLAYER ? byIndex[id] : nullptr; };
 
-        string result;
+        //----- Truces and pending orders, once every player exists -----
+        const uint16_t* truces = reader.getTruces();
+        const CheckpointOrder* orders = reader.getOrders();
 
-        if(!isCurrentStateCorrect(EngineState::ExecuteOrders, "endexecuteorder")){
-            result = "[EndExecuteOrder] Error: Current state is not endexecuteorder!";
-            logAndNotify(result);
-            return result;
-        }
+        for(uint16_t id = 0; id < h.numPlayers; id++){
 
-        state = EngineState::AssignReinforcement;
+            const CheckpointPlayer& s = saved[id];
+            Player* p = byIndex[id];
+            if(p == nullptr){ continue; }
 
-        result = surpressOutput
-            ? "[EndExecuteOrder] End of Turn: " + to_string(turn) + "\n[EndExecuteOrder] Returning to [AssignReinforcement]"
-            : "[EndExecuteOrder] Returning to [AssignReinforcement]";
+            for(uint32_t t = s.firstTruce; t < s.firstTruce + s.numTruces; t++){ p -> addNeutralEnemy(byIndex[truces[t]]); }
 
-        logAndNotify(result);
-        return result;
+            for(uint32_t k = s.firstOrder; k < s.firstOrder + s.numOrders; k++){
 
-    }
+                const CheckpointOrder& o = orders[k];
+                OrderRecord record{byIndex[o.issuer], playerOf(o.targetPlayer), o.source, o.target, o.numArmies, static_cast<OrderType>(o.type)};
 
-    string GameEngine::engineWin(){
+                Order* made = WarzoneOrder::makeOrder(record, territories);
+                if(made != nullptr){ p -> getPlayerOrders() -> addOrder(made); }
 
-        string result;
+            }
 
-        if(!isCurrentStateCorrect(EngineState::Win, "win")){
-            result = "[WIN] Error: Current state is not win!";
-            logAndNotify(result);
-            return result;
         }
 
-        ostringstream output;
+        //----- Board -----
+        const uint16_t* owners = reader.getOwners();
+        const int32_t* armies = reader.getArmies();
 
-        bool startNewGame = startAgain();
+        for(size_t i = 0; i < territories.size(); i++){
 
-        if(startNewGame){
-            
-            state = EngineState::Start;
-            output << "[GameEngine] Starting new game.";
-            result = output.str();
-            logAndNotify(result);
-            return result;
-        
-        } else {
+            Territory* t = territories[i];
+            if(t == nullptr){ continue; }
+
+            Player* owner = playerOf(owners[i]);
+            if(owner != nullptr){ owner -> addOwnedTerritories(t); }
+            t -> setNumArmies(armies[i]);
 
-            state = EngineState::End;
-            output << "[GameEngine] Terminating game.";
-            result = output.str();
-            logAndNotify(result);
-            return result;
-        
         }
 
-    }
+        //----- Deck, queue and engine scalars -----
+        if(h.flags & CHECKPOINT_HAS_DECK){
 
-    string GameEngine::engineEnd(){
+            deck = new Deck(0);
+            for(uint32_t c = h.numCards - h.numDeckCards; c < h.numCards; c++){ deck -> returnToDeck(new Card(static_cast<CardType>(cards[c]))); }
+            deck -> setNumOfPlayers(static_cast<int>(players.size()));
 
-        string result;
+        }
 
-        state = EngineState::End;
-        result = "[End] The program has now terminated. Thank you for playing!";
+        const uint16_t* queued = reader.getQueue();
+        for(uint32_t k = 0; k < h.numQueued; k++){ playerQueue.push(byIndex[queued[k]]); }
+        currentPlayer = playerOf(h.currentPlayer);
+
+        rngSeed = h.rngSeed;
+        turn = h.turn;
+        maxTurns = h.maxTurns;
+        ordersEliminatedLastTurn = h.ordersEliminatedLastTurn;
+        parallelIssueOrders = (h.flags & CHECKPOINT_PARALLEL_ISSUE) != 0;
+        compactOrdersEnabled = (h.flags & CHECKPOINT_COMPACT_ORDERS) != 0;
+        parallelExecuteOrders = (h.flags & CHECKPOINT_PARALLEL_EXECUTE) != 0;
+        balancedAssignment = (h.flags & CHECKPOINT_BALANCED_ASSIGNMENT) != 0;
+        state = static_cast<EngineState>(h.state);
+        nextStep = static_cast<TurnStep>(h.step);
+        syncTurnStep();
+        resetStalemateTracking(); //Progress history is not saved, counting restarts from the loaded board
+
+        ostringstream summary;
+        summary << "[Checkpoint] Loaded turn " << turn << " of '" << savedMapName << "' with " << players.size() << " player(s)";
+        if(!surpressOutput){ summary << " from '" << path << "', " << state; }
+        summary << ".";
+
+        result = summary.str();
         logAndNotify(result);
         return result;
+
     }
 
     /*-----------------------------------------Player Queue Management-------------------------------------------*/
@@ -2188,7 +3906,6 @@ namespace WarzoneEngine {
 
         if(gameMap == nullptr || players.empty()){ return; }
 
-        bool gameOver = false;
         logAndNotify("[GameplayPhase] Beginning Turn " + to_string(getTurn()));
 
         if(!surpressOutput){
@@ -2197,37 +3914,18 @@ namespace WarzoneEngine {
             cout << ("===============================\n");
         }
 
-        while(!gameOver){
-
-            // ---------------- Reinforcement Phase ----------------
-            string reinforceResult = reinforcementPhase(surpressOutput);
-            logAndNotify(reinforceResult);
-
-            // ---------------- Issue Orders Phase ----------------
-            string issueResult = engineIssueOrder(surpressOutput);
-            logAndNotify(issueResult);
-
-            // ---------------- End Issue Orders Phase ----------------
-            string endIssueResult = engineEndIssueOrder(surpressOutput);
-            logAndNotify(endIssueResult);
+        //Reinforcement -> issue orders -> end issue orders -> execute orders -> end execute orders, until Win
+        while(true){
 
-            // ---------------- Execute Orders Phase ----------------
-            string executeResult = engineExecuteOrder(surpressOutput);
-            logAndNotify(executeResult);
+            StepStatus status = stepTurn(surpressOutput);
 
-            // Check if game ended (state == Win)
-            if(state == EngineState::Win){
+            if(status.outcome == StepOutcome::Finished){
                 logAndNotify("[GameplayPhase] Win condition reached. Ending simulation.");
-                gameOver = true;
                 break;
             }
 
-            // ---------------- End Execute Orders Phase ----------------
-            string endExecuteResult = engineEndExecuteOrder(surpressOutput);
-            logAndNotify(endExecuteResult);
+            if(status.outcome != StepOutcome::Running){ break; }
 
-            // ---------------- Increment Turn ----------------
-            setTurn(getTurn() + 1);
             logAndNotify("[GameplayPhase] Proceeding to Turn " + to_string(getTurn()));
         }
 
@@ -2236,6 +3934,165 @@ namespace WarzoneEngine {
         logAndNotify(state == EngineState::Win
             ? "[GameplayPhase] Final state: Win condition reached."
             : "[GameplayPhase] Final state: Unexpected termination.");
+
+        if(stalemateRules.noProgressTurns > 0){
+            ostringstream stats;
+            stats << stalemateStats;
+            logAndNotify(stats.str());
+            if(!surpressOutput) cout << stats.str();
+        }
+
+        if(orderStats.isEnabled()){
+            ostringstream stats;
+            stats << getOrderStats();
+            logAndNotify(stats.str());
+            if(!surpressOutput) cout << stats.str();
+        }
+    }
+
+    StepStatus GameEngine::stepPhase(bool surpressOutput){
+
+        if(state == EngineState::Win){ return makeStepStatus(StepOutcome::Finished, 0, 0); }
+
+        if(state != EngineState::AssignReinforcement && state != EngineState::IssueOrders && state != EngineState::ExecuteOrders){
+            return makeStepStatus(StepOutcome::NotInGameplay, 0, 0);
+        }
+
+        syncTurnStep();
+
+        int turnsCompleted = 0;
+
+        //Every phase command moves nextStep on itself, so commands and stepping can be mixed
+        switch(nextStep){
+
+            case TurnStep::Reinforcement:
+                reinforcementPhase(surpressOutput);
+                break;
+
+            case TurnStep::IssueOrders:
+                engineIssueOrder(surpressOutput);
+                break;
+
+            case TurnStep::EndIssueOrders:
+                engineEndIssueOrder(surpressOutput);
+                break;
+
+            case TurnStep::ExecuteOrders:
+                engineExecuteOrder(surpressOutput);
+                if(state == EngineState::Win){ turnsCompleted = 1; } //Won, or out of turns
+                break;
+
+            case TurnStep::EndExecuteOrders:
+                engineEndExecuteOrder(surpressOutput);
+                setTurn(getTurn() + 1);
+                turnsCompleted = 1;
+                break;
+
+        }
+
+        return makeStepStatus(state == EngineState::Win ? StepOutcome::Finished : StepOutcome::Running, 1, turnsCompleted);
+
+    }
+
+    StepStatus GameEngine::stepTurn(bool surpressOutput){
+
+        int phasesRun = 0;
+
+        while(true){
+
+            StepStatus status = stepPhase(surpressOutput);
+            phasesRun += status.phasesRun;
+
+            if(status.outcome != StepOutcome::Running || status.turnsCompleted > 0){
+                return makeStepStatus(status.outcome, phasesRun, status.turnsCompleted);
+            }
+
+        }
+
+    }
+
+    StepStatus GameEngine::runFor(int turns, bool surpressOutput){
+
+        int phasesRun = 0;
+        int turnsCompleted = 0;
+        StepOutcome outcome = state == EngineState::Win ? StepOutcome::Finished : StepOutcome::Running;
+
+        while(turnsCompleted < turns && outcome == StepOutcome::Running){
+
+            StepStatus status = stepTurn(surpressOutput);
+            phasesRun += status.phasesRun;
+            turnsCompleted += status.turnsCompleted;
+            outcome = status.outcome;
+
+        }
+
+        return makeStepStatus(outcome, phasesRun, turnsCompleted);
+
+    }
+
+    StepStatus GameEngine::runUntil(chrono::steady_clock::time_point deadline, bool surpressOutput){
+
+        int phasesRun = 0;
+        int turnsCompleted = 0;
+
+        while(true){
+
+            if(chrono::steady_clock::now() >= deadline){
+                StepOutcome outcome = state == EngineState::Win ? StepOutcome::Finished : StepOutcome::DeadlineReached;
+                return makeStepStatus(outcome, phasesRun, turnsCompleted);
+            }
+
+            StepStatus status = stepPhase(surpressOutput);
+            phasesRun += status.phasesRun;
+            turnsCompleted += status.turnsCompleted;
+
+            if(status.outcome != StepOutcome::Running){ return makeStepStatus(status.outcome, phasesRun, turnsCompleted); }
+
+        }
+
+    }
+
+    bool GameEngine::awaitsConsoleInput() const {
+
+        if(state != EngineState::IssueOrders || nextStep != TurnStep::IssueOrders){ return false; }
+
+        for(Player* p : players){
+
+            if(p != nullptr && p -> getStrategy() != nullptr && p -> getStrategy() -> readsConsole()){ return true; }
+
+        }
+
+        return false;
+
+    }
+
+    void GameEngine::syncTurnStep(){
+
+        switch(state){
+
+            case EngineState::AssignReinforcement:
+                nextStep = TurnStep::Reinforcement;
+                break;
+
+            case EngineState::IssueOrders:
+                if(nextStep != TurnStep::EndIssueOrders){ nextStep = TurnStep::IssueOrders; }
+                break;
+
+            case EngineState::ExecuteOrders:
+                if(nextStep != TurnStep::EndExecuteOrders){ nextStep = TurnStep::ExecuteOrders; }
+                break;
+
+            default:
+                break;
+
+        }
+
+    }
+
+    StepStatus GameEngine::makeStepStatus(StepOutcome outcome, int phasesRun, int turnsCompleted) const {
+
+        return StepStatus{outcome, state, nextStep, turn, phasesRun, turnsCompleted};
+
     }
 
     bool GameEngine::endPhase() {
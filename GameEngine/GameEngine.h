@@ -6,13 +6,18 @@
 #include <string>
 #include <unordered_map>
 #include <queue>
+#include <deque>
 #include <filesystem>
 
 #include "../Map/Map.h"
+#include "../Map/MapRegistry.h"
 #include "../Player/Player.h"
+#include "../Player/PlayerStrategies.h"
 #include "../Order/Order.h"
 #include "../Card/Card.h"
 #include "../LoggingObserver/LoggingObserver.h"
+#include "Replay.h"
+#include "Checkpoint.h"
 
 namespace WarzoneEngine {
 
@@ -26,10 +31,17 @@ namespace WarzoneEngine {
 
     using WarzonePlayer::PlayerTerrContainer;
     using WarzonePlayer::Player;
+    using WarzonePlayer::PlayerRole;
+    using WarzonePlayer::PLAYER_NO_INDEX;
 
     using WarzoneOrder::OrderList;
     using WarzoneOrder::Order;
     using WarzoneOrder::OrderType;
+    using WarzoneOrder::OrderRecord;
+    using WarzoneOrder::ValidationStatus;
+    using WarzoneOrder::ExecutionResult;
+    using WarzoneOrder::OrderStats;
+    using WarzoneOrder::OrderStatsSnapshot;
     using WarzoneOrder::Deploy;
     using WarzoneOrder::Advance;
     using WarzoneOrder::Bomb;
@@ -37,12 +49,15 @@ namespace WarzoneEngine {
     using WarzoneOrder::Airlift;
     using WarzoneOrder::Negotiate;
     using WarzoneOrder::TimeUtil;
+    using WarzoneOrder::BattleDice;
 
     using WarzoneCard::Deck;
     using WarzoneCard::Hand;
     using WarzoneCard::Card;
     using WarzoneCard::CardType;
 
+    //Default smallest batch of non-conflicting orders run on worker threads, smaller batches would cost more to spawn than to run
+    const size_t PARALLEL_EXECUTE_MIN_BATCH = 256;
 
     /*------------------------------------------ENGINE STATE ENUM--------------------------------------------------*/
 
@@ -81,6 +96,91 @@ namespace WarzoneEngine {
      */
     std::ostream& operator<<(std::ostream& os, const EngineState& s);
 
+    /**
+     * @brief Phase of a gameplay turn that GameEngine::stepPhase() runs next, in turn order.
+     */
+    enum class TurnStep : uint8_t {
+        Reinforcement,
+        IssueOrders,
+        EndIssueOrders,
+        ExecuteOrders,
+        EndExecuteOrders
+    };
+
+    /**
+     * @brief Why a stepping call returned.
+     */
+    enum class StepOutcome {
+        Running,            //Stepped as asked, the game can continue
+        Finished,           //The game is in the Win state (won or out of turns)
+        DeadlineReached,    //runUntil() stopped at its deadline, the game can continue
+        NotInGameplay       //The engine is not between gamestart and Win, nothing was run
+    };
+
+    /**
+     * @struct StepStatus
+     * @brief Result of a stepping call: where the game stands and how much the call ran.
+     */
+    struct StepStatus {
+
+        StepOutcome outcome;
+        EngineState state;
+        TurnStep nextStep;      //Phase the next stepPhase() runs
+        int turn;
+        int phasesRun;          //Phases run by this call
+        int turnsCompleted;     //Turns finished by this call, a turn that ends the game included
+
+    };
+
+    /**
+     * @brief How the engine ends a game that stopped making progress.
+     */
+    enum class StalemateResolution {
+        Draw,           //Nobody wins
+        Adjudicate      //The player holding the most territories wins, then the most armies, then the lowest player index
+    };
+
+    /**
+     * @struct StalemateRules
+     * @brief When the execute orders phase ends a game for lack of progress. Detection is off by default.
+     */
+    struct StalemateRules {
+
+        int noProgressTurns = 0;    //Turns in a row without progress that end the game, 0 disables detection
+        StalemateResolution resolution = StalemateResolution::Draw;
+
+    };
+
+    /**
+     * @struct StalemateStats
+     * @brief Progress measured at the end of every execute orders phase while stalemate detection is on.
+     *
+     * A turn makes progress when at least one territory changed owner and the resulting board (owners and armies)
+     * was not already seen within the last noProgressTurns turns. Armies shuffled between the same territories,
+     * or a territory lost and taken back, do not count as progress.
+     */
+    struct StalemateStats {
+
+        uint64_t fingerprint = 0;           //Zobrist hash of owners and armies after the last turn
+        int ownershipChangesLastTurn = 0;
+        long long ownershipChanges = 0;     //Since detection started
+        int turnsTracked = 0;
+        int turnsWithoutProgress = 0;       //Current streak
+        int longestNoProgressStreak = 0;
+        int repeatedBoards = 0;             //Turns that ended on a board already seen within the window
+        bool declared = false;              //The game was ended by the stalemate rules
+        string adjudicatedWinner;           //Winner's name when resolved by Adjudicate, empty for a draw
+
+    };
+
+    /**
+     * @brief Prints the stalemate statistics
+     * @param os Output stream
+     * @param stats Statistics to print
+     * @return Output stream
+     */
+    std::ostream& operator<<(std::ostream& os, const StalemateStats& stats);
+
 
     /*------------------------------------------GAME ENGINE CLASS--------------------------------------------------*/
 
@@ -109,13 +209,107 @@ namespace WarzoneEngine {
             Map* gameMap; 
             Deck* deck; 
             vector<Player*> players;
+            Player* neutral; //Also in players, which owns it. nullptr before the game starts
+            uint16_t playerIndexCount; //Size of per-player tables, every player index is below it
             int turn;
             int maxTurns;
+            TurnStep nextStep; //Phase stepPhase() runs next, only meaningful while state is between AssignReinforcement and ExecuteOrders
+
+            // === Determinism & parallelism ===
+            unsigned int rngSeed; //Game seed, every player's per-turn decision RNG is derived from it
+            bool parallelIssueOrders; //If true, players compute their orders concurrently during the issue orders phase
+            bool compactOrdersEnabled; //If true, failing orders are dropped and friendly moves merged before execution
+            int ordersEliminatedLastTurn; //Orders removed by compactOrders() during the last execute orders phase
+            bool parallelExecuteOrders; //If true, silent execute orders phases run non-conflicting orders concurrently
+            size_t parallelExecuteMinBatch; //Smallest batch executeRecordsConcurrently() hands to worker threads
+            int parallelBatchesLastTurn; //Batches run on worker threads during the last execute orders phase
+            bool balancedAssignment; //If true, assignTerritories() gives every player an even share of every continent
+            OrderStats orderStats; //Counters of this engine's executed orders, copies only inherit whether they are enabled
+
+            // === Stalemate detection ===
+            StalemateRules stalemateRules;
+            StalemateStats stalemateStats;
+            vector<uint64_t> zobristOwnerKeys; //[territory * (playerIndexCount + 1) + owner slot], slot 0 is "no owner"
+            vector<uint64_t> zobristArmyKeys; //One per territory, mixed with its army count
+            vector<uint16_t> lastOwners; //Owner slot of every territory after the previous turn
+            deque<uint64_t> recentFingerprints; //Fingerprints of the last noProgressTurns turns, oldest first
+
+            /**
+             * @brief Stalemate tracking as it stood when a checkpoint was opened, put back by rollback()
+             */
+            struct StalemateTracking {
+
+                StalemateStats stats;
+                vector<uint16_t> lastOwners;
+                deque<uint64_t> recentFingerprints;
+
+            };
+
+            // === Speculative execution ===
+            StateJournal journal; //Undo log behind checkpoint() / rollback(), never copied
+            vector<Player*> eliminatedPlayers; //Eliminated while a checkpoint was open, deleted once the last one closes
+            vector<StalemateTracking> stalemateCheckpoints; //One per open checkpoint, innermost last, never copied
+
+            // === Replays ===
+            string mapPath; //Path of the loaded map file, written to replay and checkpoint headers
+            uint64_t mapHash; //MappedFile::hashBytes() of the loaded map file, checked when a checkpoint is loaded
+            ReplayWriter recorder; //Open while recording, never copied
+            bool recordHeaderWritten; //Replay ids are player indices, names are written once per recording
+            uint64_t recordedBoardHash; //Board hash at the end of the last recorded turn
+            unsigned long long replayBattleSeed; //Battle seed read from a replay, 0 to derive it from rngSeed
 
             // === Queue-based turn system ===
             queue<Player*> playerQueue;
             Player* currentPlayer = nullptr;
 
+            /**
+             * @brief Realigns nextStep with state, for states that were set without going through the phase commands (e.g. a loaded checkpoint)
+             */
+            void syncTurnStep();
+
+            /**
+             * @brief Builds a stepping result from the current state
+             * @param outcome Why the call returned
+             * @param phasesRun Phases run by the call
+             * @param turnsCompleted Turns finished by the call
+             * @return Status
+             */
+            StepStatus makeStepStatus(StepOutcome outcome, int phasesRun, int turnsCompleted) const;
+
+            /**
+             * @brief Owner slot of every territory (player index + 1, 0 if unowned) and the Zobrist hash of owners and armies
+             * @param owners Filled with the owner slots, by dense territory index
+             * @return Board fingerprint
+             */
+            uint64_t computeFingerprint(vector<uint16_t>& owners) const;
+
+            /**
+             * @brief Restarts stalemate tracking from the current board: new Zobrist keys if the board size changed,
+             * cleared statistics and history
+             */
+            void resetStalemateTracking();
+
+            /**
+             * @brief Measures the turn that just executed against the previous one and updates the statistics
+             * @return true if the stalemate rules end the game now
+             */
+            bool trackProgress();
+
+            /**
+             * @brief Player the Adjudicate resolution declares the winner
+             * @return Player with the most territories (then armies, then lowest index), nullptr if nobody owns anything
+             */
+            Player* adjudicateWinner() const;
+
+            /**
+             * @brief Deletes the players kept alive for rollback(), once no checkpoint is open
+             */
+            void releaseEliminatedPlayers();
+
+            //-- StateJournal undo functions --//
+            static void undoQueueRemoval(const JournalEntry& entry);
+            static void undoPlayerErase(const JournalEntry& entry);
+
              /**
              * @brief Latest descriptive log message about engine activity.
              * 
@@ -147,7 +341,10 @@ namespace WarzoneEngine {
             /**
              * @brief Copy constructor.
              *
-             * Creates a deep copy of another GameEngine, duplicating its map, deck, and player data.
+             * Creates an independent deep copy of another GameEngine. Only the immutable map topology (adjacency and
+             * continent membership) and the routing table are shared with the original; every Territory, Continent,
+             * Player, card and order is allocated anew, and links between them are rebuilt by dense index instead of
+             * by name. Open checkpoints are not copied, and copying never records into other's journal.
              * @param other The GameEngine object to copy from.
              */
             GameEngine(const GameEngine& other);
@@ -209,11 +406,23 @@ namespace WarzoneEngine {
             const vector<Player*>& getPlayers() const;
 
             /**
-             * @brief Replace the list of players.
+             * @brief Replace the list of players, and number them (see assignPlayerIndices()).
              * @param newPlayers New vector of player pointers.
              */
             void setPlayers(const vector<Player*>& newPlayers);
 
+            /**
+             * @brief Get the neutral player.
+             * @return Pointer to the neutral player, nullptr before the game starts.
+             */
+            Player* getNeutralPlayer() const;
+
+            /**
+             * @brief Size of tables indexed by Player::getPlayerIndex(). Eliminated players keep their index.
+             * @return One more than the largest assigned player index
+             */
+            uint16_t getPlayerIndexCount() const;
+
             /**
              * @brief Accessor for number of turns elapsed
              * @return Current turn of the game
@@ -238,6 +447,235 @@ namespace WarzoneEngine {
              */
             void setMaxTurns(int maxTurns);
 
+            /**
+             * @brief Accessor for the game seed
+             * @return Seed every player's decision RNG is derived from
+             */
+            unsigned int getRngSeed() const;
+
+            /**
+             * @brief Mutator for the game seed. Two games with the same seed and board issue the same orders.
+             * @param seed New game seed
+             */
+            void setRngSeed(unsigned int seed);
+
+            /**
+             * @brief Accessor for the parallel issue orders mode
+             * @return true if players compute their orders concurrently
+             */
+            bool getParallelIssueOrders() const;
+
+            /**
+             * @brief Mutator for the parallel issue orders mode. Issued orders, deck order and logs are identical either way.
+             * @param enabled true to compute all players' orders concurrently on a thread pool
+             */
+            void setParallelIssueOrders(bool enabled);
+
+            /**
+             * @brief Accessor for order compaction before the execute orders phase
+             * @return true if compactOrders() runs every turn
+             */
+            bool getCompactOrders() const;
+
+            /**
+             * @brief Mutator for order compaction. The board after each turn is the same either way.
+             * @param enabled true to drop provably failing orders and merge friendly same-edge Advances
+             */
+            void setCompactOrders(bool enabled);
+
+            /**
+             * @brief Accessor for the number of orders compactOrders() removed last turn
+             * @return Eliminated (dropped or merged away) orders
+             */
+            int getOrdersEliminatedLastTurn() const;
+
+            /**
+             * @brief Accessor for the parallel execute orders mode
+             * @return true if non-conflicting orders execute concurrently
+             */
+            bool getParallelExecuteOrders() const;
+
+            /**
+             * @brief Mutator for the parallel execute orders mode. Only silent phases (surpressOutput) are affected,
+             * and the board after each turn is the same as with sequential round-robin execution.
+             * @param enabled true to execute non-conflicting orders concurrently
+             */
+            void setParallelExecuteOrders(bool enabled);
+
+            /**
+             * @brief Accessor for the smallest batch of non-conflicting orders run on worker threads
+             * @return Minimum batch size, PARALLEL_EXECUTE_MIN_BATCH by default
+             */
+            size_t getParallelExecuteMinBatch() const;
+
+            /**
+             * @brief Mutator for the smallest batch of non-conflicting orders run on worker threads. Smaller batches
+             * run on the calling thread; the board after each turn is the same either way.
+             * @param minBatch Minimum batch size, at least 1
+             */
+            void setParallelExecuteMinBatch(size_t minBatch);
+
+            /**
+             * @brief Accessor for the number of order batches run on worker threads during the last execute orders phase
+             * @return Batches of at least getParallelExecuteMinBatch() orders, 0 if parallel execution did not run
+             */
+            int getParallelBatchesLastTurn() const;
+
+            /**
+             * @brief Accessor for the balanced territory assignment mode
+             * @return true if starting territories are spread evenly over the continents
+             */
+            bool getBalancedAssignment() const;
+
+            /**
+             * @brief Mutator for the balanced territory assignment mode, used by the next assignTerritories()
+             * @param enabled true to deal every continent's territories out round-robin between players
+             */
+            void setBalancedAssignment(bool enabled);
+
+            /**
+             * @brief Accessor for order execution statistics collection
+             * @return true if this engine's executed orders are being counted and timed (see WarzoneOrder::OrderStats)
+             */
+            bool getCollectOrderStats() const;
+
+            /**
+             * @brief Mutator for order execution statistics collection. When on, the statistics are dumped at game end.
+             * @param enabled true to count and time every executed order
+             */
+            void setCollectOrderStats(bool enabled);
+
+            /**
+             * @brief Per order type counts, latency histograms and battle sizes collected so far
+             * @return Snapshot of the counters
+             */
+            OrderStatsSnapshot getOrderStats() const;
+
+            /**
+             * @brief Sets every order statistics counter back to 0
+             */
+            void resetOrderStats();
+
+            /**
+             * @brief Accessor for the stalemate rules
+             * @return Current rules
+             */
+            const StalemateRules& getStalemateRules() const;
+
+            /**
+             * @brief Mutator for the stalemate rules. Tracking restarts from the current board.
+             * @param rules New rules, noProgressTurns 0 to turn detection off
+             */
+            void setStalemateRules(const StalemateRules& rules);
+
+            /**
+             * @brief Progress statistics measured so far this game
+             * @return Statistics, printed at game end while detection is on
+             */
+            const StalemateStats& getStalemateStats() const;
+
+            /**
+             * @brief Starts writing every executed turn to a replay file.
+             *
+             * Each execute orders phase writes its player queue, its issued orders (after handle*Order resolution)
+             * and its battle seed, followed by the resulting board hash. The board is written before the first
+             * turn, and again whenever it changed outside of order execution (e.g. Cheater conquests).
+             *
+             * @param path Replay file to create
+             * @return false if the file could not be created
+             */
+            bool startRecording(const string& path);
+
+            /**
+             * @brief Stops recording and closes the replay file
+             */
+            void stopRecording();
+
+            /**
+             * @brief Whether executed turns are being written to a replay file
+             * @return true if recording
+             */
+            bool isRecording() const;
+
+            /**
+             * @brief Re-executes a recorded game from its order stream, without running the issue orders phase.
+             *
+             * Must be called in the Start state. Loads the recorded map, creates the recorded players, then runs
+             * executeOrdersPhase() on every recorded turn and checks the board against the recorded hash.
+             *
+             * @param path Replay file written by startRecording()
+             * @param surpressOutput If true, suppresses console/log output from the replayed phases.
+             * @return Summary of the replay, including the first turn whose board diverged, if any
+             */
+            string replayGame(const string& path, bool surpressOutput);
+
+            /**
+             * @brief Saves the running game to a binary checkpoint file.
+             *
+             * The file references the map by path, name and content hash, and holds every territory's owner and
+             * army count, each player's hand, pending orders, truces, reinforcement pool and strategy, the deck,
+             * the turn queue, the turn, the engine state and the game seed. Decision RNGs and battle dice are
+             * derived from the seed and the turn, so the seed is the whole RNG state.
+             *
+             * Unlike checkpoint(), which journals in memory for rollback(), this writes a file that survives the process.
+             * @param path Checkpoint file to create
+             * @return false if no map is loaded or the file could not be written
+             */
+            bool saveCheckpoint(const string& path);
+
+            /**
+             * @brief Restores a game saved by saveCheckpoint().
+             *
+             * Must be called in the Start state. The checkpoint is memory mapped and validated in place, the map it
+             * references is loaded and checked against the saved content hash, then the game is rebuilt directly
+             * from the saved arrays.
+             *
+             * @param path Checkpoint file written by saveCheckpoint()
+             * @param surpressOutput If true, suppresses console output.
+             * @return Summary of the load, or the reason it was refused
+             */
+            string loadCheckpoint(const string& path, bool surpressOutput);
+
+            /**
+             * @brief Hash of the board: every territory's owner and army count
+             * @return FNV-1a hash, equal for equal boards
+             */
+            uint64_t boardHash() const;
+
+            /**
+             * @brief Opens a checkpoint of the board and player state (armies, owners, owned territories, truces, card flags).
+             *
+             * Meant for speculative order execution (e.g. AI lookahead): execute orders, then rollback() in O(changes)
+             * instead of copying the engine. Checkpoints nest. While one is open, order issuing and execution are sequential.
+             * Only changes made through this engine's phases and commands are recorded, in this engine's own journal.
+             * Players eliminated meanwhile are kept alive until the last checkpoint closes, so rolling back brings them back.
+             * Stalemate tracking is saved with the checkpoint, so rolled back turns never count toward noProgressTurns.
+             * Card draws, the turn counter and the engine state are not covered: restore the turn and state
+             * with setTurn() / setState() when rolling back across executeOrdersPhase().
+             *
+             * @return Checkpoint depth after opening
+             */
+            size_t checkpoint();
+
+            /**
+             * @brief Undoes every journaled change since the last checkpoint, and closes it
+             * @return false if no checkpoint was open
+             */
+            bool rollback();
+
+            /**
+             * @brief Closes the last checkpoint, keeping its changes
+             * @return false if no checkpoint was open
+             */
+            bool commitCheckpoint();
+
+            /**
+             * @brief Journal this engine's changes are recorded in. The engine installs it around its own calls; install it
+             * with a StateJournal::Scope to also record changes made directly, e.g. orders executed by a lookahead.
+             * @return The engine's journal while it has an open checkpoint, nullptr otherwise
+             */
+            StateJournal* recordingJournal();
+
             /**
              * @brief Get the current player queue.
              * @return A copy of the player queue.
@@ -280,6 +718,12 @@ namespace WarzoneEngine {
              */
             void setState(const EngineState& gameState);
 
+            /**
+             * @brief Get the phase stepPhase() runs next.
+             * @return Next turn step, only meaningful during gameplay
+             */
+            TurnStep getNextStep() const;
+
             //-------- Helper and Internal Methods ---------//
 
             /**
@@ -307,6 +751,11 @@ namespace WarzoneEngine {
 
             /**
              * @brief Assigns territories from the map to players at the start of the game.
+             *
+             * Territories are shuffled (Fisher-Yates, seeded from rngSeed) and every player takes a contiguous slice
+             * of the same size, in O(territories). The remainder goes to the neutral player.
+             * See setBalancedAssignment() for an even spread over continents.
+             *
              * @param surpressOutput Determine whether to generate string output of method
              * @return String output of the method
              */
@@ -384,6 +833,129 @@ namespace WarzoneEngine {
             */
             void issueOrdersPhase(bool surpressOutput, ostringstream& output);
 
+            /**
+             * @brief Runs one player's issue orders decisions: Player::issueOrder(), then finalizes its card-based orders.
+             *
+             * Only reads the board, and only writes to the player's own OrderList, Hand, truce list and decision RNG,
+             * so it is safe to call for different players concurrently as long as gameDeck is nullptr.
+             *
+             * @param p Player issuing orders
+             * @param neutralPlayer Pointer to the neutral player
+             * @param gameDeck Deck used cards are returned to, or nullptr to hold them in the player until returnPendingCards()
+             * @param surpressOutput If true, disables console output; otherwise logs actions.
+             * @param output String stream reference to collect results of method output
+             */
+            void issueOrdersForPlayer(Player* p, Player* neutralPlayer, Deck* gameDeck, bool surpressOutput, ostringstream& output);
+
+            /**
+             * @brief Finalizes the orders a player just issued: assigns targets to its card-based placeholder orders and logs the results.
+             * @param p Player that issued the orders
+             * @param neutralPlayer Pointer to the neutral player
+             * @param issueOrderResults Log produced while the player was issuing
+             * @param surpressOutput If true, disables console output; otherwise logs actions.
+             * @param output String stream reference to collect results of method output
+             */
+            void finalizeIssuedOrders(Player* p, Player* neutralPlayer, const string& issueOrderResults, bool surpressOutput, ostringstream& output);
+
+            /**
+             * @brief Collects the players issuing orders this turn, in players order, and seeds their decision RNGs
+             * @param neutralPlayer Set to the neutral player, if there is one
+             * @return Non-null, non-neutral players
+             */
+            vector<Player*> prepareIssuers(Player*& neutralPlayer);
+
+            /**
+             * @brief Issue orders phase where every player is driven by the same strategy type, bound at compile time.
+             *
+             * Meant for batch simulations: per-player strategies are ignored, and each step call is resolved statically
+             * (see WarzonePlayer::issueOrderWith). Seeding, card finalization and logging match issueOrdersPhase().
+             *
+             * @param strategy Strategy used for every player
+             * @param surpressOutput If true, disables console output; otherwise logs actions.
+             * @param output String stream reference to collect results of method output
+             */
+            template<typename Strategy>
+            void issueOrdersPhaseWith(Strategy& strategy, bool surpressOutput, ostringstream& output) {
+
+                StateJournal::Scope recording(recordingJournal());
+                Player* neutralPlayer = nullptr;
+
+                for(Player* p : prepareIssuers(neutralPlayer)) {
+
+                    if(p -> getPlayerOrders() == nullptr) { continue; }
+
+                    if(!surpressOutput){ 
+                        output << "[IssueOrder] Player: " << p -> getPlayerName() 
+                               << " is beginning their IssueOrder phase:\n\n"; 
+                    }
+
+                    ostringstream issueOutput;
+                    p -> resetScratchArena();
+                    p -> getPlayerOrders() -> beginBatch();
+                    WarzonePlayer::issueOrderWith(strategy, p, issueOutput, surpressOutput, deck, neutralPlayer);
+                    p -> getPlayerOrders() -> endBatch();
+
+                    finalizeIssuedOrders(p, neutralPlayer, issueOutput.str(), surpressOutput, output);
+
+                }
+
+            }
+
+            /**
+             * @brief Derives the decision RNG seed of a player for the current turn
+             * @param playerPosition Position of the player in the players list
+             * @return Seed depending only on rngSeed, turn and playerPosition
+             */
+            unsigned int decisionSeedFor(size_t playerPosition) const;
+
+            /**
+             * @brief Derives the battle seed of the current turn (see WarzoneOrder::BattleDice)
+             * @return Non-zero seed depending only on rngSeed and turn
+             */
+            unsigned long long battleSeedForTurn() const;
+
+            /**
+             * @brief Writes the current turn's player queue and orders to the replay file, preceded by the board if needed
+             * @param battleSeed Battle seed the turn executes with
+             */
+            void recordTurn(unsigned long long battleSeed);
+
+            /**
+             * @brief Order compaction stage run between issuing and executing orders.
+             *
+             * Elides (see OrderList::elideOrder) Advance and Airlift orders that will provably fail validation:
+             * non-positive or unaffordable army counts on a source nothing reinforces this turn, or non-adjacent Advance targets.
+             * Several Advances by the same player along the same friendly edge are merged into one, when no other order
+             * touches either territory. Elided slots keep their round-robin turn, so execution order is otherwise unchanged.
+             *
+             * @param surpressOutput If true, suppresses console/log output.
+             * @param output Aggregated output stream to append human-readable logs.
+             * @return Number of orders eliminated, also available through getOrdersEliminatedLastTurn()
+             */
+            int compactOrders(bool surpressOutput, ostringstream& output);
+
+            /**
+             * @brief Applies every Deploy the round-robin Deploy pass would execute, as one update.
+             *
+             * The leading Deploys of each list are gathered into flat (territory index, armies) arrays, ownership is
+             * checked in bulk, and the armies are scatter-added per territory. Deploys only add armies to territories
+             * their issuer owns, so the board afterwards matches the one-by-one pass. Only silent runs use it, so nothing is logged.
+             *
+             * @return Number of Deploys applied (invalid ones are dropped)
+             */
+            int executeDeploysBatched();
+
+            /**
+             * @brief Executes order records with the same result as running them one by one, in schedule order.
+             *
+             * Each record's read and write set (territories, and per player the owned territories and the truce list)
+             * is derived from the board before its batch runs. Batches are built greedily in schedule order from records
+             * that do not conflict with any earlier unexecuted record, and each large batch runs on a thread pool.
+             *
+             * @param schedule Records in the order the sequential round-robin would have executed them
+             */
+            void executeRecordsConcurrently(const vector<OrderRecord>& schedule);
+
             /**
             * @brief Executes the Execute Orders phase: runs all Deploy orders first (round-robin),
             * then all other orders round-robin; handles truces, card rewards, eliminations,
@@ -403,6 +975,17 @@ namespace WarzoneEngine {
              */
             pair<int, string> computeReinforcementFor(Player* p, bool surpressOutput) const;
 
+            /**
+             * @brief Computes every player's reinforcements in one pass, same totals as computeReinforcementFor().
+             *
+             * Territory owners are flattened into an array of player indices, which gives the per-player territory
+             * counts in one walk. Each continent then checks its territories against that array, so the whole
+             * computation is O(territories + players) and never touches the continent hash tables.
+             *
+             * @param reinforcements Filled with the reinforcement total of each player index (0 for the neutral player)
+             */
+            void computeReinforcements(vector<int>& reinforcements) const;
+
             /**
              * @brief Finds a player in the current player list by name.
              * @param name The name of the player to find.
@@ -410,6 +993,20 @@ namespace WarzoneEngine {
              */
             Player* findPlayerByName(const string& name) const;
 
+            /**
+             * @brief Gives every player its position in players as dense index, and finds the neutral player.
+             * Players not created by engineGameStart() get the Neutral role if they are named "Neutral".
+             */
+            void assignPlayerIndices();
+
+            /**
+             * @brief Copies the players of other into this engine, after gameMap has been copied.
+             * Copied territories are handed to the copied players; the queue, current player and neutral player
+             * are resolved by dense index.
+             * @param other Engine being copied
+             */
+            void copyPlayersFrom(const GameEngine& other);
+
             /**
              * @brief Resets the game to the initial state, clearing all data.
              * @return True if user decides to restart, false otherwise.
@@ -561,6 +1158,45 @@ namespace WarzoneEngine {
              */
             void gameplayPhase(bool surpressOutput);
 
+            /**
+             * @brief Runs the next phase of the current turn (reinforcement, issue orders, end issue orders,
+             * execute orders or end execute orders), so a caller can pause, inspect or interleave games between phases.
+             * @param surpressOutput Suppresses console output when true.
+             * @return Status after the phase; Finished or NotInGameplay without running anything if the game is not playing
+             */
+            StepStatus stepPhase(bool surpressOutput);
+
+            /**
+             * @brief Runs phases up to the end of the current turn, or until the game ends
+             * @param surpressOutput Suppresses console output when true.
+             * @return Status after the turn
+             */
+            StepStatus stepTurn(bool surpressOutput);
+
+            /**
+             * @brief Runs up to a number of turns, stopping early if the game ends
+             * @param turns Turns to run, a turn already in progress counts as one
+             * @param surpressOutput Suppresses console output when true.
+             * @return Status after the last turn run
+             */
+            StepStatus runFor(int turns, bool surpressOutput);
+
+            /**
+             * @brief Runs phases until the deadline passes or the game ends.
+             *
+             * The deadline is checked before every phase, so the call can overrun it by at most one phase.
+             * @param deadline Point in time after which no new phase is started
+             * @param surpressOutput Suppresses console output when true.
+             * @return Status, DeadlineReached if the game can continue
+             */
+            StepStatus runUntil(chrono::steady_clock::time_point deadline, bool surpressOutput);
+
+            /**
+             * @brief Whether the next phase waits for console input (issue orders with a human player still in the game)
+             * @return true if stepPhase() would block on cin
+             */
+            bool awaitsConsoleInput() const;
+
             /**
              * @brief Handles the game ending
              * @return True if the game is restarted, False if the game is terminated 
@@ -1,14 +1,187 @@
 #include "GameEngineDriver.h"
+#include "GameScheduler.h"
 #include "LoggingObserver/LoggingObserver.h"
+#include "Player/PlayerStrategies.h"
 #include <algorithm>
+#include <array>
 #include <iostream>
 #include <sstream>
 #include <chrono>
+#include <climits>
+#include <cstdio>
 #include <fstream>
+#include <memory>
 
 using namespace WarzoneEngine;
 using namespace WarzoneLog;
 
+/*---------------------------------- Automated Check Helpers ----------------------------------*/
+
+namespace {
+
+    //Silent game with a fixed seed where every player runs the same strategy
+    bool startSilentGame(GameEngine& engine, const string& mapPath, unsigned int seed, const vector<string>& names, const string& strategy){
+
+        engine.setRngSeed(seed);
+        engine.engineLoadMap(mapPath, true);
+        engine.engineValidateMap(true);
+        for(const string& name : names){ engine.engineAddPlayer(name, true); }
+        engine.engineGameStart(true);
+
+        if(engine.getState() != EngineState::AssignReinforcement){ return false; }
+
+        for(Player* p : engine.getPlayers()){ if(!p -> isNeutral()){ p -> setStrategy(WarzonePlayer::createStrategy(strategy)); } }
+        return true;
+
+    }
+
+    //Largest difference between two non-neutral players' territory counts in any one continent
+    int worstContinentSpread(const GameEngine& engine){
+
+        int worst = 0;
+
+        for(Continent* c : engine.getGameMap() -> getContinents()){
+
+            unordered_map<Player*, int> counts;
+            for(Player* p : engine.getPlayers()){ if(!p -> isNeutral()){ counts[p] = 0; } }
+
+            for(Territory* t : engine.getGameMap() -> getTerritories()){
+
+                if(t -> getContinent() == c && counts.count(t -> getOwner()) > 0){ counts[t -> getOwner()]++; }
+
+            }
+
+            int fewest = INT_MAX;
+            int most = 0;
+            for(const auto& entry : counts){ fewest = min(fewest, entry.second); most = max(most, entry.second); }
+            if(!counts.empty()){ worst = max(worst, most - fewest); }
+
+        }
+
+        return worst;
+
+    }
+
+    //Reinforcement, issue and execute phases of one turn, stopping before endexecuteorder
+    void playUntilEndOfTurn(GameEngine& engine){
+
+        engine.reinforcementPhase(true);
+        engine.engineIssueOrder(true);
+        engine.engineEndIssueOrder(true);
+        engine.engineExecuteOrder(true);
+
+    }
+
+    //Board hash, then every player's owned territories, truces and continent scores, then the turn order
+    string describeGame(const GameEngine& engine){
+
+        ostringstream description;
+        description << hex << engine.boardHash() << dec;
+
+        for(Player* p : engine.getPlayers()){
+
+            long long continentScore = 0;
+            for(const auto& entry : p -> getContinentLookupTablePlayer()){ continentScore += entry.second; }
+
+            description << " | " << p -> getPlayerName() << ": " << p -> getOwnedTerritories().size() << " territories, truces";
+            for(Player* enemy : p -> getNeutralEnemies()){ description << " " << enemy -> getPlayerName(); }
+            description << ", continents " << continentScore;
+
+        }
+
+        description << " | queue";
+        queue<Player*> order = engine.getPlayerQueue();
+        for(; !order.empty(); order.pop()){ description << " " << order.front() -> getPlayerName(); }
+
+        return description.str();
+
+    }
+
+    //describeGame(), plus hands, pending orders, turn, state and step
+    string describeSavedGame(GameEngine& engine){
+
+        ostringstream description;
+        description << describeGame(engine) << " | turn " << engine.getTurn() << ", " << engine.getStateAsString()
+                    << ", step " << static_cast<int>(engine.getNextStep());
+
+        for(Player* p : engine.getPlayers()){
+
+            description << " | " << p -> getPlayerName() << " #" << p -> getPlayerIndex() << " hand";
+            for(Card* c : p -> getHand() -> getHandCards()){ description << " " << c -> getTypeString(); }
+
+            description << ", orders";
+            for(Order* o : p -> getPlayerOrders() -> getOrders()){ description << " [" << *o << "]"; }
+
+        }
+
+        return description.str();
+
+    }
+
+    //Cards left in the engine's deck, in deck order
+    string describeDeck(const GameEngine& engine){
+
+        ostringstream description;
+        for(Card* c : engine.getDeck() -> getCards()){ description << c -> getTypeString() << " "; }
+        return description.str();
+
+    }
+
+    void reportCheck(const string& check, bool passed){
+
+        cout << "[Check] " << check << ": " << (passed ? "PASSED" : "FAILED") << "\n";
+
+    }
+
+    //Issues every turn of a seeded game through the strategies' virtual calls and, on a copy, through
+    //issueOrdersPhaseWith<Strategy>; returns the number of turns whose orders, hands and deck differed
+    template<typename Strategy>
+    int countStaticDispatchMismatches(const string& strategyName, unsigned int seed, int turns, int& turnsCompared){
+
+        GameEngine dynamic;
+        turnsCompared = 0;
+
+        if(!startSilentGame(dynamic, "../Map/test_maps/Brazil/Brazil.map", seed, {"Alice", "Bob", "Carol", "Dave"}, strategyName)){
+            cerr << "[Driver] Could not start the game on Brazil.map\n";
+            return -1;
+        }
+
+        Strategy strategy;
+        int mismatches = 0;
+
+        for(int t = 0; t < turns && dynamic.getState() != EngineState::Win; t++){
+
+            dynamic.reinforcementPhase(true);
+
+            GameEngine bound(dynamic);
+            ostringstream boundOutput;
+
+            dynamic.engineIssueOrder(true);
+            bound.issueOrdersPhaseWith(strategy, true, boundOutput);
+
+            //Both leave the issue phase the same way, so the next step matches too
+            dynamic.engineEndIssueOrder(true);
+            bound.engineEndIssueOrder(true);
+
+            turnsCompared++;
+            if(describeSavedGame(bound) != describeSavedGame(dynamic) || describeDeck(bound) != describeDeck(dynamic)){
+
+                mismatches++;
+                cout << "[Driver] " << strategyName << ", turn " << dynamic.getTurn() << ": issued orders differ\n";
+
+            }
+
+            dynamic.engineExecuteOrder(true);
+            if(dynamic.getState() != EngineState::Win){ dynamic.engineEndExecuteOrder(true); }
+
+        }
+
+        return mismatches;
+
+    }
+
+}
+
 /*---------------------------------- Manual Console Driver ----------------------------------*/
 
 void testGameStates(){
@@ -150,3 +323,853 @@ void mainGameLoop(){
     delete gameEngine;
     
 }
+
+/*---------------------------------- Checkpoint / Rollback Test ----------------------------------*/
+
+void testCheckpointRollback(){
+
+    cout << "=============================================\n";
+    cout << "        TEST: CHECKPOINT AND ROLLBACK        \n";
+    cout << "=============================================\n\n";
+
+    GameEngine engine;
+
+    if(!startSilentGame(engine, "../Map/test_maps/Brazil/Brazil.map", 39, {"Alice", "Bob", "Carol", "Dave"}, "Aggressive")){
+        cerr << "[Driver] Could not start the game on Brazil.map\n";
+        return;
+    }
+
+    //The turn counter and the engine state are not journaled, the driver puts them back itself
+    int turn = engine.getTurn();
+    string start = describeGame(engine);
+
+    engine.checkpoint();
+    playUntilEndOfTurn(engine);
+    string afterFirstTurn = describeGame(engine);
+
+    engine.checkpoint();
+    {
+
+        //Changes made outside the engine's own calls are recorded once its journal is installed
+        StateJournal::Scope recording(engine.recordingJournal());
+        Player* first = engine.getPlayers()[0];
+        Player* second = engine.getPlayers()[1];
+        first -> addNeutralEnemy(second);
+        second -> addNeutralEnemy(first);
+
+    }
+
+    engine.setState(EngineState::AssignReinforcement);
+    playUntilEndOfTurn(engine);
+    reportCheck("two speculative turns changed the board", describeGame(engine) != start);
+
+    engine.rollback();
+    reportCheck("inner rollback restores the state after the first turn", describeGame(engine) == afterFirstTurn);
+
+    engine.rollback();
+    engine.setTurn(turn);
+    engine.setState(EngineState::AssignReinforcement);
+    reportCheck("outer rollback restores board, territories, truces and continent scores", describeGame(engine) == start);
+
+    //Play on, speculating every turn, until a turn eliminates somebody
+    bool eliminated = false;
+
+    for(int t = 0; t < 300 && !eliminated && engine.getState() != EngineState::Win; t++){
+
+        turn = engine.getTurn();
+        size_t playerCount = engine.getPlayers().size();
+        string before = describeGame(engine);
+
+        engine.checkpoint();
+        playUntilEndOfTurn(engine);
+
+        if(engine.getPlayers().size() < playerCount){
+
+            eliminated = true;
+            cout << "[Driver] Turn " << turn << " eliminated " << playerCount - engine.getPlayers().size() << " player(s), rolling it back\n";
+
+            engine.rollback();
+            engine.setTurn(turn);
+            engine.setState(EngineState::AssignReinforcement);
+            reportCheck("rollback brings eliminated players back", engine.getPlayers().size() == playerCount && describeGame(engine) == before);
+
+        }
+        else {
+
+            engine.commitCheckpoint();
+            if(engine.getState() != EngineState::Win){ engine.engineEndExecuteOrder(true); }
+
+        }
+
+    }
+
+    if(!eliminated){ cout << "[Driver] No player was eliminated, elimination rollback not checked\n"; }
+
+    cout << "\n=============================================\n";
+    cout << "      END OF CHECKPOINT AND ROLLBACK TEST    \n";
+    cout << "=============================================\n\n";
+}
+
+/*---------------------------------- Replay Round Trip Test ----------------------------------*/
+
+void testReplayRoundTrip(){
+
+    cout << "=============================================\n";
+    cout << "          TEST: REPLAY ROUND TRIP            \n";
+    cout << "=============================================\n\n";
+
+    const string replayPath = "driver_round_trip.replay";
+
+    for(bool parallel : {false, true}){
+
+        string mode = parallel ? "parallel execution" : "sequential execution";
+
+        GameEngine recorded;
+        recorded.setMaxTurns(60);
+        recorded.setParallelExecuteOrders(parallel);
+        recorded.setParallelExecuteMinBatch(2); //Worker threads run even the small batches of Brazil
+
+        if(!startSilentGame(recorded, "../Map/test_maps/Brazil/Brazil.map", 40, {"Alice", "Bob", "Carol"}, "Aggressive")){
+            cerr << "[Driver] Could not start the game on Brazil.map\n";
+            return;
+        }
+
+        if(!recorded.startRecording(replayPath)){
+            cerr << "[Driver] Could not create " << replayPath << "\n";
+            return;
+        }
+
+        StepStatus status = recorded.runFor(60, true);
+        recorded.stopRecording();
+        cout << "[Driver] Recorded " << status.turnsCompleted << " turn(s) with " << mode << "\n";
+
+        GameEngine replayed;
+        replayed.setParallelExecuteOrders(parallel);
+        replayed.setParallelExecuteMinBatch(2);
+        string summary = replayed.replayGame(replayPath, true);
+        cout << summary << "\n";
+
+        reportCheck("replay with " + mode + " matched the recording after every turn",
+                    summary.find("board matched the recording after every turn") != string::npos
+                    && summary.find("truncated") == string::npos);
+        reportCheck("replay with " + mode + " ends on the recorded board", replayed.boardHash() == recorded.boardHash());
+
+    }
+
+    remove(replayPath.c_str());
+
+    cout << "\n=============================================\n";
+    cout << "        END OF REPLAY ROUND TRIP TEST        \n";
+    cout << "=============================================\n\n";
+}
+
+/*---------------------------------- Save / Load Checkpoint Test ----------------------------------*/
+
+void testSaveLoadCheckpoint(){
+
+    cout << "=============================================\n";
+    cout << "        TEST: SAVE AND LOAD CHECKPOINT       \n";
+    cout << "=============================================\n\n";
+
+    const string checkpointPath = "driver_mid_game.checkpoint";
+    const string truncatedPath = "driver_truncated.checkpoint";
+    const string mapCopyPath = "driver_map_copy.map";
+    const string changedMapPath = "driver_changed_map.checkpoint";
+
+    //----- Round trip in the middle of a turn: orders issued, not executed yet -----
+    GameEngine saved;
+
+    if(!startSilentGame(saved, "../Map/test_maps/Brazil/Brazil.map", 45, {"Alice", "Bob", "Carol", "Dave"}, "Aggressive")){
+        cerr << "[Driver] Could not start the game on Brazil.map\n";
+        return;
+    }
+
+    saved.runFor(6, true);
+    saved.reinforcementPhase(true);
+    saved.engineIssueOrder(true);
+
+    if(!saved.saveCheckpoint(checkpointPath)){
+        cerr << "[Driver] Could not write " << checkpointPath << "\n";
+        return;
+    }
+
+    GameEngine loaded;
+    cout << loaded.loadCheckpoint(checkpointPath, true) << "\n";
+
+    string expected = describeSavedGame(saved);
+    string actual = describeSavedGame(loaded);
+    reportCheck("loaded game has the saved owners, armies, hands, orders, truces, queue, state and step", actual == expected);
+    if(actual != expected){ cout << "[Driver] Saved:  " << expected << "\n[Driver] Loaded: " << actual << "\n"; }
+
+    //Both finish the turn the same way
+    saved.stepPhase(true);
+    saved.stepPhase(true);
+    loaded.stepPhase(true);
+    loaded.stepPhase(true);
+    reportCheck("loaded game executes the pending orders like the saved one", loaded.boardHash() == saved.boardHash());
+
+    //----- A file cut in half is rejected -----
+    {
+
+        ifstream in(checkpointPath, ios::binary);
+        string bytes((istreambuf_iterator<char>(in)), istreambuf_iterator<char>());
+        ofstream(truncatedPath, ios::binary) << bytes.substr(0, bytes.size() / 2);
+
+    }
+
+    GameEngine fromTruncated;
+    string truncatedResult = fromTruncated.loadCheckpoint(truncatedPath, true);
+    cout << truncatedResult << "\n";
+    reportCheck("truncated checkpoint is rejected", truncatedResult.find("Error") != string::npos && fromTruncated.getState() == EngineState::Start);
+
+    //----- A checkpoint whose map file changed since it was saved is rejected -----
+    {
+
+        ifstream in("../Map/test_maps/Brazil/Brazil.map", ios::binary);
+        ofstream(mapCopyPath, ios::binary) << in.rdbuf();
+
+    }
+
+    GameEngine onCopy;
+    bool savedOnCopy = startSilentGame(onCopy, mapCopyPath, 45, {"Alice", "Bob"}, "Aggressive") && onCopy.saveCheckpoint(changedMapPath);
+
+    ofstream(mapCopyPath, ios::binary | ios::app) << "\n; edited after the checkpoint was saved\n";
+
+    GameEngine fromChangedMap;
+    string changedMapResult = fromChangedMap.loadCheckpoint(changedMapPath, true);
+    cout << changedMapResult << "\n";
+    reportCheck("checkpoint of a changed map is rejected",
+                savedOnCopy && changedMapResult.find("Error") != string::npos && fromChangedMap.getState() == EngineState::Start);
+
+    for(const string& path : {checkpointPath, truncatedPath, mapCopyPath, changedMapPath}){ remove(path.c_str()); }
+
+    cout << "\n=============================================\n";
+    cout << "     END OF SAVE AND LOAD CHECKPOINT TEST    \n";
+    cout << "=============================================\n\n";
+}
+
+/*---------------------------------- Parallel Execution Test ----------------------------------*/
+
+void testParallelExecution(){
+
+    cout << "=============================================\n";
+    cout << "   TEST: PARALLEL VS SEQUENTIAL EXECUTION    \n";
+    cout << "=============================================\n\n";
+
+    GameEngine sequential;
+
+    if(!startSilentGame(sequential, "../Map/test_maps/Brazil/Brazil.map", 36, {"Alice", "Bob", "Carol", "Dave", "Eve"}, "Aggressive")){
+        cerr << "[Driver] Could not start the game on Brazil.map\n";
+        return;
+    }
+
+    //Card draws are not seeded, so each turn's orders are issued once and the copy executes the very same lists.
+    //No test map has PARALLEL_EXECUTE_MIN_BATCH territories, so no batch ever gets that large: the copy hands
+    //every batch of two or more orders to its worker threads instead
+    const size_t minBatch = 2;
+    int turnsCompared = 0;
+    int turnsMatched = 0;
+    int threadedBatches = 0;
+
+    for(int t = 0; t < 15 && sequential.getState() != EngineState::Win; t++){
+
+        sequential.reinforcementPhase(true);
+        sequential.engineIssueOrder(true);
+        sequential.engineEndIssueOrder(true);
+
+        GameEngine parallel(sequential);
+        parallel.setParallelExecuteOrders(true);
+        parallel.setParallelExecuteMinBatch(minBatch);
+
+        sequential.engineExecuteOrder(true);
+        parallel.engineExecuteOrder(true);
+        threadedBatches += parallel.getParallelBatchesLastTurn();
+
+        turnsCompared++;
+        if(parallel.boardHash() == sequential.boardHash()){ turnsMatched++; }
+        else{ cout << "[Driver] Turn " << sequential.getTurn() << ": boards differ\n"; }
+
+        if(sequential.getState() != EngineState::Win){ sequential.engineEndExecuteOrder(true); }
+
+    }
+
+    cout << "[Driver] " << turnsMatched << " of " << turnsCompared << " turn(s) left the same board, "
+         << threadedBatches << " batch(es) of " << minBatch << "+ orders ran on worker threads\n";
+    reportCheck("parallel execution gives the sequential board on every turn", turnsCompared > 0 && turnsMatched == turnsCompared);
+    reportCheck("batches went through the worker thread path", threadedBatches > 0);
+
+    cout << "\n=============================================\n";
+    cout << "   END OF PARALLEL VS SEQUENTIAL EXECUTION   \n";
+    cout << "=============================================\n\n";
+}
+
+/*---------------------------------- Engine Copy Test ----------------------------------*/
+
+void testEngineCopy(){
+
+    cout << "=============================================\n";
+    cout << "              TEST: ENGINE COPY              \n";
+    cout << "=============================================\n\n";
+
+    GameEngine source;
+
+    if(!startSilentGame(source, "../Map/test_maps/Palmerica/Palmerica.map", 44, {"Alice", "Bob", "Carol", "Dave"}, "Aggressive")){
+        cerr << "[Driver] Could not start the game on Palmerica.map\n";
+        return;
+    }
+
+    //Mid-turn, so the copy has pending orders and hands to rebuild
+    source.runFor(3, true);
+    source.reinforcementPhase(true);
+    source.engineIssueOrder(true);
+
+    const int copies = 200;
+    auto started = chrono::steady_clock::now();
+    for(int i = 0; i < copies; i++){ GameEngine copy(source); }
+    auto elapsed = chrono::duration_cast<chrono::microseconds>(chrono::steady_clock::now() - started);
+    cout << "[Driver] Mid-game copy of Palmerica: " << elapsed.count() / copies << " us on average over " << copies << " copies\n";
+
+    GameEngine copy(source);
+    string atCopy = describeSavedGame(source);
+    reportCheck("copy starts equal to its source", describeSavedGame(copy) == atCopy);
+
+    //Source plays on: the copy must not move
+    source.engineEndIssueOrder(true);
+    source.engineExecuteOrder(true);
+    string sourceAfterTurn = describeSavedGame(source);
+    reportCheck("source executing its orders leaves the copy untouched",
+                sourceAfterTurn != atCopy && describeSavedGame(copy) == atCopy);
+
+    //Copy is mutated directly and plays its own turn: the source must not move
+    Territory* first = copy.getGameMap() -> getTerritories()[0];
+    first -> setNumArmies(first -> getNumArmies() + 1000);
+
+    Player* alice = copy.getPlayers()[0];
+    Player* bob = copy.getPlayers()[1];
+    alice -> addNeutralEnemy(bob);
+    bob -> addNeutralEnemy(alice);
+
+    copy.engineEndIssueOrder(true);
+    copy.engineExecuteOrder(true);
+    reportCheck("copy mutations and turn leave the source untouched",
+                describeSavedGame(copy) != atCopy && describeSavedGame(source) == sourceAfterTurn);
+
+    //Nothing is shared but the immutable topology
+    bool ownedByCopy = true;
+    for(Territory* t : copy.getGameMap() -> getTerritories()){
+
+        Player* owner = t -> getOwner();
+        if(owner != nullptr){ ownedByCopy = ownedByCopy && find(copy.getPlayers().begin(), copy.getPlayers().end(), owner) != copy.getPlayers().end(); }
+
+    }
+
+    reportCheck("copy territories are owned by the copy's own players",
+                ownedByCopy && copy.getGameMap() != source.getGameMap() && first != source.getGameMap() -> getTerritories()[0]);
+    reportCheck("copy shares the source's topology", copy.getGameMap() -> getTopology() == source.getGameMap() -> getTopology());
+
+    cout << "\n=============================================\n";
+    cout << "           END OF ENGINE COPY TEST           \n";
+    cout << "=============================================\n\n";
+}
+
+
+/*---------------------------------- Parallel Issue Orders Test ----------------------------------*/
+
+void testParallelIssue(){
+
+    cout << "=============================================\n";
+    cout << "     TEST: PARALLEL VS SEQUENTIAL ISSUING    \n";
+    cout << "=============================================\n\n";
+
+    GameEngine sequential;
+
+    if(!startSilentGame(sequential, "../Map/test_maps/Brazil/Brazil.map", 29, {"Alice", "Bob", "Carol", "Dave", "Eve"}, "Aggressive")){
+        cerr << "[Driver] Could not start the game on Brazil.map\n";
+        return;
+    }
+
+    //Each turn is issued twice from the same copied state: once sequentially, once by the parallel path
+    int turnsCompared = 0;
+    int ordersMatched = 0;
+    int decksMatched = 0;
+
+    for(int t = 0; t < 12 && sequential.getState() != EngineState::Win; t++){
+
+        sequential.reinforcementPhase(true);
+
+        GameEngine parallel(sequential);
+        parallel.setParallelIssueOrders(true);
+
+        sequential.engineIssueOrder(true);
+        parallel.engineIssueOrder(true);
+
+        turnsCompared++;
+        if(describeSavedGame(parallel) == describeSavedGame(sequential)){ ordersMatched++; }
+        else{ cout << "[Driver] Turn " << sequential.getTurn() << ": issued orders or hands differ\n"; }
+
+        if(describeDeck(parallel) == describeDeck(sequential)){ decksMatched++; }
+        else{ cout << "[Driver] Turn " << sequential.getTurn() << ": decks differ\n"; }
+
+        sequential.engineEndIssueOrder(true);
+        sequential.engineExecuteOrder(true);
+        if(sequential.getState() != EngineState::Win){ sequential.engineEndExecuteOrder(true); }
+
+    }
+
+    cout << "[Driver] " << ordersMatched << " of " << turnsCompared << " turn(s) issued the same orders\n";
+    reportCheck("parallel issuing gives the sequential order lists and hands on every turn", turnsCompared > 0 && ordersMatched == turnsCompared);
+    reportCheck("parallel issuing returns played cards to the deck in the sequential order", turnsCompared > 0 && decksMatched == turnsCompared);
+
+    cout << "\n=============================================\n";
+    cout << "   END OF PARALLEL VS SEQUENTIAL ISSUING     \n";
+    cout << "=============================================\n\n";
+}
+
+/*---------------------------------- Static Dispatch Issue Orders Test ----------------------------------*/
+
+void testStaticDispatchIssue(){
+
+    cout << "=============================================\n";
+    cout << "      TEST: STATIC DISPATCH ISSUE ORDERS     \n";
+    cout << "=============================================\n\n";
+
+    int aggressiveTurns = 0;
+    int defensiveTurns = 0;
+    int benevolentTurns = 0;
+
+    int aggressiveMismatches = countStaticDispatchMismatches<WarzonePlayer::AggressivePlayerStrategy>("Aggressive", 30, 12, aggressiveTurns);
+    int defensiveMismatches = countStaticDispatchMismatches<WarzonePlayer::DefensivePlayerStrategy>("Defensive", 31, 12, defensiveTurns);
+    int benevolentMismatches = countStaticDispatchMismatches<WarzonePlayer::BenevolentPlayerStrategy>("Benevolent", 32, 12, benevolentTurns);
+
+    cout << "[Driver] Compared " << aggressiveTurns << " Aggressive, " << defensiveTurns << " Defensive and "
+         << benevolentTurns << " Benevolent turn(s)\n";
+
+    reportCheck("issueOrdersPhaseWith<AggressivePlayerStrategy> issues the virtual dispatch orders", aggressiveTurns > 0 && aggressiveMismatches == 0);
+    reportCheck("issueOrdersPhaseWith<DefensivePlayerStrategy> issues the virtual dispatch orders", defensiveTurns > 0 && defensiveMismatches == 0);
+    reportCheck("issueOrdersPhaseWith<BenevolentPlayerStrategy> issues the virtual dispatch orders", benevolentTurns > 0 && benevolentMismatches == 0);
+
+    cout << "\n=============================================\n";
+    cout << "    END OF STATIC DISPATCH ISSUE ORDERS      \n";
+    cout << "=============================================\n\n";
+}
+
+/*---------------------------------- Order Statistics Test ----------------------------------*/
+
+void testOrderStats(){
+
+    cout << "=============================================\n";
+    cout << "          TEST: ORDER STATISTICS             \n";
+    cout << "=============================================\n\n";
+
+    GameEngine engine;
+
+    if(!startSilentGame(engine, "../Map/test_maps/Brazil/Brazil.map", 38, {"Alice", "Bob", "Carol", "Dave"}, "Aggressive")){
+        cerr << "[Driver] Could not start the game on Brazil.map\n";
+        return;
+    }
+
+    //Without compaction every issued order reaches execution, so the pending lists tell how many should be counted
+    engine.setCompactOrders(false);
+    engine.setCollectOrderStats(true);
+
+    array<uint64_t, WarzoneOrder::ORDER_TYPE_COUNT> issued{};
+    int turnsPlayed = 0;
+
+    for(int t = 0; t < 8 && engine.getState() != EngineState::Win; t++){
+
+        engine.reinforcementPhase(true);
+        engine.engineIssueOrder(true);
+        engine.engineEndIssueOrder(true);
+
+        for(Player* p : engine.getPlayers()){
+            for(Order* o : p -> getPlayerOrders() -> getOrders()){ issued[static_cast<size_t>(o -> getOrderType())]++; }
+        }
+
+        engine.engineExecuteOrder(true);
+        if(engine.getState() != EngineState::Win){ engine.engineEndExecuteOrder(true); }
+        turnsPlayed++;
+
+    }
+
+    OrderStatsSnapshot stats = engine.getOrderStats();
+    cout << stats << "\n";
+
+    bool countsMatch = true;
+    uint64_t totalIssued = 0;
+
+    for(size_t type = 0; type < issued.size(); type++){
+
+        totalIssued += issued[type];
+        if(stats.types[type].executed() != issued[type]){
+
+            countsMatch = false;
+            cout << "[Driver] Order type " << type << ": " << issued[type] << " issued, " << stats.types[type].executed() << " counted\n";
+
+        }
+
+    }
+
+    cout << "[Driver] " << totalIssued << " order(s) issued over " << turnsPlayed << " turn(s), " << stats.battles << " battle(s)\n";
+    reportCheck("per-type executed counts equal the orders executed", totalIssued > 0 && countsMatch);
+    reportCheck("an Aggressive game records battles", stats.battles > 0);
+
+    //A copy inherits whether the collector is on, not what it counted
+    GameEngine copy(engine);
+    OrderStatsSnapshot copied = copy.getOrderStats();
+    uint64_t copiedExecuted = 0;
+    for(const auto& type : copied.types){ copiedExecuted += type.executed(); }
+    reportCheck("a copy collects but starts from zero", copy.getCollectOrderStats() && copiedExecuted == 0 && copied.battles == 0);
+
+    engine.resetOrderStats();
+    OrderStatsSnapshot reset = engine.getOrderStats();
+    uint64_t resetExecuted = 0;
+    for(const auto& type : reset.types){ resetExecuted += type.executed(); }
+    reportCheck("resetOrderStats clears every counter", resetExecuted == 0 && reset.battles == 0);
+
+    cout << "\n=============================================\n";
+    cout << "        END OF ORDER STATISTICS TEST         \n";
+    cout << "=============================================\n\n";
+}
+
+/*---------------------------------- Balanced Assignment Test ----------------------------------*/
+
+void testBalancedAssignment(){
+
+    cout << "=============================================\n";
+    cout << "        TEST: BALANCED ASSIGNMENT            \n";
+    cout << "=============================================\n\n";
+
+    const vector<string> maps = {"Brazil", "Africa", "Palmerica"};
+    const vector<string> names = {"Alice", "Bob", "Carol", "Dave", "Eve"};
+
+    //Owner of every territory; the turn order is shuffled apart from the game seed, so describeGame() would not do
+    auto ownersOf = [](const GameEngine& engine){
+
+        string owners;
+        for(Territory* t : engine.getGameMap() -> getTerritories()){ owners += (t -> getOwner() != nullptr ? t -> getOwner() -> getPlayerName() : "-") + " "; }
+        return owners;
+
+    };
+
+    int setups = 0;
+    int balancedSetups = 0;
+    int reproducedSetups = 0;
+
+    for(const string& mapName : maps){
+
+        for(unsigned int seed = 1; seed <= 4; seed++){
+
+            //Three to five players, so some maps leave territories over for the neutral player
+            vector<string> players(names.begin(), names.begin() + 2 + seed % 4);
+            string path = "../Map/test_maps/" + mapName + "/" + mapName + ".map";
+
+            GameEngine engine;
+            GameEngine again;
+            engine.setBalancedAssignment(true);
+            again.setBalancedAssignment(true);
+
+            if(!startSilentGame(engine, path, seed, players, "Aggressive") || !startSilentGame(again, path, seed, players, "Aggressive")){
+                cerr << "[Driver] Could not start the game on " << path << "\n";
+                return;
+            }
+
+            GameEngine shuffled;
+            startSilentGame(shuffled, path, seed, players, "Aggressive");
+
+            int spread = worstContinentSpread(engine);
+            cout << "[Driver] " << mapName << ", seed " << seed << ", " << players.size() << " players: largest per-continent difference "
+                 << spread << " balanced, " << worstContinentSpread(shuffled) << " shuffled\n";
+
+            setups++;
+            if(spread <= 1){ balancedSetups++; }
+            if(ownersOf(again) == ownersOf(engine)){ reproducedSetups++; }
+
+        }
+
+    }
+
+    reportCheck("every player's count per continent differs by at most 1", setups > 0 && balancedSetups == setups);
+    reportCheck("the same seed deals the same balanced setup", setups > 0 && reproducedSetups == setups);
+
+    cout << "\n=============================================\n";
+    cout << "      END OF BALANCED ASSIGNMENT TEST        \n";
+    cout << "=============================================\n\n";
+}
+
+/*---------------------------------- Map Registry Test ----------------------------------*/
+
+void testMapRegistry(){
+
+    cout << "=============================================\n";
+    cout << "            TEST: MAP REGISTRY               \n";
+    cout << "=============================================\n\n";
+
+    const string brazilPath = "../Map/test_maps/Brazil/Brazil.map";
+    const string mapCopyPath = "driver_registry_copy.map";
+
+    MapRegistry& registry = MapRegistry::getInstance();
+    registry.clear(); //Earlier tests of this run may have registered maps already
+
+    //----- Two engines loading the same file share the topology and routing table -----
+    GameEngine first;
+    GameEngine second;
+    GameEngine throughOtherPath;
+    first.engineLoadMap(brazilPath, true);
+    second.engineLoadMap(brazilPath, true);
+    throughOtherPath.engineLoadMap("../Map/test_maps/Brazil/../Brazil/Brazil.map", true);
+
+    Map* firstMap = first.getGameMap();
+    Map* secondMap = second.getGameMap();
+    bool loaded = firstMap != nullptr && secondMap != nullptr && throughOtherPath.getGameMap() != nullptr;
+
+    reportCheck("second load of a map comes from the registry", loaded && registry.size() == 1);
+    reportCheck("both engines share one topology and one routing table",
+                loaded && firstMap != secondMap && firstMap -> getTopology() == secondMap -> getTopology()
+                && firstMap -> getRoutingTable() != nullptr && firstMap -> getRoutingTable() == secondMap -> getRoutingTable());
+    reportCheck("both engines own their territories", loaded && firstMap -> getTerritories()[0] != secondMap -> getTerritories()[0]);
+    reportCheck("another spelling of the same path shares the entry",
+                loaded && registry.size() == 1 && throughOtherPath.getGameMap() -> getTopology() == firstMap -> getTopology());
+
+    //----- A file whose contents changed misses the cache -----
+    {
+
+        ifstream in(brazilPath, ios::binary);
+        ofstream(mapCopyPath, ios::binary) << in.rdbuf();
+
+    }
+
+    GameEngine beforeEdit;
+    beforeEdit.engineLoadMap(mapCopyPath, true);
+
+    //Same territories, another author
+    {
+
+        ifstream in(brazilPath, ios::binary);
+        string contents((istreambuf_iterator<char>(in)), istreambuf_iterator<char>());
+        contents.replace(contents.find("author="), 7, "author=Edited ");
+        ofstream(mapCopyPath, ios::binary | ios::trunc) << contents;
+
+    }
+
+    GameEngine afterEdit;
+    GameEngine afterEditAgain;
+    afterEdit.engineLoadMap(mapCopyPath, true);
+    afterEditAgain.engineLoadMap(mapCopyPath, true);
+
+    bool editLoaded = beforeEdit.getGameMap() != nullptr && afterEdit.getGameMap() != nullptr && afterEditAgain.getGameMap() != nullptr;
+
+    reportCheck("edited file is parsed again instead of copied",
+                editLoaded && afterEdit.getGameMap() -> getTopology() != beforeEdit.getGameMap() -> getTopology());
+    reportCheck("edited file replaces its old entry", editLoaded && registry.size() == 2
+                && afterEditAgain.getGameMap() -> getTopology() == afterEdit.getGameMap() -> getTopology());
+
+    //----- Clearing keeps the maps already handed out -----
+    registry.clear();
+    reportCheck("clear empties the registry and loaded maps stay usable",
+                registry.size() == 0 && loaded && first.engineValidateMap(true).find("Error") == string::npos);
+
+    remove(mapCopyPath.c_str());
+
+    cout << "\n=============================================\n";
+    cout << "          END OF MAP REGISTRY TEST           \n";
+    cout << "=============================================\n\n";
+}
+
+/*---------------------------------- Game Scheduler Test ----------------------------------*/
+
+void testGameScheduler(){
+
+    cout << "=============================================\n";
+    cout << "           TEST: GAME SCHEDULER              \n";
+    cout << "=============================================\n\n";
+
+    const vector<string> maps = {"Brazil", "Africa", "Palmerica"};
+    const vector<string> strategies = {"Benevolent", "Defensive"};
+    const int silentGames = 12;
+
+    //Deck and turn order shuffles are not seeded, so each reference is a copy of its game taken right after gamestart.
+    //Neither strategy conquers, so no card is drawn afterwards and a game's board only depends on its seed.
+    vector<unique_ptr<GameEngine>> games;
+    vector<unique_ptr<GameEngine>> references;
+
+    for(int i = 0; i < silentGames; i++){
+
+        string path = "../Map/test_maps/" + maps[i % maps.size()] + "/" + maps[i % maps.size()] + ".map";
+        unique_ptr<GameEngine> game = make_unique<GameEngine>();
+        game -> setMaxTurns(4 + 3 * i); //Games of different lengths, so workers run out of work at different times
+
+        if(!startSilentGame(*game, path, 49 + i, {"Alice", "Bob", "Carol"}, strategies[i % strategies.size()])){
+            cerr << "[Driver] Could not start the game on " << path << "\n";
+            return;
+        }
+
+        references.push_back(make_unique<GameEngine>(*game));
+        games.push_back(move(game));
+
+    }
+
+    GameEngine humanGame;
+
+    if(!startSilentGame(humanGame, "../Map/test_maps/Brazil/Brazil.map", 48, {"Alice", "Bob"}, "Benevolent")){
+        cerr << "[Driver] Could not start the game on Brazil.map\n";
+        return;
+    }
+
+    humanGame.getPlayers()[0] -> setStrategy(WarzonePlayer::createStrategy("human"));
+
+    //Short slices on more workers than cores, so games are switched and stolen often
+    vector<size_t> silentIds;
+    size_t humanId = 0;
+    size_t stealCount = 0;
+
+    {
+
+        GameScheduler scheduler(4, chrono::microseconds(200));
+
+        for(int i = 0; i < silentGames / 2; i++){ silentIds.push_back(scheduler.submit(games[i].get())); }
+        humanId = scheduler.submit(&humanGame);
+        for(int i = silentGames / 2; i < silentGames; i++){ silentIds.push_back(scheduler.submit(games[i].get())); }
+
+        scheduler.waitAll();
+
+        int finished = 0;
+        for(size_t id : silentIds){ if(scheduler.getStatus(id) == ScheduledGameStatus::Finished){ finished++; } }
+
+        vector<size_t> suspended = scheduler.getSuspended();
+        stealCount = scheduler.getStealCount();
+
+        cout << "[Driver] " << finished << " of " << silentGames << " silent game(s) finished on " << scheduler.getWorkerCount()
+             << " workers, " << suspended.size() << " game(s) suspended, " << stealCount << " steal(s)\n";
+
+        reportCheck("waitAll returns with every silent game finished", finished == silentGames);
+        reportCheck("the Human game is the only suspended game",
+                    suspended.size() == 1 && suspended[0] == humanId && scheduler.getStatus(humanId) == ScheduledGameStatus::Suspended);
+        reportCheck("the Human game stopped right before its issue orders phase",
+                    humanGame.awaitsConsoleInput() && humanGame.getState() == EngineState::IssueOrders);
+
+    }
+
+    //Same games, one after the other on this thread
+    int matched = 0;
+
+    for(int i = 0; i < silentGames; i++){
+
+        references[i] -> runFor(INT_MAX, true);
+
+        if(games[i] -> getState() == EngineState::Win && games[i] -> getTurn() == references[i] -> getTurn()
+           && describeGame(*games[i]) == describeGame(*references[i])){ matched++; }
+        else{ cout << "[Driver] Game " << i << ": board differs from its sequential run\n"; }
+
+    }
+
+    cout << "[Driver] " << matched << " of " << silentGames << " scheduled game(s) match their sequential run\n";
+    reportCheck("every finished board matches a sequential runFor of the same game", matched == silentGames);
+
+    cout << "\n=============================================\n";
+    cout << "         END OF GAME SCHEDULER TEST          \n";
+    cout << "=============================================\n\n";
+}
+
+/*---------------------------------- Stalemate Detection Test ----------------------------------*/
+
+void testStalemateDetection(){
+
+    cout << "=============================================\n";
+    cout << "        TEST: STALEMATE DETECTION            \n";
+    cout << "=============================================\n\n";
+
+    const string africaPath = "../Map/test_maps/Africa/Africa.map";
+    const int window = 10;
+
+    //----- Two Benevolent players never attack: declared a draw after the window -----
+    GameEngine drawn;
+
+    if(!startSilentGame(drawn, africaPath, 50, {"Alice", "Bob"}, "Benevolent")){
+        cerr << "[Driver] Could not start the game on Africa.map\n";
+        return;
+    }
+
+    drawn.setStalemateRules(StalemateRules{window, StalemateResolution::Draw});
+    StepStatus drawStatus = drawn.runFor(500, true);
+    const StalemateStats& drawStats = drawn.getStalemateStats();
+    cout << drawStats;
+
+    reportCheck("two Benevolent players on Africa are declared a stalemate", drawStatus.outcome == StepOutcome::Finished
+                && drawn.getState() == EngineState::Win && drawStats.declared && drawStats.adjudicatedWinner.empty());
+    reportCheck("the stalemate ends the game once the window is full", drawStats.turnsWithoutProgress == window && drawStatus.turnsCompleted == window);
+
+    //----- Same game under Adjudicate: most territories, then armies, then lowest index -----
+    GameEngine adjudicated;
+
+    if(!startSilentGame(adjudicated, africaPath, 50, {"Alice", "Bob"}, "Benevolent")){
+        cerr << "[Driver] Could not start the game on Africa.map\n";
+        return;
+    }
+
+    adjudicated.setStalemateRules(StalemateRules{window, StalemateResolution::Adjudicate});
+    adjudicated.runFor(500, true);
+
+    Player* expected = nullptr;
+    size_t expectedTerritories = 0;
+    long long expectedArmies = 0;
+
+    for(Player* p : adjudicated.getPlayers()){
+
+        if(p -> isNeutral()){ continue; }
+
+        long long armies = 0;
+        for(Territory* t : p -> getOwnedTerritories().getTerritories()){ armies += t -> getNumArmies(); }
+
+        size_t owned = p -> getOwnedTerritories().size();
+        if(expected == nullptr || owned > expectedTerritories || (owned == expectedTerritories && armies > expectedArmies)){
+
+            expected = p;
+            expectedTerritories = owned;
+            expectedArmies = armies;
+
+        }
+
+    }
+
+    const StalemateStats& adjudicatedStats = adjudicated.getStalemateStats();
+    cout << adjudicatedStats;
+
+    reportCheck("Adjudicate names the player with the most territories, then armies",
+                adjudicatedStats.declared && expected != nullptr && adjudicatedStats.adjudicatedWinner == expected -> getPlayerName()
+                && adjudicated.getCurrentPlayer() == expected);
+
+    //----- Turns rolled back never count toward the window -----
+    GameEngine speculating;
+
+    if(!startSilentGame(speculating, africaPath, 50, {"Alice", "Bob"}, "Benevolent")){
+        cerr << "[Driver] Could not start the game on Africa.map\n";
+        return;
+    }
+
+    speculating.setStalemateRules(StalemateRules{window, StalemateResolution::Draw});
+
+    int turn = speculating.getTurn();
+    bool restored = true;
+
+    for(int t = 0; t < 2 * window; t++){
+
+        speculating.checkpoint();
+        playUntilEndOfTurn(speculating);
+        speculating.rollback();
+        speculating.setTurn(turn);
+        speculating.setState(EngineState::AssignReinforcement);
+
+        const StalemateStats& stats = speculating.getStalemateStats();
+        restored = restored && stats.turnsTracked == 0 && stats.turnsWithoutProgress == 0;
+
+    }
+
+    StepStatus afterSpeculation = speculating.runFor(500, true);
+
+    reportCheck("rollback restores stalemate tracking", restored && speculating.getState() == EngineState::Win
+                && speculating.getStalemateStats().declared && afterSpeculation.turnsCompleted == window);
+
+    cout << "\n=============================================\n";
+    cout << "      END OF STALEMATE DETECTION TEST        \n";
+    cout << "=============================================\n\n";
+}
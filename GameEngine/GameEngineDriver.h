@@ -35,3 +35,79 @@ void testMainGameLoop();
  * After the simulation ends, the user is prompted to play again or exit.
  */
 void mainGameLoop();
+
+/**
+ * @brief Checks speculative execution: nested checkpoints rolled back restore the board, owned territories,
+ * truces and continent scores, and rolling back a turn that eliminated a player brings the player back.
+ */
+void testCheckpointRollback();
+
+/**
+ * @brief Records a seeded silent game, replays the recording in a fresh engine and checks that the board
+ * matched the recording after every turn, with sequential and with parallel order execution.
+ */
+void testReplayRoundTrip();
+
+/**
+ * @brief Saves a game in the middle of a turn, loads it into a fresh engine and compares owners, armies, hands,
+ * pending orders, truces, turn order, state and step. Also checks that a truncated checkpoint file and a checkpoint
+ * whose map file changed since it was saved are rejected.
+ */
+void testSaveLoadCheckpoint();
+
+/**
+ * @brief Executes the same issued orders with parallel and with sequential order execution, over several seeded
+ * turns, and checks that both leave the same board. The parallel engine runs every batch of two or more orders
+ * on its worker threads, and the test checks that some did.
+ */
+void testParallelExecution();
+
+/**
+ * @brief Copies a game in the middle of a turn on Palmerica.map, times the copy, and checks that the copy and
+ * its source can then be played and mutated without either one seeing the other's changes.
+ */
+void testEngineCopy();
+
+/**
+ * @brief Issues every turn of a seeded game twice from the same copied state, once sequentially and once with
+ * parallel issuing, and checks that both give the same order lists, hands and deck.
+ */
+void testParallelIssue();
+
+/**
+ * @brief Issues every turn of seeded single-strategy games twice from the same copied state, once through each
+ * player's strategy and once through GameEngine::issueOrdersPhaseWith, and checks that both give the same orders.
+ */
+void testStaticDispatchIssue();
+
+/**
+ * @brief Collects order statistics over a few turns of a seeded Aggressive game and checks that every executed
+ * order was counted under its type, that battles were recorded, and that copies and resets start from zero.
+ */
+void testOrderStats();
+
+/**
+ * @brief Starts seeded games on several maps with balanced territory assignment and checks that, in every continent,
+ * the players' territory counts differ by at most 1, and that the same seed deals the same setup.
+ */
+void testBalancedAssignment();
+
+/**
+ * @brief Loads the same map file into several engines and checks that later loads come from the MapRegistry and share
+ * the first load's topology and routing table, and that a file edited after it was registered is parsed again.
+ */
+void testMapRegistry();
+
+/**
+ * @brief Runs seeded silent games and one game with a Human player on a GameScheduler, checks that waitAll() returns
+ * with every silent game finished and the Human game suspended before its issue orders phase, and that every finished
+ * board matches the same game run sequentially with runFor().
+ */
+void testGameScheduler();
+
+/**
+ * @brief Plays two-player Benevolent games on Africa.map with stalemate detection on, and checks that the game is
+ * declared a draw once the window is full, that Adjudicate names the expected winner, and that turns rolled back
+ * with rollback() never count toward the window.
+ */
+void testStalemateDetection();
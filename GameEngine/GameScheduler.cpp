@@ -0,0 +1,300 @@
+#include "GameScheduler.h"
+
+#include <algorithm>
+
+namespace WarzoneEngine {
+
+    GameScheduler::GameScheduler(unsigned int numWorkers, chrono::microseconds slice)
+        : slice(slice), queuedCount(0), activeCount(0), nextQueue(0), stopping(false), stealCount(0) {
+
+        if(numWorkers == 0) { numWorkers = max(1u, thread::hardware_concurrency()); }
+
+        for(unsigned int w = 0; w < numWorkers; w++) { queues.push_back(make_unique<WorkerQueue>()); }
+
+        //Queues exist before any worker starts, workers only ever read the vector
+        for(unsigned int w = 0; w < numWorkers; w++) { workers.emplace_back(&GameScheduler::workerLoop, this, static_cast<size_t>(w)); }
+
+    }
+
+    GameScheduler::~GameScheduler() {
+
+        {
+
+            lock_guard<mutex> lock(stateMutex);
+            stopping = true;
+
+        }
+
+        workAvailable.notify_all();
+        for(thread& w : workers) { w.join(); }
+
+    }
+
+    //-- Class Methods --//
+
+    size_t GameScheduler::submit(GameEngine* game) {
+
+        size_t id;
+        size_t queue;
+
+        {
+
+            lock_guard<mutex> lock(stateMutex);
+
+            id = games.size();
+            games.push_back(make_unique<ScheduledGame>(ScheduledGame{game, ScheduledGameStatus::Queued, StepStatus{}}));
+            activeCount++;
+            queue = nextQueue++ % queues.size();
+
+        }
+
+        enqueue(id, queue, false);
+        return id;
+
+    }
+
+    StepStatus GameScheduler::runSuspended(size_t id, bool surpressOutput) {
+
+        ScheduledGame* entry = nullptr;
+
+        {
+
+            lock_guard<mutex> lock(stateMutex);
+
+            if(id >= games.size() || games[id] -> status != ScheduledGameStatus::Suspended) {
+                return StepStatus{StepOutcome::NotInGameplay, EngineState::Start, TurnStep::Reinforcement, 0, 0, 0};
+            }
+
+            entry = games[id].get();
+            entry -> status = ScheduledGameStatus::Running;
+            activeCount++;
+
+        }
+
+        //The caller's thread is the one allowed to block on cin
+        StepStatus status = entry -> game -> stepPhase(surpressOutput);
+        bool suspended = status.outcome == StepOutcome::Running && entry -> game -> awaitsConsoleInput();
+        bool requeue = !suspended && status.outcome == StepOutcome::Running;
+
+        {
+
+            lock_guard<mutex> lock(stateMutex);
+
+            entry -> lastStatus = status;
+
+            if(requeue) { entry -> status = ScheduledGameStatus::Queued; }
+            else {
+
+                entry -> status = suspended ? ScheduledGameStatus::Suspended : ScheduledGameStatus::Finished;
+                activeCount--;
+
+            }
+
+        }
+
+        if(requeue) { enqueue(id, id % queues.size(), false); }
+        else { allSettled.notify_all(); }
+
+        return status;
+
+    }
+
+    void GameScheduler::waitAll() {
+
+        unique_lock<mutex> lock(stateMutex);
+        allSettled.wait(lock, [this]() { return activeCount == 0; });
+
+    }
+
+    //-- Accessors --//
+
+    ScheduledGameStatus GameScheduler::getStatus(size_t id) const {
+
+        lock_guard<mutex> lock(stateMutex);
+        return id < games.size() ? games[id] -> status : ScheduledGameStatus::Finished;
+
+    }
+
+    StepStatus GameScheduler::getLastStatus(size_t id) const {
+
+        lock_guard<mutex> lock(stateMutex);
+        return id < games.size() ? games[id] -> lastStatus : StepStatus{};
+
+    }
+
+    vector<size_t> GameScheduler::getSuspended() const {
+
+        lock_guard<mutex> lock(stateMutex);
+
+        vector<size_t> suspended;
+        for(size_t id = 0; id < games.size(); id++) {
+
+            if(games[id] -> status == ScheduledGameStatus::Suspended) { suspended.push_back(id); }
+
+        }
+
+        return suspended;
+
+    }
+
+    size_t GameScheduler::getWorkerCount() const { return workers.size(); }
+
+    size_t GameScheduler::getStealCount() const { return stealCount.load(memory_order_relaxed); }
+
+    //-- Private Helpers --//
+
+    void GameScheduler::enqueue(size_t id, size_t queue, bool front) {
+
+        //Counted before it is published, so a thief's queuedCount-- can never run first and wrap the counter
+        {
+
+            lock_guard<mutex> lock(stateMutex);
+            queuedCount++;
+
+        }
+
+        {
+
+            lock_guard<mutex> lock(queues[queue] -> queueMutex);
+            if(front) { queues[queue] -> games.push_front(id); }
+            else { queues[queue] -> games.push_back(id); }
+
+        }
+
+        workAvailable.notify_one();
+
+    }
+
+    bool GameScheduler::takeWork(size_t worker, size_t& id) {
+
+        bool found = false;
+
+        {
+
+            lock_guard<mutex> lock(queues[worker] -> queueMutex);
+            deque<size_t>& own = queues[worker] -> games;
+
+            if(!own.empty()) {
+
+                id = own.back();
+                own.pop_back();
+                found = true;
+
+            }
+
+        }
+
+        //Own queue empty: steal the oldest game of the next worker that has one
+        for(size_t k = 1; !found && k < queues.size(); k++) {
+
+            WorkerQueue& victim = *queues[(worker + k) % queues.size()];
+            lock_guard<mutex> lock(victim.queueMutex);
+
+            if(!victim.games.empty()) {
+
+                id = victim.games.front();
+                victim.games.pop_front();
+                found = true;
+                stealCount.fetch_add(1, memory_order_relaxed);
+
+            }
+
+        }
+
+        if(found) {
+
+            lock_guard<mutex> lock(stateMutex);
+            queuedCount--;
+
+        }
+
+        return found;
+
+    }
+
+    void GameScheduler::runSlice(size_t worker, size_t id) {
+
+        ScheduledGame* entry;
+
+        {
+
+            lock_guard<mutex> lock(stateMutex);
+            entry = games[id].get();
+            entry -> status = ScheduledGameStatus::Running;
+
+        }
+
+        GameEngine* game = entry -> game;
+        chrono::steady_clock::time_point deadline = chrono::steady_clock::now() + slice;
+
+        StepStatus status{};
+        bool ranPhase = false;
+        bool suspended = false;
+
+        //Whole phases only, so the game always pauses on a phase boundary
+        do {
+
+            if(game -> awaitsConsoleInput()) {
+
+                suspended = true;
+                break;
+
+            }
+
+            status = game -> stepPhase(true);
+            ranPhase = true;
+
+        } while(status.outcome == StepOutcome::Running && chrono::steady_clock::now() < deadline);
+
+        bool requeue = !suspended && status.outcome == StepOutcome::Running;
+
+        {
+
+            lock_guard<mutex> lock(stateMutex);
+
+            if(ranPhase) { entry -> lastStatus = status; }
+
+            if(requeue) { entry -> status = ScheduledGameStatus::Queued; }
+            else {
+
+                entry -> status = suspended ? ScheduledGameStatus::Suspended : ScheduledGameStatus::Finished;
+                activeCount--;
+
+            }
+
+        }
+
+        //Back behind this worker's other games, where thieves look first
+        if(requeue) { enqueue(id, worker, true); }
+        else { allSettled.notify_all(); }
+
+    }
+
+    void GameScheduler::workerLoop(size_t worker) {
+
+        while(true) {
+
+            {
+
+                lock_guard<mutex> lock(stateMutex);
+                if(stopping) { return; }
+
+            }
+
+            size_t id;
+            if(takeWork(worker, id)) {
+
+                runSlice(worker, id);
+                continue;
+
+            }
+
+            unique_lock<mutex> lock(stateMutex);
+            workAvailable.wait(lock, [this]() { return stopping || queuedCount > 0; });
+            if(stopping) { return; }
+
+        }
+
+    }
+
+}
@@ -0,0 +1,185 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "GameEngine.h"
+
+using namespace std;
+
+namespace WarzoneEngine {
+
+    /**
+     * @brief Where a game handed to a GameScheduler stands.
+     */
+    enum class ScheduledGameStatus {
+        Queued,         //Waiting in a worker's queue
+        Running,        //A worker is stepping it
+        Suspended,      //Waiting for console input, see GameScheduler::runSuspended()
+        Finished        //Reached Win, or was not in gameplay when its turn came
+    };
+
+    // ================= GameScheduler ================= //
+    /**
+     * @class GameScheduler
+     * @brief Multiplexes many started games over a fixed pool of worker threads.
+     *
+     * Games are resumable state machines (GameEngine::stepPhase()), so a worker runs a game for one time slice,
+     * always ending on a phase boundary, then puts it back at the front of its queue and moves on to the next one.
+     * Every worker owns a queue: it takes work from the back of its own queue and, once that is empty,
+     * steals from the front of the others, so long and short games balance out across the pool.
+     *
+     * A phase always runs entirely on one worker, so the per-thread battle seed set at the start of the
+     * execute orders phase stays valid for the whole phase whichever worker picked the game up.
+     *
+     * A game whose next phase would read the console (a human player issuing orders) is never run on a worker:
+     * it is suspended instead, and goes back to the pool once runSuspended() has run that phase on the caller's thread.
+     * Games are not owned and must outlive the scheduler; they must not share observers with each other.
+     */
+    class GameScheduler {
+
+        private:
+
+            struct ScheduledGame {
+
+                GameEngine* game;
+                ScheduledGameStatus status;
+                StepStatus lastStatus;
+
+            };
+
+            struct WorkerQueue {
+
+                deque<size_t> games; //Game ids, the owner works from the back, thieves take from the front
+                mutex queueMutex;
+
+            };
+
+            chrono::microseconds slice; //Time a worker spends on a game before switching, at least one phase
+            vector<unique_ptr<ScheduledGame>> games; //By game id
+            vector<unique_ptr<WorkerQueue>> queues; //One per worker
+            vector<thread> workers;
+
+            mutable mutex stateMutex; //Guards games, the counters and both condition variables
+            condition_variable workAvailable;
+            condition_variable allSettled;
+            size_t queuedCount; //Ids in the queues, plus ids about to be pushed (never fewer than the queues hold)
+            size_t activeCount; //Queued or running games
+            size_t nextQueue; //Queue the next submitted game goes to, round robin
+            bool stopping;
+
+            atomic<size_t> stealCount;
+
+            /**
+             * @brief Queues a game id on a worker's queue and wakes an idle worker
+             * @param id Game id
+             * @param queue Worker queue index
+             * @param front true to queue behind the owner's current work (games coming back from a slice)
+             */
+            void enqueue(size_t id, size_t queue, bool front);
+
+            /**
+             * @brief Takes the next game id for a worker: its own newest, or the oldest of another worker's queue
+             * @param worker Worker index
+             * @param id Set to the game id
+             * @return false if every queue is empty
+             */
+            bool takeWork(size_t worker, size_t& id);
+
+            /**
+             * @brief Runs one slice of a game and queues, suspends or finishes it
+             * @param worker Worker index
+             * @param id Game id
+             */
+            void runSlice(size_t worker, size_t id);
+
+            /**
+             * @brief Worker thread body
+             * @param worker Worker index
+             */
+            void workerLoop(size_t worker);
+
+        public:
+
+            //-- Constructors, Destructor --//
+
+            /**
+             * @brief Starts the worker pool
+             * @param numWorkers Worker threads, 0 for one per hardware thread
+             * @param slice Time a worker spends on a game before switching to another one
+             */
+            explicit GameScheduler(unsigned int numWorkers = 0, chrono::microseconds slice = chrono::microseconds(2000));
+
+            /**
+             * @brief Stops the workers once their current slice ends. Unfinished games are left where they are.
+             */
+            ~GameScheduler();
+
+            GameScheduler(const GameScheduler&) = delete;
+            GameScheduler& operator=(const GameScheduler&) = delete;
+
+            //-- Class Methods --//
+
+            /**
+             * @brief Hands a started game to the pool
+             * @param game Game past gamestart, not owned. It must not be stepped elsewhere while scheduled.
+             * @return Game id
+             */
+            size_t submit(GameEngine* game);
+
+            /**
+             * @brief Runs the phase a suspended game is waiting on, on the calling thread, then returns it to the pool
+             * @param id Game id
+             * @param surpressOutput Suppresses console output when true (prompts are still printed)
+             * @return Status after the phase; NotInGameplay without running anything if the game is not suspended
+             */
+            StepStatus runSuspended(size_t id, bool surpressOutput);
+
+            /**
+             * @brief Blocks until no game is queued or running, so every game is finished or suspended
+             */
+            void waitAll();
+
+            //-- Accessors --//
+
+            /**
+             * @brief Where a game stands
+             * @param id Game id
+             * @return Status
+             */
+            ScheduledGameStatus getStatus(size_t id) const;
+
+            /**
+             * @brief Status returned by the last phase run for a game
+             * @param id Game id
+             * @return Step status
+             */
+            StepStatus getLastStatus(size_t id) const;
+
+            /**
+             * @brief Games waiting for console input
+             * @return Game ids
+             */
+            vector<size_t> getSuspended() const;
+
+            /**
+             * @brief Number of worker threads
+             * @return Worker count
+             */
+            size_t getWorkerCount() const;
+
+            /**
+             * @brief Number of times a worker took a game from another worker's queue
+             * @return Steal count
+             */
+            size_t getStealCount() const;
+
+    };
+
+}
@@ -0,0 +1,221 @@
+#include "Replay.h"
+
+namespace WarzoneEngine {
+
+    // ================= ReplayWriter ================= //
+
+    void ReplayWriter::writeRaw(const void* data, size_t size) {
+
+        out.write(static_cast<const char*>(data), static_cast<streamsize>(size));
+
+    }
+
+    bool ReplayWriter::open(const string& path) {
+
+        if(out.is_open()) { out.close(); }
+
+        out.open(path, ios::binary | ios::trunc);
+        return out.is_open();
+
+    }
+
+    bool ReplayWriter::isOpen() const { return out.is_open(); }
+
+    void ReplayWriter::close() {
+
+        if(out.is_open()) {
+
+            out.flush();
+            out.close();
+
+        }
+
+    }
+
+    void ReplayWriter::writeHeader(uint32_t rngSeed, const string& mapPath, const vector<string>& playerNames) {
+
+        writeRaw(&REPLAY_MAGIC, sizeof(REPLAY_MAGIC));
+        writeRaw(&REPLAY_VERSION, sizeof(REPLAY_VERSION));
+        writeRaw(&rngSeed, sizeof(rngSeed));
+
+        uint32_t length = static_cast<uint32_t>(mapPath.size());
+        writeRaw(&length, sizeof(length));
+        writeRaw(mapPath.data(), length);
+
+        uint16_t numPlayers = static_cast<uint16_t>(playerNames.size());
+        writeRaw(&numPlayers, sizeof(numPlayers));
+
+        for(const string& name : playerNames) {
+
+            length = static_cast<uint32_t>(name.size());
+            writeRaw(&length, sizeof(length));
+            writeRaw(name.data(), length);
+
+        }
+
+    }
+
+    void ReplayWriter::writeBoard(const ReplayBoard& board) {
+
+        out.put(REPLAY_CHUNK_BOARD);
+
+        uint32_t numTerritories = static_cast<uint32_t>(board.owners.size());
+        writeRaw(&numTerritories, sizeof(numTerritories));
+        writeRaw(board.owners.data(), numTerritories * sizeof(uint16_t));
+        writeRaw(board.armies.data(), numTerritories * sizeof(int32_t));
+
+    }
+
+    void ReplayWriter::writeTurn(const ReplayTurn& turn) {
+
+        out.put(REPLAY_CHUNK_TURN);
+
+        writeRaw(&turn.turn, sizeof(turn.turn));
+        writeRaw(&turn.battleSeed, sizeof(turn.battleSeed));
+
+        uint16_t queueSize = static_cast<uint16_t>(turn.queue.size());
+        writeRaw(&queueSize, sizeof(queueSize));
+        writeRaw(turn.queue.data(), queueSize * sizeof(uint16_t));
+
+        //One order count per queued player, then the orders field by field (no struct padding on disk)
+        for(const vector<ReplayOrder>& orders : turn.orders) {
+
+            uint32_t numOrders = static_cast<uint32_t>(orders.size());
+            writeRaw(&numOrders, sizeof(numOrders));
+
+            for(const ReplayOrder& order : orders) {
+
+                writeRaw(&order.type, sizeof(order.type));
+                writeRaw(&order.issuer, sizeof(order.issuer));
+                writeRaw(&order.targetPlayer, sizeof(order.targetPlayer));
+                writeRaw(&order.source, sizeof(order.source));
+                writeRaw(&order.target, sizeof(order.target));
+                writeRaw(&order.numArmies, sizeof(order.numArmies));
+
+            }
+
+        }
+
+    }
+
+    void ReplayWriter::writeBoardHash(uint64_t hash) {
+
+        out.put(REPLAY_CHUNK_HASH);
+        writeRaw(&hash, sizeof(hash));
+
+    }
+
+    // ================= ReplayReader ================= //
+
+    bool ReplayReader::readRaw(void* data, size_t size) {
+
+        in.read(static_cast<char*>(data), static_cast<streamsize>(size));
+        return static_cast<size_t>(in.gcount()) == size;
+
+    }
+
+    bool ReplayReader::open(const string& path) {
+
+        if(in.is_open()) { in.close(); }
+
+        in.open(path, ios::binary);
+        return in.is_open();
+
+    }
+
+    bool ReplayReader::readHeader(uint32_t& rngSeed, string& mapPath, vector<string>& playerNames) {
+
+        uint32_t magic = 0;
+        uint16_t version = 0;
+
+        if(!readRaw(&magic, sizeof(magic)) || magic != REPLAY_MAGIC) { return false; }
+        if(!readRaw(&version, sizeof(version)) || version != REPLAY_VERSION) { return false; }
+        if(!readRaw(&rngSeed, sizeof(rngSeed))) { return false; }
+
+        uint32_t length = 0;
+        if(!readRaw(&length, sizeof(length))) { return false; }
+        mapPath.assign(length, '\0');
+        if(length > 0 && !readRaw(&mapPath[0], length)) { return false; }
+
+        uint16_t numPlayers = 0;
+        if(!readRaw(&numPlayers, sizeof(numPlayers))) { return false; }
+
+        playerNames.assign(numPlayers, "");
+        for(string& name : playerNames) {
+
+            if(!readRaw(&length, sizeof(length))) { return false; }
+            name.assign(length, '\0');
+            if(length > 0 && !readRaw(&name[0], length)) { return false; }
+
+        }
+
+        return true;
+
+    }
+
+    char ReplayReader::nextChunk() {
+
+        char tag = 0;
+        if(!in.get(tag)) { return 0; }
+
+        return tag;
+
+    }
+
+    bool ReplayReader::readBoard(ReplayBoard& board) {
+
+        uint32_t numTerritories = 0;
+        if(!readRaw(&numTerritories, sizeof(numTerritories))) { return false; }
+
+        board.owners.resize(numTerritories);
+        board.armies.resize(numTerritories);
+
+        return readRaw(board.owners.data(), numTerritories * sizeof(uint16_t)) &&
+               readRaw(board.armies.data(), numTerritories * sizeof(int32_t));
+
+    }
+
+    bool ReplayReader::readTurn(ReplayTurn& turn) {
+
+        if(!readRaw(&turn.turn, sizeof(turn.turn))) { return false; }
+        if(!readRaw(&turn.battleSeed, sizeof(turn.battleSeed))) { return false; }
+
+        uint16_t queueSize = 0;
+        if(!readRaw(&queueSize, sizeof(queueSize))) { return false; }
+
+        turn.queue.resize(queueSize);
+        if(!readRaw(turn.queue.data(), queueSize * sizeof(uint16_t))) { return false; }
+
+        turn.orders.assign(queueSize, vector<ReplayOrder>());
+        for(vector<ReplayOrder>& orders : turn.orders) {
+
+            uint32_t numOrders = 0;
+            if(!readRaw(&numOrders, sizeof(numOrders))) { return false; }
+
+            orders.resize(numOrders);
+            for(ReplayOrder& order : orders) {
+
+                bool ok = readRaw(&order.type, sizeof(order.type)) &&
+                          readRaw(&order.issuer, sizeof(order.issuer)) &&
+                          readRaw(&order.targetPlayer, sizeof(order.targetPlayer)) &&
+                          readRaw(&order.source, sizeof(order.source)) &&
+                          readRaw(&order.target, sizeof(order.target)) &&
+                          readRaw(&order.numArmies, sizeof(order.numArmies));
+
+                if(!ok) { return false; }
+
+            }
+
+        }
+
+        return true;
+
+    }
+
+    bool ReplayReader::readBoardHash(uint64_t& hash) {
+
+        return readRaw(&hash, sizeof(hash));
+
+    }
+
+}
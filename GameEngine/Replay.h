@@ -0,0 +1,186 @@
+#pragma once
+
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <vector>
+
+using namespace std;
+
+namespace WarzoneEngine {
+
+    //File identification, "WZRP" read as a little-endian integer
+    const uint32_t REPLAY_MAGIC = 0x50525A57;
+    const uint16_t REPLAY_VERSION = 1;
+
+    //Player id standing for "no player" (unowned territory, order without target player)
+    const uint16_t REPLAY_NO_PLAYER = UINT16_MAX;
+
+    //Chunk tags following the header
+    const char REPLAY_CHUNK_BOARD = 'B';
+    const char REPLAY_CHUNK_TURN = 'T';
+    const char REPLAY_CHUNK_HASH = 'H';
+
+    /**
+     * @struct ReplayOrder
+     * @brief One issued order, territories by dense index and players by replay id
+     */
+    struct ReplayOrder {
+
+        uint8_t type;          //WarzoneOrder::OrderType value
+        uint16_t issuer;
+        uint16_t targetPlayer; //REPLAY_NO_PLAYER if the order has none
+        int32_t source;
+        int32_t target;
+        int32_t numArmies;
+
+    };
+
+    /**
+     * @struct ReplayBoard
+     * @brief Owner and army count of every territory, by dense index
+     */
+    struct ReplayBoard {
+
+        vector<uint16_t> owners;
+        vector<int32_t> armies;
+
+    };
+
+    /**
+     * @struct ReplayTurn
+     * @brief Everything the execute orders phase of one turn consumes
+     */
+    struct ReplayTurn {
+
+        int32_t turn;
+        uint64_t battleSeed;
+        vector<uint16_t> queue;              //Round-robin order of the players
+        vector<vector<ReplayOrder>> orders;  //Issued orders of each queued player, in list order
+
+    };
+
+    // ================= ReplayWriter ================= //
+    /**
+     * @class ReplayWriter
+     * @brief Writes a replay file: a header (seed, map path, player names), then board, turn and hash chunks.
+     *
+     * Values are written in host byte order; replays are meant to be read back on the same kind of machine.
+     */
+    class ReplayWriter {
+
+        private:
+
+            ofstream out;
+
+            void writeRaw(const void* data, size_t size);
+
+        public:
+
+            /**
+             * @brief Creates (or truncates) the replay file
+             * @param path File path
+             * @return true if the file could be opened
+             */
+            bool open(const string& path);
+
+            /**
+             * @brief Whether a file is open for writing
+             * @return true if open
+             */
+            bool isOpen() const;
+
+            /**
+             * @brief Flushes and closes the file
+             */
+            void close();
+
+            /**
+             * @brief Writes the file header, must come first
+             * @param rngSeed Game seed
+             * @param mapPath Path of the map file the game was loaded from
+             * @param playerNames Player names, indexed by replay id
+             */
+            void writeHeader(uint32_t rngSeed, const string& mapPath, const vector<string>& playerNames);
+
+            /**
+             * @brief Writes a full board snapshot
+             * @param board Owners and armies of every territory
+             */
+            void writeBoard(const ReplayBoard& board);
+
+            /**
+             * @brief Writes the orders of one turn
+             * @param turn Turn to write
+             */
+            void writeTurn(const ReplayTurn& turn);
+
+            /**
+             * @brief Writes the board hash reached after executing the last written turn
+             * @param hash Board hash (see GameEngine::boardHash())
+             */
+            void writeBoardHash(uint64_t hash);
+
+    };
+
+    // ================= ReplayReader ================= //
+    /**
+     * @class ReplayReader
+     * @brief Reads back a file written by ReplayWriter, chunk by chunk
+     */
+    class ReplayReader {
+
+        private:
+
+            ifstream in;
+
+            bool readRaw(void* data, size_t size);
+
+        public:
+
+            /**
+             * @brief Opens a replay file
+             * @param path File path
+             * @return true if the file could be opened
+             */
+            bool open(const string& path);
+
+            /**
+             * @brief Reads and checks the header
+             * @param rngSeed Set to the game seed
+             * @param mapPath Set to the map path
+             * @param playerNames Set to the player names, indexed by replay id
+             * @return false if the file is not a replay, or has an unsupported version
+             */
+            bool readHeader(uint32_t& rngSeed, string& mapPath, vector<string>& playerNames);
+
+            /**
+             * @brief Reads the tag of the next chunk
+             * @return REPLAY_CHUNK_BOARD, REPLAY_CHUNK_TURN or REPLAY_CHUNK_HASH, 0 at the end of the file
+             */
+            char nextChunk();
+
+            /**
+             * @brief Reads a board chunk body
+             * @param board Filled with the snapshot
+             * @return false if the file is truncated
+             */
+            bool readBoard(ReplayBoard& board);
+
+            /**
+             * @brief Reads a turn chunk body
+             * @param turn Filled with the turn
+             * @return false if the file is truncated
+             */
+            bool readTurn(ReplayTurn& turn);
+
+            /**
+             * @brief Reads a hash chunk body
+             * @param hash Set to the recorded board hash
+             * @return false if the file is truncated
+             */
+            bool readBoardHash(uint64_t& hash);
+
+    };
+
+}
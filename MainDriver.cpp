@@ -24,6 +24,19 @@ int main(){
         cout << "3. Test Main Game Loop" << endl;
         cout << "4. Test Order Execution" << endl;
         cout << "5. Test Observer Class" << endl;
+        cout << "6. Test Checkpoint and Rollback" << endl;
+        cout << "7. Test Replay Round Trip" << endl;
+        cout << "8. Test Save and Load Checkpoint" << endl;
+        cout << "9. Test Parallel Order Execution" << endl;
+        cout << "10. Test Territory Queries" << endl;
+        cout << "11. Test Engine Copy" << endl;
+        cout << "12. Test Parallel Order Issuing" << endl;
+        cout << "13. Test Static Dispatch Order Issuing" << endl;
+        cout << "14. Test Order Statistics" << endl;
+        cout << "15. Test Balanced Assignment" << endl;
+        cout << "16. Test Map Registry" << endl;
+        cout << "17. Test Game Scheduler" << endl;
+        cout << "18. Test Stalemate Detection" << endl;
         cout << "0. Exit" << endl;
         cout << "-------------------------------------------" << endl;
         cout << "Select an option: ";
@@ -58,6 +71,58 @@ int main(){
                 testLoggingObserver();
                 break;
 
+            case 6:
+                testCheckpointRollback();
+                break;
+
+            case 7:
+                testReplayRoundTrip();
+                break;
+
+            case 8:
+                testSaveLoadCheckpoint();
+                break;
+
+            case 9:
+                testParallelExecution();
+                break;
+
+            case 10:
+                testTerritoryQueries();
+                break;
+
+            case 11:
+                testEngineCopy();
+                break;
+
+            case 12:
+                testParallelIssue();
+                break;
+
+            case 13:
+                testStaticDispatchIssue();
+                break;
+
+            case 14:
+                testOrderStats();
+                break;
+
+            case 15:
+                testBalancedAssignment();
+                break;
+
+            case 16:
+                testMapRegistry();
+                break;
+
+            case 17:
+                testGameScheduler();
+                break;
+
+            case 18:
+                testStalemateDetection();
+                break;
+
             case 0:
                 cout << "Exiting program..." << endl;
                 return 0;
@@ -0,0 +1,297 @@
+#include "CompiledMap.h"
+
+#include <cstring>
+#include <fstream>
+#include <unordered_map>
+#include <vector>
+
+#include "Map.h"
+
+namespace WarzoneMap {
+
+    namespace {
+
+        //File offset of every section, derived from the header counts
+        struct CompiledMapLayout {
+
+            uint64_t continents, territories, neighbors, members, hopDistance, nextHop, strings, end;
+
+        };
+
+        uint64_t align8(uint64_t offset) { return (offset + 7) & ~static_cast<uint64_t>(7); }
+
+        CompiledMapLayout layoutOf(const CompiledMapHeader& h) {
+
+            uint64_t routingEntries = h.hasRouting != 0 ? static_cast<uint64_t>(h.numTerritories) * h.numTerritories : 0;
+
+            CompiledMapLayout layout;
+            layout.continents = align8(sizeof(CompiledMapHeader));
+            layout.territories = align8(layout.continents + static_cast<uint64_t>(h.numContinents) * sizeof(CompiledContinent));
+            layout.neighbors = align8(layout.territories + static_cast<uint64_t>(h.numTerritories) * sizeof(CompiledTerritory));
+            layout.members = align8(layout.neighbors + static_cast<uint64_t>(h.numNeighbors) * sizeof(uint32_t));
+            layout.hopDistance = align8(layout.members + static_cast<uint64_t>(h.numMembers) * sizeof(uint32_t));
+            layout.nextHop = align8(layout.hopDistance + routingEntries * sizeof(uint16_t));
+            layout.strings = align8(layout.nextHop + routingEntries * sizeof(uint16_t));
+            layout.end = layout.strings + h.stringBytes;
+
+            return layout;
+
+        }
+
+        //Whether [first, first + count) lies inside a section of size total
+        bool inRange(uint32_t first, uint32_t count, uint64_t total) {
+
+            return static_cast<uint64_t>(first) + count <= total;
+
+        }
+
+        CompiledString addString(string& strings, const string& s) {
+
+            CompiledString compiled = {static_cast<uint32_t>(strings.size()), static_cast<uint32_t>(s.size())};
+            strings += s;
+            return compiled;
+
+        }
+
+    }
+
+    bool writeCompiledMap(const string& path, const Map& map, uint64_t sourceHash, uint64_t sourceSize) {
+
+        const vector<Continent*>& mapContinents = map.getContinents();
+        const vector<Territory*>& mapTerritories = map.getTerritories();
+
+        unordered_map<const Continent*, int32_t> continentIndex;
+        for(size_t c = 0; c < mapContinents.size(); c++) { continentIndex[mapContinents[c]] = static_cast<int32_t>(c); }
+
+        CompiledMapHeader h = {};
+        string strings;
+        vector<CompiledContinent> continents;
+        vector<CompiledTerritory> territories;
+        vector<uint32_t> neighbors;
+        vector<uint32_t> members;
+
+        h.author = addString(strings, map.getAuthor());
+        h.image = addString(strings, map.getImage());
+        h.wrap = addString(strings, map.getWrap());
+        h.scrollType = addString(strings, map.getScrollType());
+        h.warn = addString(strings, map.getWarn());
+
+        const unordered_map<Continent*, long long>& hashSums = map.getContinentLookupTable();
+
+        for(Continent* c : mapContinents) {
+
+            CompiledContinent compiled = {};
+            compiled.name = addString(strings, c -> getID());
+            compiled.bonusValue = c -> getBonusValue();
+            compiled.firstMember = static_cast<uint32_t>(members.size());
+
+            for(Territory* t : c -> getTerritories()) { members.push_back(static_cast<uint32_t>(t -> getIndex())); }
+
+            compiled.numMembers = static_cast<uint32_t>(members.size()) - compiled.firstMember;
+
+            auto sum = hashSums.find(c);
+            compiled.territoryHashSum = sum != hashSums.end() ? sum -> second : 0;
+
+            continents.push_back(compiled);
+
+        }
+
+        for(Territory* t : mapTerritories) {
+
+            CompiledTerritory compiled = {};
+            compiled.name = addString(strings, t -> getID());
+            compiled.xCoord = t -> getXCoord();
+            compiled.yCoord = t -> getYCoord();
+            compiled.numericTerrID = t -> getNumericTerrID();
+
+            auto c = continentIndex.find(t -> getContinent());
+            compiled.continent = c != continentIndex.end() ? c -> second : -1;
+
+            compiled.firstNeighbor = static_cast<uint32_t>(neighbors.size());
+            for(Territory* n : t -> getNeighbors()) { neighbors.push_back(static_cast<uint32_t>(n -> getIndex())); }
+            compiled.numNeighbors = static_cast<uint32_t>(neighbors.size()) - compiled.firstNeighbor;
+
+            territories.push_back(compiled);
+
+        }
+
+        shared_ptr<const RoutingTable> routing = map.getRoutingTable();
+
+        h.magic = COMPILED_MAP_MAGIC;
+        h.version = COMPILED_MAP_VERSION;
+        h.hasRouting = routing != nullptr ? 1 : 0;
+        h.sourceHash = sourceHash;
+        h.sourceSize = sourceSize;
+        h.numContinents = static_cast<uint32_t>(continents.size());
+        h.numTerritories = static_cast<uint32_t>(territories.size());
+        h.numNeighbors = static_cast<uint32_t>(neighbors.size());
+        h.numMembers = static_cast<uint32_t>(members.size());
+        h.stringBytes = static_cast<uint32_t>(strings.size());
+
+        CompiledMapLayout layout = layoutOf(h);
+        h.fileSize = layout.end;
+
+        //Assembled in memory and written once, padding bytes stay zero
+        vector<uint8_t> image(layout.end, 0);
+
+        auto put = [&image](uint64_t offset, const void* bytes, size_t size) {
+
+            if(size > 0) { memcpy(image.data() + offset, bytes, size); }
+
+        };
+
+        put(0, &h, sizeof(h));
+        put(layout.continents, continents.data(), continents.size() * sizeof(CompiledContinent));
+        put(layout.territories, territories.data(), territories.size() * sizeof(CompiledTerritory));
+        put(layout.neighbors, neighbors.data(), neighbors.size() * sizeof(uint32_t));
+        put(layout.members, members.data(), members.size() * sizeof(uint32_t));
+
+        if(routing != nullptr) {
+
+            put(layout.hopDistance, routing -> hopDistance.data(), routing -> hopDistance.size() * sizeof(uint16_t));
+            put(layout.nextHop, routing -> nextHop.data(), routing -> nextHop.size() * sizeof(uint16_t));
+
+        }
+
+        put(layout.strings, strings.data(), strings.size());
+
+        ofstream out(path, ios::binary | ios::trunc);
+        if(!out.is_open()) { return false; }
+
+        out.write(reinterpret_cast<const char*>(image.data()), static_cast<streamsize>(image.size()));
+        out.flush();
+
+        return out.good();
+
+    }
+
+    // ================= CompiledMap ================= //
+
+    CompiledMap::CompiledMap()
+        : header(nullptr), continents(nullptr), territories(nullptr), neighbors(nullptr), members(nullptr),
+          hopDistance(nullptr), nextHop(nullptr), strings(nullptr) {}
+
+    bool CompiledMap::open(const string& path) {
+
+        close();
+
+        if(!file.open(path) || file.size() < sizeof(CompiledMapHeader)) {
+
+            close();
+            return false;
+
+        }
+
+        const uint8_t* base = file.data();
+        header = reinterpret_cast<const CompiledMapHeader*>(base);
+
+        if(header -> magic != COMPILED_MAP_MAGIC || header -> version != COMPILED_MAP_VERSION ||
+           header -> fileSize != file.size() || layoutOf(*header).end != file.size()) {
+
+            close();
+            return false;
+
+        }
+
+        //The mapping is page aligned and every section starts on 8 bytes, so the typed views are aligned
+        CompiledMapLayout layout = layoutOf(*header);
+        continents = reinterpret_cast<const CompiledContinent*>(base + layout.continents);
+        territories = reinterpret_cast<const CompiledTerritory*>(base + layout.territories);
+        neighbors = reinterpret_cast<const uint32_t*>(base + layout.neighbors);
+        members = reinterpret_cast<const uint32_t*>(base + layout.members);
+        strings = reinterpret_cast<const char*>(base + layout.strings);
+
+        if(header -> hasRouting != 0) {
+
+            hopDistance = reinterpret_cast<const uint16_t*>(base + layout.hopDistance);
+            nextHop = reinterpret_cast<const uint16_t*>(base + layout.nextHop);
+
+        }
+
+        if(!validate()) {
+
+            close();
+            return false;
+
+        }
+
+        return true;
+
+    }
+
+    void CompiledMap::close() {
+
+        file.close();
+        header = nullptr;
+        continents = nullptr;
+        territories = nullptr;
+        neighbors = nullptr;
+        members = nullptr;
+        hopDistance = nullptr;
+        nextHop = nullptr;
+        strings = nullptr;
+
+    }
+
+    bool CompiledMap::validate() const {
+
+        const CompiledMapHeader& h = *header;
+
+        auto isString = [&h](const CompiledString& s) { return inRange(s.offset, s.length, h.stringBytes); };
+
+        if(!isString(h.author) || !isString(h.image) || !isString(h.wrap) || !isString(h.scrollType) || !isString(h.warn)) { return false; }
+        if(h.hasRouting > 1 || (h.hasRouting != 0 && h.numTerritories > static_cast<uint32_t>(ROUTING_TABLE_MAX_TERRITORIES))) { return false; }
+
+        for(uint32_t c = 0; c < h.numContinents; c++) {
+
+            const CompiledContinent& continent = continents[c];
+
+            bool ok = isString(continent.name) && continent.name.length > 0 && continent.bonusValue > 0 &&
+                      inRange(continent.firstMember, continent.numMembers, h.numMembers);
+
+            if(!ok) { return false; }
+
+        }
+
+        for(uint32_t t = 0; t < h.numTerritories; t++) {
+
+            const CompiledTerritory& territory = territories[t];
+
+            bool ok = isString(territory.name) && territory.name.length > 0 &&
+                      territory.continent >= -1 && territory.continent < static_cast<int64_t>(h.numContinents) &&
+                      inRange(territory.firstNeighbor, territory.numNeighbors, h.numNeighbors);
+
+            if(!ok) { return false; }
+
+        }
+
+        for(uint32_t k = 0; k < h.numNeighbors; k++) {
+
+            if(neighbors[k] >= h.numTerritories) { return false; }
+
+        }
+
+        for(uint32_t k = 0; k < h.numMembers; k++) {
+
+            if(members[k] >= h.numTerritories) { return false; }
+
+        }
+
+        //Routing entries are hop counts or territory indices, anything else would send path walks out of bounds
+        if(h.hasRouting != 0) {
+
+            size_t entries = static_cast<size_t>(h.numTerritories) * h.numTerritories;
+
+            for(size_t k = 0; k < entries; k++) {
+
+                if(nextHop[k] >= h.numTerritories && hopDistance[k] != ROUTING_UNREACHABLE) { return false; }
+
+            }
+
+        }
+
+        return true;
+
+    }
+
+}
@@ -0,0 +1,175 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+
+#include "MappedFile.h"
+
+using namespace std;
+
+namespace WarzoneMap {
+
+    class Map; //Forward declaration
+
+    //File identification, "WZMP" read as a little-endian integer
+    const uint32_t COMPILED_MAP_MAGIC = 0x504D5A57;
+    const uint16_t COMPILED_MAP_VERSION = 1;
+
+    //Extension of a compiled map, stored next to the .map it was compiled from
+    const char* const COMPILED_MAP_EXTENSION = ".wzm";
+
+    /**
+     * @struct CompiledString
+     * @brief A string of the string section
+     */
+    struct CompiledString {
+
+        uint32_t offset;
+        uint32_t length;
+
+    };
+
+    /**
+     * @struct CompiledMapHeader
+     * @brief First bytes of a compiled map: the source it was built from, and the size of every section that follows.
+     *
+     * Sections follow in this order, each starting on an 8-byte boundary: continents (CompiledContinent),
+     * territories (CompiledTerritory, by dense index), neighbor indices (uint32_t), continent member indices (uint32_t),
+     * then, if hasRouting, the routing table's hop distances and next hops (uint16_t, N * N each), and the strings.
+     */
+    struct CompiledMapHeader {
+
+        uint32_t magic;
+        uint16_t version;
+        uint16_t hasRouting;            //1 if the all-pairs routing table is included
+        uint64_t fileSize;
+        uint64_t sourceHash;            //MappedFile::hashBytes() of the .map contents, a mismatch means the cache is stale
+        uint64_t sourceSize;
+        uint32_t numContinents;
+        uint32_t numTerritories;
+        uint32_t numNeighbors;          //Adjacency entries, both directions counted
+        uint32_t numMembers;            //Continent member entries
+        uint32_t stringBytes;
+        uint32_t reserved;
+        CompiledString author;
+        CompiledString image;
+        CompiledString wrap;
+        CompiledString scrollType;
+        CompiledString warn;
+
+    };
+
+    static_assert(sizeof(CompiledMapHeader) == 96, "CompiledMapHeader is part of the file format");
+
+    /**
+     * @struct CompiledContinent
+     * @brief One continent, with its members as a range of the member section
+     */
+    struct CompiledContinent {
+
+        CompiledString name;
+        int32_t bonusValue;
+        uint32_t firstMember;
+        uint32_t numMembers;
+        uint32_t reserved;
+        int64_t territoryHashSum;       //Map::getContinentLookupTable() value
+
+    };
+
+    static_assert(sizeof(CompiledContinent) == 32, "CompiledContinent is part of the file format");
+
+    /**
+     * @struct CompiledTerritory
+     * @brief One territory, with its neighbors as a range of the neighbor section
+     */
+    struct CompiledTerritory {
+
+        CompiledString name;
+        int32_t xCoord;
+        int32_t yCoord;
+        int32_t continent;              //Continent index, -1 if none
+        uint32_t firstNeighbor;
+        uint32_t numNeighbors;
+        uint32_t reserved;
+        int64_t numericTerrID;          //StringHandling::hashStringToNum() of the name
+
+    };
+
+    static_assert(sizeof(CompiledTerritory) == 40, "CompiledTerritory is part of the file format");
+
+    /**
+     * @brief Writes a loaded map as a compiled map file.
+     *
+     * Territory, continent, neighbor and member order are kept exactly, so a map loaded back from the file
+     * behaves the same as one parsed from the text. Values are written in host byte order.
+     * @param path File path, created or truncated
+     * @param map Map to write, with its routing table if it has one
+     * @param sourceHash MappedFile::hashBytes() of the .map contents
+     * @param sourceSize Size of the .map file
+     * @return false if the file could not be written
+     */
+    bool writeCompiledMap(const string& path, const Map& map, uint64_t sourceHash, uint64_t sourceSize);
+
+    // ================= CompiledMap ================= //
+    /**
+     * @class CompiledMap
+     * @brief Maps a compiled map file and validates it in place, then hands out typed views of its sections.
+     *
+     * open() checks the header, the section sizes and every index and range, so MapLoader can build the Map
+     * straight from the views. Views stay valid until the file is closed or the object destroyed.
+     */
+    class CompiledMap {
+
+        private:
+
+            MappedFile file;
+            const CompiledMapHeader* header;
+            const CompiledContinent* continents;
+            const CompiledTerritory* territories;
+            const uint32_t* neighbors;
+            const uint32_t* members;
+            const uint16_t* hopDistance;
+            const uint16_t* nextHop;
+            const char* strings;
+
+            bool validate() const;
+
+        public:
+
+            /**
+             * @brief Default constructor, nothing is open
+             */
+            CompiledMap();
+
+            /**
+             * @brief Maps and validates a compiled map file
+             * @param path File path
+             * @return false if the file cannot be read, is not a compiled map, has an unsupported version or is inconsistent
+             */
+            bool open(const string& path);
+
+            /**
+             * @brief Unmaps the file
+             */
+            void close();
+
+            //-- Section views, valid after a successful open() --//
+
+            const CompiledMapHeader& getHeader() const { return *header; }
+            const CompiledContinent* getContinents() const { return continents; }
+            const CompiledTerritory* getTerritories() const { return territories; }
+            const uint32_t* getNeighbors() const { return neighbors; }
+            const uint32_t* getMembers() const { return members; }
+            const uint16_t* getHopDistance() const { return hopDistance; } //nullptr without routing
+            const uint16_t* getNextHop() const { return nextHop; } //nullptr without routing
+
+            /**
+             * @brief A string of the string section
+             * @param s Offset and length
+             * @return Copy of the string
+             */
+            string getString(const CompiledString& s) const { return string(strings + s.offset, s.length); }
+
+    };
+
+}
@@ -1,5 +1,8 @@
 #include "Map.h"
 #include "../Player/Player.h"
+#include <algorithm>
+#include <atomic>
+#include <thread>
 
 using namespace std;
 
@@ -109,6 +112,71 @@ namespace WarzoneMap {
 
     }
 
+    // ================= StateJournal =================
+
+    thread_local StateJournal* StateJournal::active = nullptr;
+
+    StateJournal::StateJournal() {}
+
+    size_t StateJournal::size() const { return entries.size(); }
+
+    size_t StateJournal::getDepth() const { return checkpoints.size(); }
+
+    size_t StateJournal::checkpoint() {
+
+        checkpoints.push_back(entries.size());
+        return checkpoints.size();
+
+    }
+
+    bool StateJournal::rollback() {
+
+        if(checkpoints.empty()) { return false; }
+
+        size_t mark = checkpoints.back();
+        checkpoints.pop_back();
+
+        //Undo functions go through the normal setters, which must not record again
+        Scope silent(nullptr);
+
+        while(entries.size() > mark) {
+
+            JournalEntry entry = entries.back();
+            entries.pop_back();
+            entry.undo(entry);
+
+        }
+
+        return true;
+
+    }
+
+    bool StateJournal::commit() {
+
+        if(checkpoints.empty()) { return false; }
+
+        checkpoints.pop_back();
+        if(checkpoints.empty()) { entries.clear(); } //Nothing left to roll back to
+
+        return true;
+
+    }
+
+    void StateJournal::clear() {
+
+        entries.clear();
+        checkpoints.clear();
+
+    }
+
+    namespace {
+
+        void undoNumArmies(const JournalEntry& e) { static_cast<Territory*>(e.object) -> setNumArmies(static_cast<int>(e.value)); }
+
+        void undoOwner(const JournalEntry& e) { static_cast<Territory*>(e.object) -> setOwner(static_cast<Player*>(e.pointer)); }
+
+    }
+
     // ================= Continent =================
 
     //-- Constructors, Destructor, Copy Constructor, Assignment Operator, Stream Insertion Operator --//
@@ -216,6 +284,7 @@ namespace WarzoneMap {
         this -> owner = nullptr;
         this -> numArmies = 1;
         this -> numericTerrID = 0;
+        this -> index = -1;
 
     }
 
@@ -228,6 +297,7 @@ namespace WarzoneMap {
         this -> continent = nullptr; 
         this -> owner = nullptr;
         this -> numArmies = 1;
+        this -> index = -1;
         computeNumericTerrID();
 
     }
@@ -241,10 +311,25 @@ namespace WarzoneMap {
         this -> continent = continent; 
         this -> owner = nullptr;
         this -> numArmies = 1;
+        this -> index = -1;
         computeNumericTerrID();
 
     }
 
+    Territory::Territory(const string &ID, long long numericTerrID, int xCoord, int yCoord, Continent* continent) {
+
+        this -> ID = ID;
+        this -> xCoord = xCoord;
+        this -> yCoord = yCoord;
+        this -> neighbors = {};
+        this -> continent = continent; 
+        this -> owner = nullptr;
+        this -> numArmies = 1;
+        this -> numericTerrID = numericTerrID;
+        this -> index = -1;
+
+    }
+
     Territory::Territory(const string& ID, int xCoord, int yCoord, const vector<Territory*>& neighbors, Continent* continent, Player* owner, int numArmies) {
 
         this -> ID = ID;
@@ -254,6 +339,7 @@ namespace WarzoneMap {
         this -> continent = continent; 
         this -> owner = owner;
         this -> numArmies = numArmies;
+        this -> index = -1;
         computeNumericTerrID();
 
     }
@@ -275,6 +361,7 @@ namespace WarzoneMap {
         this -> owner = other.owner;
         this -> numArmies = other.numArmies;
         this -> numericTerrID = other.numericTerrID;
+        this -> index = other.index;
 
     }
 
@@ -290,6 +377,7 @@ namespace WarzoneMap {
             this -> owner = other.owner;
             this -> numArmies = other.numArmies;
             this -> numericTerrID = other.numericTerrID;
+            this -> index = other.index;
 
         }
 
@@ -343,13 +431,26 @@ namespace WarzoneMap {
     void Territory::setContinent(Continent* continent) { this -> continent = continent; }   
 
     Player* Territory::getOwner() const { return this -> owner; }
-    void Territory::setOwner(Player* owner) { this -> owner = owner; }
+    void Territory::setOwner(Player* owner) { 
+        
+        StateJournal::record(undoOwner, this, this -> owner, 0);
+        this -> owner = owner; 
+    
+    }
 
     int Territory::getNumArmies() const { return this -> numArmies; }
-    void Territory::setNumArmies(int numArmies) { this -> numArmies = numArmies; }
+    void Territory::setNumArmies(int numArmies) { 
+        
+        StateJournal::record(undoNumArmies, this, nullptr, this -> numArmies);
+        this -> numArmies = numArmies; 
+    
+    }
 
     long long WarzoneMap::Territory::getNumericTerrID() { return this -> numericTerrID; }
 
+    int Territory::getIndex() const { return this -> index; }
+    void Territory::setIndex(int index) { this -> index = index; }
+
     //-- Class Methods --//
 
     void Territory::addNeighbor(Territory* neighbor) { 
@@ -560,6 +661,13 @@ namespace WarzoneMap {
         this->continents = continents;
         this->continentLookupTable = continentLookupTable;
 
+        //Assign dense indices
+        for(size_t i = 0; i < this -> territories.size(); i++) {
+
+            if(this -> territories[i] != nullptr) { this -> territories[i] -> setIndex((int) i); }
+
+        }
+
     }
 
     Map::~Map() {
@@ -577,64 +685,7 @@ namespace WarzoneMap {
 
     }
 
-    Map::Map(const Map& other) {
-
-        // Copy metadata
-        this -> author = other.author;
-        this -> image = other.image;
-        this -> wrap = other.wrap;
-        this -> scrollType = other.scrollType;
-        this -> warn = other.warn;
-        this -> mapName = other.mapName;
-
-        // Deep copy continents
-        unordered_map<Continent*, Continent*> contMap;
-
-        for(Continent* c : other.continents) {
-
-            Continent* newCont = new Continent(*c);
-            this->continents.push_back(newCont);
-            contMap[c] = newCont;
-
-        }
-
-        // Deep copy territories
-        unordered_map<Territory*, Territory*> terrMap;
-        for (Territory* t : other.territories) {
-
-            Territory* newTerr = new Territory(*t);
-            this->territories.push_back(newTerr);
-            terrMap[t] = newTerr;
-
-        }
-
-        // Fix neighbors + continent pointers
-        for(Territory* oldTerr : other.territories) {
-
-            Territory* newTerr = terrMap[oldTerr];
-
-            // Neighbors
-            vector<Territory*> newNeighbors;
-            for(Territory* oldNeigh : oldTerr -> getNeighbors()) { newNeighbors.push_back(terrMap[oldNeigh]); }
-
-            newTerr->setNeighbors(newNeighbors);
-
-            // Continent
-            Continent* oldCont = oldTerr -> getContinent();
-            if(oldCont && contMap.count(oldCont)) {
-
-                Continent* newCont = contMap[oldCont];
-                newTerr->setContinent(newCont);
-                newCont->addTerritory(newTerr);
-
-            }
-
-        }
-
-        // Rebuild continent lookup
-        buildContinentHashmap();
-
-    }
+    Map::Map(const Map& other) { copyFrom(other); }
 
     Map& Map::operator=(const Map& other) {
 
@@ -649,60 +700,67 @@ namespace WarzoneMap {
             
             continentLookupTable.clear();
 
-            // Copy metadata
-            author = other.author;
-            image = other.image;
-            wrap = other.wrap;
-            scrollType = other.scrollType;
-            warn = other.warn;
-            mapName = other.mapName;
-
-            // Deep copy continents
-            unordered_map<Continent*, Continent*> contMap;
-            for(Continent* c : other.continents) {
+            // Drop BFS trees built for the old topology, copyFrom() shares other's caches
+            invalidateRoutingCache();
+            copyFrom(other);
 
-                Continent* newCont = new Continent(*c);
-                continents.push_back(newCont);
-                contMap[c] = newCont;
+        }
 
-            }
+        return *this;
 
-            // Deep copy territories
-            unordered_map<Territory*, Territory*> terrMap;
-            for(Territory* t : other.territories) {
+    }
 
-                Territory* newTerr = new Territory(*t);
-                territories.push_back(newTerr);
-                terrMap[t] = newTerr;
+    void Map::copyFrom(const Map& other) {
 
-            }
+        // Copy metadata
+        this -> author = other.author;
+        this -> image = other.image;
+        this -> wrap = other.wrap;
+        this -> scrollType = other.scrollType;
+        this -> warn = other.warn;
+        this -> mapName = other.mapName;
 
-            // Fix neighbors + continent pointers
-            for(Territory* oldTerr : other.territories) {
+        shared_ptr<const MapTopology> shared = other.getTopology();
 
-                Territory* newTerr = terrMap[oldTerr];
+        // Deep copy continents, same positions as in other
+        continents.reserve(other.continents.size());
+        for(Continent* c : other.continents) { continents.push_back(new Continent(*c)); }
 
-                vector<Territory*> newNeighbors;
-                for (Territory* oldNeigh : oldTerr -> getNeighbors()){ newNeighbors.push_back(terrMap[oldNeigh]); }
-                newTerr->setNeighbors(newNeighbors);
+        // Deep copy territories, same dense indices as in other
+        territories.reserve(other.territories.size());
+        for(Territory* t : other.territories) { territories.push_back(new Territory(*t)); }
 
-                Continent* oldCont = oldTerr -> getContinent();
-                if (oldCont && contMap.count(oldCont)) {
+        // Fix neighbors + continent pointers from the index form, no pointer hashing needed
+        vector<Territory*> newNeighbors;
+        for(size_t i = 0; i < territories.size(); i++) {
 
-                    Continent* newCont = contMap[oldCont];
-                    newTerr->setContinent(newCont);
-                    newCont->addTerritory(newTerr);
+            newNeighbors.clear();
+            for(int k = shared -> neighborOffsets[i]; k < shared -> neighborOffsets[i + 1]; k++) {
 
-                }
+                int neighbor = shared -> neighborIndices[k];
+                newNeighbors.push_back(neighbor >= 0 ? territories[neighbor] : nullptr);
 
             }
 
-            // Rebuild continent lookup
-            buildContinentHashmap();
+            territories[i] -> setNeighbors(newNeighbors);
+
+            if(shared -> continentOf[i] >= 0) { territories[i] -> setContinent(continents[shared -> continentOf[i]]); }
 
         }
 
-        return *this;
+        for(size_t c = 0; c < continents.size(); c++) {
+
+            for(int k = shared -> memberOffsets[c]; k < shared -> memberOffsets[c + 1]; k++) { continents[c] -> addTerritory(territories[shared -> memberIndices[k]]); }
+
+            // Continent sums only depend on the topology, copy them instead of rebuilding
+            auto sum = other.continentLookupTable.find(other.continents[c]);
+            if(sum != other.continentLookupTable.end()) { continentLookupTable[continents[c]] = sum -> second; }
+
+        }
+
+        // Topology and dense indices are identical, so the immutable tables can be shared
+        this -> routingTable = other.routingTable;
+        this -> topology = shared;
 
     }
 
@@ -751,7 +809,20 @@ namespace WarzoneMap {
     void Map::setContinents(const vector<Continent*>& continents) { this -> continents = continents; }
 
     const vector<Territory*>& Map::getTerritories() const { return territories; }
-    void Map::setTerritories(const vector<Territory*>& territories) { this -> territories = territories; }
+    void Map::setTerritories(const vector<Territory*>& territories) { 
+        
+        this -> territories = territories; 
+
+        //Reassign dense indices, old routing data no longer matches
+        for(size_t i = 0; i < this -> territories.size(); i++) {
+
+            if(this -> territories[i] != nullptr) { this -> territories[i] -> setIndex((int) i); }
+
+        }
+
+        invalidateRoutingCache();
+    
+    }
 
     const unordered_map<Continent*, long long>& Map::getContinentLookupTable() const{ return continentLookupTable; }
     void Map::setContinentLookupTable(const unordered_map<Continent*, long long> continentLookupTable){this -> continentLookupTable = continentLookupTable; }
@@ -783,7 +854,9 @@ namespace WarzoneMap {
 
         }
 
+        territory -> setIndex((int) this -> territories.size());
         this -> territories.push_back(territory);
+        invalidateRoutingCache();
         
     }
 
@@ -972,104 +1045,297 @@ namespace WarzoneMap {
 
     }
 
-    vector<Territory*> Map::shortestPathBetweenTerritories(Territory* start, Territory* goal) {
+    int Map::resolveTerritoryIndex(const Territory* territory) const {
 
-        //Safety Checks
-        if(start == nullptr || goal == nullptr) { return {}; }
-        if(start == goal) { return { start }; }
+        if(territory == nullptr) { return -1; }
 
-        //Instantiate relevant structures
-        unordered_map<Territory*, int> distance; //Shortest known distance from start
-        unordered_map<Territory*, Territory*> previous; //Predecessor for path reconstruction
-        unordered_set<Territory*> visited; //Visited set to prevent reprocessing
+        int idx = territory -> getIndex();
 
+        //Index must be in range AND point back at the same object (guards against territories from another map)
+        if(idx < 0 || idx >= (int) territories.size() || territories[idx] != territory) { return -1; }
 
-        // Comparator structure for priority queue
-        struct TerritoryDistanceCompare {
+        return idx;
 
-            unordered_map<Territory*, int>* distancePtr;
+    }
 
-            //Constructor for struct
-            TerritoryDistanceCompare(unordered_map<Territory*, int>* dist) { distancePtr = dist; }
+    bool Map::buildRoutingTable() {
 
-            //Comparator definition
-            bool operator()(Territory* left, Territory* right) const { return (*distancePtr)[left] > (*distancePtr)[right]; }
+        int n = (int) territories.size();
 
-        };
+        if(n == 0 || n > ROUTING_TABLE_MAX_TERRITORIES) { 
+            
+            invalidateRoutingCache();
+            return false; 
+        
+        }
+
+        //Flatten adjacency into CSR arrays, so worker threads never touch Territory objects
+        vector<int> adjOffsets(n + 1, 0);
+        vector<int> adjTargets;
+
+        for(int i = 0; i < n; i++) {
 
-        //Define priority queue
-        TerritoryDistanceCompare comparator(&distance);
+            if(territories[i] != nullptr) {
 
-        //Invert heap access since C++ priority_queues are max-heaps by default; use a custom comparator to make it act as a min-heap        
-        priority_queue<Territory*, vector<Territory*>, TerritoryDistanceCompare> frontier(comparator);
+                for(Territory* neighbor : territories[i] -> getNeighbors()) {
 
-        //Intialize default values
-        for(Territory* t : this -> getTerritories()) {
+                    int neighborIdx = resolveTerritoryIndex(neighbor);
+                    if(neighborIdx >= 0) { adjTargets.push_back(neighborIdx); }
 
-            if(t == nullptr) { continue; } //Ignore null pointers
+                }
+
+            }
 
-            distance[t] = INT_MAX; //Initialize all distances to "infinity"
-            previous[t] = nullptr; //Set previous territory pointer to be null
+            adjOffsets[i + 1] = (int) adjTargets.size();
 
         }
 
-        //Intialize default values for starting territory
-        distance[start] = 0; 
-        frontier.push(start);
+        shared_ptr<RoutingTable> table = make_shared<RoutingTable>();
+        table -> territoryCount = n;
+        table -> hopDistance.assign((size_t) n * n, ROUTING_UNREACHABLE);
+        table -> nextHop.assign((size_t) n * n, ROUTING_UNREACHABLE);
 
-        //Execute Djkistra's
-        while(!frontier.empty()) {
+        //One BFS per goal; each goal owns its own row, so threads never write to the same memory
+        atomic<int> nextGoal(0);
 
-            Territory* current = frontier.top(); //Get current neighbouring territory
-            frontier.pop();
+        auto worker = [&]() {
 
-            //Skip already visited territories
-            if(visited.find(current) != visited.end()) { continue; }
-            
-            //Mark current territory as visited
-            visited.insert(current); 
+            vector<int> frontier(n);
+            int goal;
 
-            //Goal found
-            if(current == goal) { break; }
+            while((goal = nextGoal.fetch_add(1)) < n) {
 
-            //Iterate through all neighbors
-            for(Territory* neighbor : current -> getNeighbors()) {
+                uint16_t* dist = &table -> hopDistance[(size_t) goal * n];
+                uint16_t* hop = &table -> nextHop[(size_t) goal * n];
+
+                int head = 0;
+                int tail = 0;
+
+                frontier[tail++] = goal;
+                dist[goal] = 0;
+                hop[goal] = (uint16_t) goal;
+
+                while(head < tail) {
+
+                    int current = frontier[head++];
 
-                if(neighbor == nullptr) { continue; }
+                    for(int k = adjOffsets[current]; k < adjOffsets[current + 1]; k++) {
 
-                //The distance to the neighbor from start is the distance from the current node++ (current holds the distance from start)
-                int altDistance = distance[current] + 1;
+                        int neighbor = adjTargets[k];
 
-                //If this new path to the neighbor is shorter than the previously known path,
-                //update the neighbor's shortest distance and record that it was reached through the current node.
-                //Then, add the neighbor to the priority queue for further exploration.
-                if(altDistance < distance[neighbor]) {
+                        if(dist[neighbor] != ROUTING_UNREACHABLE) { continue; } //Already reached
 
-                    distance[neighbor] = altDistance; //Record new shortest known distance to neighbor
-                    previous[neighbor] = current; //Store path predecessor for reconstruction later
-                    frontier.push(neighbor); //Schedule neighbor for expansion in the frontier
+                        dist[neighbor] = (uint16_t) (dist[current] + 1);
+                        hop[neighbor] = (uint16_t) current; //From neighbor, step to current to get closer to goal
+                        frontier[tail++] = neighbor;
+
+                    }
 
                 }
 
+            }
+
+        };
+
+        unsigned int numThreads = max(1u, thread::hardware_concurrency());
+        numThreads = min(numThreads, (unsigned int) n);
+
+        vector<thread> workers;
+        for(unsigned int i = 1; i < numThreads; i++) { workers.emplace_back(worker); }
+        worker(); //Calling thread participates too
+        for(thread& w : workers) { w.join(); }
+
+        invalidateRoutingCache();
+        routingTable = table;
+        return true;
+
+    }
+
+    void Map::invalidateRoutingCache() {
+
+        routingTable.reset();
+
+        {
+            lock_guard<mutex> topologyLock(topologyMutex);
+            topology.reset();
+        }
+
+        lock_guard<mutex> lock(bfsTreeCacheMutex);
+        bfsTreeCache.clear();
+        bfsTreeLookup.clear();
+
+    }
+
+    bool Map::hasRoutingTable() const { return routingTable != nullptr; }
+
+    shared_ptr<const RoutingTable> Map::getRoutingTable() const { return routingTable; }
+
+    void Map::setRoutingTable(shared_ptr<const RoutingTable> table) {
+
+        invalidateRoutingCache();
+        routingTable = table;
+
+    }
+
+    shared_ptr<const MapTopology> Map::getTopology() const {
+
+        lock_guard<mutex> lock(topologyMutex);
+        if(topology != nullptr) { return topology; }
+
+        shared_ptr<MapTopology> built = make_shared<MapTopology>();
+        const int numTerritories = static_cast<int>(territories.size());
+
+        unordered_map<const Continent*, int> continentIndex;
+        for(size_t c = 0; c < continents.size(); c++) { continentIndex[continents[c]] = static_cast<int>(c); }
+
+        built -> neighborOffsets.reserve(territories.size() + 1);
+        built -> neighborOffsets.push_back(0);
+        built -> continentOf.assign(territories.size(), -1);
+        built -> memberOffsets.assign(continents.size() + 1, 0);
+
+        for(int i = 0; i < numTerritories; i++) {
+
+            for(Territory* neighbor : territories[i] -> getNeighbors()) { built -> neighborIndices.push_back(resolveTerritoryIndex(neighbor)); }
+            built -> neighborOffsets.push_back(static_cast<int>(built -> neighborIndices.size()));
+
+            auto found = continentIndex.find(territories[i] -> getContinent());
+            if(found != continentIndex.end()) {
+
+                built -> continentOf[i] = found -> second;
+                built -> memberOffsets[found -> second + 1]++;
 
             }
 
         }
 
-        //Rebuild path
+        //Continent members in territory order (counting sort on continentOf)
+        for(size_t c = 1; c < built -> memberOffsets.size(); c++) { built -> memberOffsets[c] += built -> memberOffsets[c - 1]; }
+
+        built -> memberIndices.resize(built -> memberOffsets.back());
+        vector<int> next(built -> memberOffsets.begin(), built -> memberOffsets.end() - 1);
+        for(int i = 0; i < numTerritories; i++) {
+
+            if(built -> continentOf[i] >= 0) { built -> memberIndices[next[built -> continentOf[i]]++] = i; }
+
+        }
+
+        topology = built;
+        return topology;
+
+    }
+
+    const vector<int>& Map::getCachedBFSTree(int source) {
+
+        //Cache hit: move to front (most recently used)
+        auto found = bfsTreeLookup.find(source);
+        if(found != bfsTreeLookup.end()) {
+
+            bfsTreeCache.splice(bfsTreeCache.begin(), bfsTreeCache, found -> second);
+            return found -> second -> second;
+
+        }
+
+        //Cache miss: plain BFS over dense indices
+        int n = (int) territories.size();
+        vector<int> parent(n, -1);
+        vector<int> frontier;
+        frontier.reserve(n);
+
+        parent[source] = source;
+        frontier.push_back(source);
+
+        for(size_t head = 0; head < frontier.size(); head++) {
+
+            Territory* current = territories[frontier[head]];
+
+            for(Territory* neighbor : current -> getNeighbors()) {
+
+                int neighborIdx = resolveTerritoryIndex(neighbor);
+
+                if(neighborIdx < 0 || parent[neighborIdx] != -1) { continue; } //Foreign or already reached
+
+                parent[neighborIdx] = frontier[head];
+                frontier.push_back(neighborIdx);
+
+            }
+
+        }
+
+        bfsTreeCache.emplace_front(source, move(parent));
+        bfsTreeLookup[source] = bfsTreeCache.begin();
+
+        //Evict least recently used tree
+        if(bfsTreeCache.size() > BFS_TREE_CACHE_CAPACITY) {
+
+            bfsTreeLookup.erase(bfsTreeCache.back().first);
+            bfsTreeCache.pop_back();
+
+        }
+
+        return bfsTreeCache.front().second;
+
+    }
+
+    int Map::hopDistanceBetweenTerritories(Territory* start, Territory* goal) {
+
+        int startIdx = resolveTerritoryIndex(start);
+        int goalIdx = resolveTerritoryIndex(goal);
+
+        if(startIdx < 0 || goalIdx < 0) { return -1; }
+
+        shared_ptr<const RoutingTable> table = routingTable;
+
+        if(table != nullptr) {
+
+            uint16_t dist = table -> hopDistance[(size_t) goalIdx * table -> territoryCount + startIdx];
+            return (dist == ROUTING_UNREACHABLE) ? -1 : (int) dist;
+
+        }
+
+        return (int) shortestPathBetweenTerritories(start, goal).size() - 1;
+
+    }
+
+    vector<Territory*> Map::shortestPathBetweenTerritories(Territory* start, Territory* goal) {
+
+        //Safety Checks
+        int startIdx = resolveTerritoryIndex(start);
+        int goalIdx = resolveTerritoryIndex(goal);
+
+        if(startIdx < 0 || goalIdx < 0) { return {}; }
+        if(start == goal) { return { start }; }
+
         vector<Territory*> shortestPath;
-        Territory* step = goal;
+        shared_ptr<const RoutingTable> table = routingTable;
 
-        //Backtrack from goal to start
-        while(step != nullptr) {
+        //Fast path: walk the precomputed next hops towards goal
+        if(table != nullptr) {
+
+            size_t row = (size_t) goalIdx * table -> territoryCount;
+            if(table -> hopDistance[row + startIdx] == ROUTING_UNREACHABLE) { return {}; }
+
+            shortestPath.reserve(table -> hopDistance[row + startIdx] + 1);
+
+            for(int step = startIdx; ; step = table -> nextHop[row + step]) {
 
-            shortestPath.push_back(step);
-            step = previous[step];
+                shortestPath.push_back(territories[step]);
+                if(step == goalIdx) { break; }
+
+            }
+
+            return shortestPath;
 
         }
 
-        //If start wasn't reached, there is no path
-        if(shortestPath.back() != start) { return {}; }
+        //Large maps: BFS tree rooted at start, cached for subsequent queries
+        lock_guard<mutex> lock(bfsTreeCacheMutex);
+        const vector<int>& parent = getCachedBFSTree(startIdx);
+
+        if(parent[goalIdx] == -1) { return {}; } //Goal not reachable
+
+        //Backtrack from goal to start
+        for(int step = goalIdx; step != startIdx; step = parent[step]) { shortestPath.push_back(territories[step]); }
+        shortestPath.push_back(start);
 
         //Reverse shortestPath to be start to goal
         reverse(shortestPath.begin(), shortestPath.end());
@@ -1077,6 +1343,160 @@ namespace WarzoneMap {
 
     }
 
+    bool Map::shortestPathThroughOwned(Territory* start, Territory* goal, Player* owner, vector<Territory*>& outPath) const {
+
+        outPath.clear();
+
+        //Safety Checks
+        int startIdx = resolveTerritoryIndex(start);
+        int goalIdx = resolveTerritoryIndex(goal);
+
+        if(startIdx < 0 || goalIdx < 0 || owner == nullptr) { return false; }
+        if(start -> getOwner() != owner) { return false; }
+
+        if(start == goal) { 
+            
+            outPath.push_back(start);
+            return true; 
+        
+        }
+
+        //Per-thread scratch, grown once; stamps avoid clearing the arrays between queries
+        thread_local vector<int> parent;
+        thread_local vector<unsigned int> visitStamp;
+        thread_local vector<int> frontier;
+        thread_local unsigned int currentStamp = 0;
+
+        size_t n = territories.size();
+
+        if(visitStamp.size() < n) {
+
+            parent.resize(n);
+            visitStamp.resize(n, 0);
+            frontier.resize(n);
+
+        }
+
+        //Stamp wrapped around, reset so old marks can't be mistaken for new ones
+        if(++currentStamp == 0) {
+
+            fill(visitStamp.begin(), visitStamp.end(), 0);
+            currentStamp = 1;
+
+        }
+
+        size_t head = 0;
+        size_t tail = 0;
+
+        visitStamp[startIdx] = currentStamp;
+        parent[startIdx] = startIdx;
+        frontier[tail++] = startIdx;
+
+        bool found = false;
+
+        while(head < tail && !found) {
+
+            int current = frontier[head++];
+
+            for(Territory* neighbor : territories[current] -> getNeighbors()) {
+
+                int neighborIdx = resolveTerritoryIndex(neighbor);
+
+                if(neighborIdx < 0 || visitStamp[neighborIdx] == currentStamp) { continue; } //Foreign or already reached
+
+                //Goal may be hostile, everything else must be friendly
+                if(neighborIdx == goalIdx) {
+
+                    parent[goalIdx] = current;
+                    found = true;
+                    break;
+
+                }
+
+                if(neighbor -> getOwner() != owner) { continue; }
+
+                visitStamp[neighborIdx] = currentStamp;
+                parent[neighborIdx] = current;
+                frontier[tail++] = neighborIdx;
+
+            }
+
+        }
+
+        if(!found) { return false; }
+
+        //Backtrack from goal to start
+        for(int step = goalIdx; step != startIdx; step = parent[step]) { outPath.push_back(territories[step]); }
+        outPath.push_back(start);
+
+        //Reverse outPath to be start to goal
+        reverse(outPath.begin(), outPath.end());
+        return true;
+
+    }
+
+    int Map::computeFrontlineField(Player* owner, FrontlineField& field) const {
+
+        size_t n = territories.size();
+
+        field.distance.assign(n, -1);
+        field.nextHop.assign(n, -1);
+        field.nearestFrontline.assign(n, -1);
+        field.frontier.resize(n);
+
+        if(owner == nullptr) { return 0; }
+
+        size_t tail = 0;
+
+        //Seed: every owned territory bordering a territory owned by someone else
+        for(size_t i = 0; i < n; i++) {
+
+            Territory* t = territories[i];
+            if(t == nullptr || t -> getOwner() != owner) { continue; }
+
+            for(Territory* neighbor : t -> getNeighbors()) {
+
+                if(neighbor != nullptr && neighbor -> getOwner() != owner) {
+
+                    field.distance[i] = 0;
+                    field.nextHop[i] = (int) i;
+                    field.nearestFrontline[i] = (int) i;
+                    field.frontier[tail++] = (int) i;
+                    break;
+
+                }
+
+            }
+
+        }
+
+        int frontlineCount = (int) tail;
+
+        //Expand inwards through owned territory only
+        for(size_t head = 0; head < tail; head++) {
+
+            int current = field.frontier[head];
+
+            for(Territory* neighbor : territories[current] -> getNeighbors()) {
+
+                int neighborIdx = resolveTerritoryIndex(neighbor);
+
+                if(neighborIdx < 0 || field.distance[neighborIdx] != -1) { continue; } //Foreign or already reached
+                if(neighbor -> getOwner() != owner) { continue; }
+
+                field.distance[neighborIdx] = field.distance[current] + 1;
+                field.nextHop[neighborIdx] = current;
+                field.nearestFrontline[neighborIdx] = field.nearestFrontline[current];
+                field.frontier[tail++] = neighborIdx;
+
+            }
+
+        }
+
+        return frontlineCount;
+
+    }
+
     // ================= MapLoader =================
 
     #define MAP_OK 0
@@ -1104,6 +1524,9 @@ namespace WarzoneMap {
         this -> mapName = mapName;
         this -> continents = {};
         this -> territories = {};
+        this -> sourceHash = 0;
+        this -> sourceSize = 0;
+        this -> useCompiledCache = true;
     
     }
 
@@ -1118,10 +1541,13 @@ namespace WarzoneMap {
         this -> mapName = mapName;
         this -> continents = continents;
         this -> territories = territories;
+        this -> sourceHash = 0;
+        this -> sourceSize = 0;
+        this -> useCompiledCache = true;
 
     }
 
-    MapLoader::~MapLoader(){} // No dynamic memory to free
+    MapLoader::~MapLoader(){} // No dynamic memory to free, the compiled map is shared
 
     MapLoader::MapLoader(const MapLoader& other) {
 
@@ -1133,6 +1559,10 @@ namespace WarzoneMap {
         this -> mapName = other.mapName;
         this -> continents = other.continents;
         this -> territories = other.territories;
+        this -> compiled = other.compiled;
+        this -> sourceHash = other.sourceHash;
+        this -> sourceSize = other.sourceSize;
+        this -> useCompiledCache = other.useCompiledCache;
     
     }
 
@@ -1148,6 +1578,10 @@ namespace WarzoneMap {
             this -> mapName = other.mapName;
             this -> continents = other.continents;
             this -> territories = other.territories;
+            this -> compiled = other.compiled;
+            this -> sourceHash = other.sourceHash;
+            this -> sourceSize = other.sourceSize;
+            this -> useCompiledCache = other.useCompiledCache;
 
         }
 
@@ -1218,6 +1652,10 @@ namespace WarzoneMap {
     const vector<vector<string>>& MapLoader::getTerritories() const {return territories;}
     void MapLoader::setTerritories(const vector<vector<string>> territories) { this -> territories = territories; }
 
+    uint64_t MapLoader::getSourceHash() const { return sourceHash; }
+
+    bool MapLoader::isCompiled() const { return compiled != nullptr; }
+
 
     //-- Class Methods --//
     int MapLoader::importMapInfo(const string& filePath) {
@@ -1245,6 +1683,41 @@ namespace WarzoneMap {
 
         }
 
+        //Identify the contents, then skip the text parse if a compiled map of these exact contents sits next to the file
+        compiled.reset();
+        sourceHash = 0;
+        sourceSize = 0;
+
+        MappedFile source;
+        if(source.open(filePath)) {
+
+            sourceHash = MappedFile::hashBytes(source.data(), source.size());
+            sourceSize = source.size();
+
+        }
+
+        if(useCompiledCache && sourceSize > 0) {
+
+            shared_ptr<CompiledMap> cache = make_shared<CompiledMap>();
+
+            if(cache -> open(compiledMapPath(filePath)) && cache -> getHeader().sourceHash == sourceHash && cache -> getHeader().sourceSize == sourceSize) {
+
+                const CompiledMapHeader& h = cache -> getHeader();
+                author = cache -> getString(h.author);
+                image = cache -> getString(h.image);
+                wrap = cache -> getString(h.wrap);
+                scrollType = cache -> getString(h.scrollType);
+                warn = cache -> getString(h.warn);
+                continents.clear();
+                territories.clear();
+
+                compiled = cache;
+                return MAP_OK;
+
+            }
+
+        }
+
         string line;     // To hold each line of the file
         string section;  // To track which section of the map file is being parsed
 
@@ -1378,6 +1851,14 @@ namespace WarzoneMap {
 
         } else { tempMapPtr -> setWarn(warn); }
 
+        //Compiled maps were validated when mapped, and hold the neighbor lists and routing table ready to use
+        if(compiled != nullptr) {
+
+            loadCompiledInto(tempMapPtr);
+            return {MAP_OK, tempMapPtr};
+
+        }
+
         //Load continents into map object
         if(continents.empty()) {
 
@@ -1544,9 +2025,121 @@ namespace WarzoneMap {
         }
 
         tempMapPtr -> buildContinentHashmap(); //Set up lookup table
+        tempMapPtr -> buildRoutingTable(); //Precompute all-pairs routing (skipped for very large maps)
 
         return {MAP_OK, tempMapPtr};
 
     }
 
-}
\ No newline at end of file
+    void MapLoader::loadCompiledInto(Map* mapPtr) const {
+
+        const CompiledMapHeader& h = compiled -> getHeader();
+        const CompiledContinent* compiledContinents = compiled -> getContinents();
+        const CompiledTerritory* compiledTerritories = compiled -> getTerritories();
+        const uint32_t* neighborIndices = compiled -> getNeighbors();
+        const uint32_t* memberIndices = compiled -> getMembers();
+
+        vector<Continent*> continentPtrs;
+        continentPtrs.reserve(h.numContinents);
+
+        for(uint32_t c = 0; c < h.numContinents; c++) {
+
+            continentPtrs.push_back(new Continent(compiled -> getString(compiledContinents[c].name), compiledContinents[c].bonusValue));
+
+        }
+
+        vector<Territory*> territoryPtrs;
+        territoryPtrs.reserve(h.numTerritories);
+
+        for(uint32_t t = 0; t < h.numTerritories; t++) {
+
+            const CompiledTerritory& ct = compiledTerritories[t];
+            Continent* continent = ct.continent >= 0 ? continentPtrs[ct.continent] : nullptr;
+
+            territoryPtrs.push_back(new Territory(compiled -> getString(ct.name), ct.numericTerrID, ct.xCoord, ct.yCoord, continent));
+
+        }
+
+        //Neighbor and member lists are copied in their compiled order, no duplicate checks or name lookups
+        vector<Territory*> linked;
+        for(uint32_t t = 0; t < h.numTerritories; t++) {
+
+            const CompiledTerritory& ct = compiledTerritories[t];
+
+            linked.clear();
+            for(uint32_t k = ct.firstNeighbor; k < ct.firstNeighbor + ct.numNeighbors; k++) { linked.push_back(territoryPtrs[neighborIndices[k]]); }
+            territoryPtrs[t] -> setNeighbors(linked);
+
+        }
+
+        unordered_map<Continent*, long long> lookupTable;
+        lookupTable.reserve(h.numContinents);
+
+        for(uint32_t c = 0; c < h.numContinents; c++) {
+
+            const CompiledContinent& cc = compiledContinents[c];
+
+            linked.clear();
+            for(uint32_t k = cc.firstMember; k < cc.firstMember + cc.numMembers; k++) { linked.push_back(territoryPtrs[memberIndices[k]]); }
+            continentPtrs[c] -> setTerritories(linked);
+
+            lookupTable[continentPtrs[c]] = cc.territoryHashSum;
+
+        }
+
+        mapPtr -> setContinents(continentPtrs);
+        mapPtr -> setTerritories(territoryPtrs); //Assigns dense indices, in compiled order
+        mapPtr -> setContinentLookupTable(lookupTable);
+
+        if(h.hasRouting != 0) {
+
+            size_t entries = static_cast<size_t>(h.numTerritories) * h.numTerritories;
+
+            shared_ptr<RoutingTable> table = make_shared<RoutingTable>();
+            table -> territoryCount = static_cast<int>(h.numTerritories);
+            table -> hopDistance.assign(compiled -> getHopDistance(), compiled -> getHopDistance() + entries);
+            table -> nextHop.assign(compiled -> getNextHop(), compiled -> getNextHop() + entries);
+
+            mapPtr -> setRoutingTable(table);
+
+        } else { mapPtr -> buildRoutingTable(); }
+
+    }
+
+    string MapLoader::compiledMapPath(const string& mapPath) {
+
+        size_t lastSlash = mapPath.find_last_of("/\\");
+        size_t lastDot = mapPath.find_last_of('.');
+
+        if(lastDot == string::npos || (lastSlash != string::npos && lastDot < lastSlash)) { return mapPath + COMPILED_MAP_EXTENSION; }
+
+        return mapPath.substr(0, lastDot) + COMPILED_MAP_EXTENSION;
+
+    }
+
+    int MapLoader::compileMap(const string& mapPath) {
+
+        MapLoader loader;
+        loader.useCompiledCache = false; //Always compile from the text
+
+        int importCode = loader.importMapInfo(mapPath);
+        if(importCode != MAP_OK) { return importCode; }
+
+        pair<int, Map*> loaded = loader.loadMap();
+        if(loaded.first != MAP_OK || loaded.second == nullptr) { return MAP_PARSE_ERROR; }
+
+        bool written = writeCompiledMap(compiledMapPath(mapPath), *loaded.second, loader.sourceHash, loader.sourceSize);
+        delete loaded.second;
+
+        if(!written) {
+
+            cerr << "Error: Could not write compiled map " << compiledMapPath(mapPath) << endl;
+            return MAP_WRITE_ERROR;
+
+        }
+
+        return MAP_OK;
+
+    }
+
+}
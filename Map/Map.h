@@ -1,8 +1,12 @@
 #pragma once
 #include <climits>
+#include <cstdint>
 #include <iostream>
 #include <fstream>
+#include <list>
 #include <map>
+#include <memory>
+#include <mutex>
 #include <unordered_map>
 #include <unordered_set>
 #include <vector>
@@ -10,6 +14,8 @@
 #include <sstream>
 #include <string>
 
+#include "CompiledMap.h"
+
 namespace WarzonePlayer { class Player; } //Forward declaration
 namespace WarzoneOrder { class TimeUtil; } //Forward declaration
 using namespace std;
@@ -22,6 +28,7 @@ namespace WarzoneMap {
     const int MAP_FILE_NOT_FOUND = 1;
     const int MAP_INVALID_SECTION = 2;
     const int MAP_PARSE_ERROR = 3;
+    const int MAP_WRITE_ERROR = 4; //MapLoader::compileMap() could not write the compiled map
 
     const int INVALID_MAP_PTR = 1;
     const int INVALID_AUTHOR = 2;
@@ -33,6 +40,11 @@ namespace WarzoneMap {
     const int INVALID_TERRITORY = 8;
     const int INVALID_MAP_STRUCTURE = 9;
 
+    // Routing limits
+    const int ROUTING_TABLE_MAX_TERRITORIES = 2048; //Above this, the all-pairs table is too large (N^2 * 4 bytes), use the BFS tree cache instead
+    const size_t BFS_TREE_CACHE_CAPACITY = 64; //Number of per-source BFS trees kept in the LRU cache
+    const uint16_t ROUTING_UNREACHABLE = UINT16_MAX;
+
     using WarzonePlayer::Player;
     using WarzoneOrder::TimeUtil;
 
@@ -99,6 +111,137 @@ namespace WarzoneMap {
 
     };
 
+    // ================= StateJournal =================
+    /**
+     * @struct JournalEntry
+     * @brief One recorded mutation: undo restores the old value kept in pointer/value
+     */
+    struct JournalEntry {
+
+        void (*undo)(const JournalEntry&); //Supplied by the module that made the change
+        void* object;  //Mutated object (Territory, Player, PlayerTerrContainer...)
+        void* pointer; //Old pointer value, or a pointer the change was about
+        long long value; //Old numeric value, delta or position
+
+    };
+
+    /**
+     * @class StateJournal
+     * @brief Undo log of game state mutations, for speculative execution (e.g. AI lookahead).
+     *
+     * While a journal is active on the calling thread and has an open checkpoint, every army count, territory owner,
+     * owned territory list, continent score, truce and card flag change records its old value. rollback() undoes the
+     * changes made since the last checkpoint in reverse order, in O(changes) instead of copying the whole game.
+     *
+     * The active journal is per thread and is installed with a Scope, so a GameEngine records into its own journal
+     * only around its own calls, and other engines (or copies of it) never record into it.
+     * A journal must only be recorded from one thread at a time. Card draws are not journaled.
+     */
+    class StateJournal {
+
+        private:
+
+            static thread_local StateJournal* active; //Journal the calling thread records in, nullptr if none
+
+            vector<JournalEntry> entries;
+            vector<size_t> checkpoints; //Entry count at each open checkpoint
+
+        public:
+
+            /**
+             * @class Scope
+             * @brief Makes a journal the calling thread's active one until the scope ends, then restores the previous one
+             */
+            class Scope {
+
+                private:
+
+                    StateJournal* previous;
+
+                public:
+
+                    /**
+                     * @param journal Journal to record in, nullptr to stop recording for the scope
+                     */
+                    explicit Scope(StateJournal* journal) : previous(active) { active = journal; }
+
+                    ~Scope() { active = previous; }
+
+                    Scope(const Scope&) = delete;
+                    Scope& operator=(const Scope&) = delete;
+
+            };
+
+            //-- Constructors --//
+
+            /**
+             * @brief Default constructor, the journal is not active
+             */
+            StateJournal();
+
+            StateJournal(const StateJournal&) = delete;
+            StateJournal& operator=(const StateJournal&) = delete;
+
+            //-- Accessors --//
+
+            /**
+             * @brief Journal that state changes made on the calling thread are recorded in
+             * @return Active journal, or nullptr
+             */
+            static StateJournal* getActive() { return active; }
+
+            /**
+             * @brief Number of recorded changes
+             * @return Entry count
+             */
+            size_t size() const;
+
+            /**
+             * @brief Number of open checkpoints
+             * @return Checkpoint depth
+             */
+            size_t getDepth() const;
+
+            //-- Class Methods --//
+
+            /**
+             * @brief Opens a checkpoint, nested checkpoints are allowed
+             * @return Depth after opening
+             */
+            size_t checkpoint();
+
+            /**
+             * @brief Undoes every change since the last checkpoint, and closes it
+             * @return false if there was no open checkpoint
+             */
+            bool rollback();
+
+            /**
+             * @brief Closes the last checkpoint, keeping its changes (they fold into the enclosing checkpoint, if any)
+             * @return false if there was no open checkpoint
+             */
+            bool commit();
+
+            /**
+             * @brief Drops every entry and open checkpoint without undoing anything
+             */
+            void clear();
+
+            /**
+             * @brief Records a change in the active journal, if it has an open checkpoint
+             * @param undo Function restoring the old state from the entry
+             * @param object Mutated object
+             * @param pointer Old pointer value, or related object
+             * @param value Old numeric value, delta or position
+             */
+            static void record(void (*undo)(const JournalEntry&), void* object, void* pointer, long long value) {
+
+                if(active != nullptr && !active -> checkpoints.empty()) { active -> entries.push_back({ undo, object, pointer, value }); }
+
+            }
+
+    };
+
     // Forward declarations
     class Continent;
     class Territory;
@@ -239,6 +382,9 @@ namespace WarzoneMap {
             int numArmies;
             long long numericTerrID;
 
+            //-- Dense index into the owning Map's territory list (-1 if not in a Map) --//
+            int index;
+
         public:
 
             //-- Constructors, Destructor, Copy Constructor, Assignment Operator, Stream Insertion Operator  --//
@@ -263,6 +409,16 @@ namespace WarzoneMap {
             */
             Territory(const string &ID, int xCoord, int yCoord, Continent* continent);
 
+            /**
+            * @brief Parameterized constructor for compiled maps, which store the numeric ID instead of hashing the ID again
+            * @param ID Unique identifier of the territory
+            * @param numericTerrID StringHandling::hashStringToNum(ID), as computed when the map was compiled
+            * @param xCoord X coordinate
+            * @param yCoord Y coordinate
+            * @param continent Pointer to the continent this territory belongs to
+            */
+            Territory(const string &ID, long long numericTerrID, int xCoord, int yCoord, Continent* continent);
+
             /**
             * @brief Parameterized constructor with all properties
             * @param ID Unique identifier of the territory
@@ -394,6 +550,18 @@ namespace WarzoneMap {
 
             //Note: NO mutator should exist. This is ONLY based on the string ID.
 
+            /**
+            * @brief Accessor for the dense index of this territory inside its Map
+            * @return Position of this territory in Map::getTerritories(), or -1 if it was never added to a Map
+            */
+            int getIndex() const;
+
+            /**
+            * @brief Mutator for the dense index of this territory. Only the owning Map should call this.
+            * @param index Position of this territory in Map::getTerritories()
+            */
+            void setIndex(int index);
+
             //-- Class Methods --//
 
             /**
@@ -445,6 +613,58 @@ namespace WarzoneMap {
             
         };
 
+    // ================= RoutingTable =================
+    /**
+     * @brief Precomputed all-pairs hop distances and next-hop table for a Map.
+     *
+     * Both tables are flat row-major arrays of size N*N, indexed by [goal * N + from]
+     * using the dense Territory indices. Each row is one BFS tree rooted at the goal,
+     * so a path query only walks next hops and costs O(path length).
+     * Immutable once built; copies of a Map share it through a shared_ptr.
+     */
+    struct RoutingTable {
+
+        int territoryCount = 0;
+        vector<uint16_t> hopDistance; // hopDistance[goal * N + from] = hops from "from" to "goal" (ROUTING_UNREACHABLE if disconnected)
+        vector<uint16_t> nextHop; // nextHop[goal * N + from] = index of the next territory on the way from "from" to "goal"
+
+    };
+
+    // ================= MapTopology =================
+    /**
+     * @brief Structure of a Map in dense indices: adjacency, and the territories of every continent.
+     *
+     * Neighbors and continent members are stored as flat offset/index arrays (territory i's neighbors are
+     * neighborIndices[neighborOffsets[i]] up to neighborIndices[neighborOffsets[i + 1]]). Immutable once built;
+     * copies of a Map share it and rebuild their pointer graph from it without any hashing.
+     */
+    struct MapTopology {
+
+        vector<int> neighborOffsets; // Size N + 1
+        vector<int> neighborIndices;
+        vector<int> continentOf; // Continent index of each territory, -1 if it has none
+        vector<int> memberOffsets; // Size C + 1
+        vector<int> memberIndices; // Territories of each continent, in the continent's order
+
+    };
+
+    // ================= FrontlineField =================
+    /**
+     * @brief Result of a batched "nearest frontline" query for one player, indexed by dense Territory index.
+     *
+     * A frontline territory is owned by the player and borders at least one territory it does not own.
+     * Keep one instance per player and pass it to Map::computeFrontlineField every turn: the arrays are
+     * only resized when the map size changes, so repeated queries do not allocate.
+     */
+    struct FrontlineField {
+
+        vector<int> distance; // Hops to the nearest frontline through owned territory (0 on the frontline, -1 if not owned or cut off)
+        vector<int> nextHop; // Index of the next owned territory towards that frontline (itself on the frontline, -1 if none)
+        vector<int> nearestFrontline; // Index of the frontline territory that is reached (-1 if none)
+        vector<int> frontier; // BFS queue, kept here so it can be reused between calls
+
+    };
+
     // ================= Map =================
     /**
      * @class Map
@@ -479,6 +699,37 @@ namespace WarzoneMap {
             //-- Game Logic Info --/
             unordered_map<Continent*, long long> continentLookupTable;
 
+            //-- Routing Info --//
+            shared_ptr<const RoutingTable> routingTable; //All-pairs table, only for maps up to ROUTING_TABLE_MAX_TERRITORIES
+            mutable shared_ptr<const MapTopology> topology; //Built by the first copy, shared by every copy after it
+            mutable mutex topologyMutex;
+            list<pair<int, vector<int>>> bfsTreeCache; //LRU of (source index, BFS parent array), most recently used first
+            unordered_map<int, list<pair<int, vector<int>>>::iterator> bfsTreeLookup; //Source index -> position in bfsTreeCache
+            mutable mutex bfsTreeCacheMutex;
+
+            /**
+             * @brief Resolves the dense index of a territory, checking it actually belongs to this map
+             * @param territory Territory to resolve
+             * @return Dense index, or -1 if the territory is null or not part of this map
+             */
+            int resolveTerritoryIndex(const Territory* territory) const;
+
+            /**
+             * @brief Returns the BFS parent array rooted at source, building and caching it if needed.
+             * The caller MUST hold bfsTreeCacheMutex; the returned reference is valid until the lock is released.
+             * @param source Dense index of the BFS root
+             * @return parent[v] = predecessor of v on a shortest path from source (-1 if unreachable, source for the root)
+             */
+            const vector<int>& getCachedBFSTree(int source);
+
+            /**
+             * @brief Replaces this map's contents with a copy of other's: metadata, continents, territories (owners and
+             * armies included) and continent lookup table. Every Territory and Continent is allocated anew, with its
+             * neighbor and member pointers rebuilt from other's topology; the topology and routing table are shared.
+             * @param other Map to copy
+             */
+            void copyFrom(const Map& other);
+
 
         public:
 
@@ -708,10 +959,56 @@ namespace WarzoneMap {
             unordered_map<Continent*, long long> buildEmptyContinentHashmap() const;
 
             /**
-             * @brief Finds the shortest path between two territories using Dijkstra's algorithm.
+             * @brief Precomputes the all-pairs hop distance and next-hop tables, one BFS per territory, spread over all hardware threads.
+             * Skipped for maps larger than ROUTING_TABLE_MAX_TERRITORIES, which fall back to the BFS tree cache.
+             * Must be rebuilt (or invalidated) if the topology changes afterwards.
+             * @return true if the table was built, false if the map is empty or too large
+             */
+            bool buildRoutingTable();
+
+            /**
+             * @brief Drops the routing table and every cached BFS tree. Called automatically when territories are added or replaced.
+             */
+            void invalidateRoutingCache();
+
+            /**
+             * @brief Checks whether the all-pairs routing table is available for this map
+             * @return true if path queries are answered from the precomputed table
+             */
+            bool hasRoutingTable() const;
+
+            /**
+             * @brief Accessor for the all-pairs routing table
+             * @return Shared, immutable table, or nullptr if it was not built
+             */
+            shared_ptr<const RoutingTable> getRoutingTable() const;
+
+            /**
+             * @brief Installs a routing table built elsewhere (e.g. read from a compiled map) instead of running buildRoutingTable()
+             * @param table Table for exactly this map's territories and dense indices
+             */
+            void setRoutingTable(shared_ptr<const RoutingTable> table);
+
+            /**
+             * @brief Index form of the map's structure, built on first use and then cached until the topology changes
+             * @return Shared, immutable topology
+             */
+            shared_ptr<const MapTopology> getTopology() const;
+
+            /**
+             * @brief Number of adjacency steps between two territories.
+             * @param start Pointer to the starting territory.
+             * @param goal Pointer to the target territory.
+             * @return Hop count, or -1 if no path exists or either input is invalid
+             */
+            int hopDistanceBetweenTerritories(Territory* start, Territory* goal);
+
+            /**
+             * @brief Finds the shortest path (fewest adjacency steps) between two territories.
              * 
-             * This method computes the minimal path (fewest adjacency steps) between a start
-             * and goal territory by traversing the map graph. All edges have equivalent work.
+             * Answered in O(path length) by walking the precomputed next-hop table when available.
+             * Otherwise, a BFS tree rooted at start is built once and kept in a small LRU cache,
+             * so repeated queries from the same source also only walk the path.
              * 
              * @param start Pointer to the starting territory.
              * @param goal Pointer to the target territory.
@@ -720,6 +1017,33 @@ namespace WarzoneMap {
              */
             vector<Territory*> shortestPathBetweenTerritories(Territory* start, Territory* goal);
 
+            /**
+             * @brief Finds the shortest path from start to goal that only passes through territories owned by a player.
+             *
+             * The start and every intermediate territory must be owned by owner; the goal may belong to anyone,
+             * so the same query plans both friendly moves and the final attack hop. Uses a per-thread scratch
+             * buffer over dense indices, so the only allocation is growing outPath past its current capacity.
+             *
+             * @param start Pointer to the starting territory (must be owned by owner).
+             * @param goal Pointer to the target territory.
+             * @param owner Player whose territories may be traversed.
+             * @param outPath Cleared, then filled with the path from start to goal (inclusive) if one exists.
+             * @return true if a path was found, false otherwise.
+             */
+            bool shortestPathThroughOwned(Territory* start, Territory* goal, Player* owner, vector<Territory*>& outPath) const;
+
+            /**
+             * @brief Computes, for every territory owned by a player, the nearest frontline reachable through owned territory.
+             *
+             * Runs a single multi-source BFS seeded from all of the player's frontline territories, expanding only
+             * through territories the player owns. O(T + E) per call, and no allocation once field is sized.
+             *
+             * @param owner Player to compute the field for.
+             * @param field Reused output buffers, see FrontlineField.
+             * @return Number of frontline territories found.
+             */
+            int computeFrontlineField(Player* owner, FrontlineField& field) const;
+
 
     };
 
@@ -747,6 +1071,18 @@ namespace WarzoneMap {
             //-- Territory Info --//
             vector<vector<string>> territories;
 
+            //-- Compiled map cache --//
+            shared_ptr<const CompiledMap> compiled; //Set by importMapInfo() when a fresh .wzm was found, loadMap() then builds from it
+            uint64_t sourceHash; //MappedFile::hashBytes() of the last imported .map
+            uint64_t sourceSize;
+            bool useCompiledCache; //false while compiling, so the text is always parsed
+
+            /**
+             * @brief Builds continents, territories, neighbors, lookup table and routing table from the compiled map
+             * @param mapPtr Map to fill, metadata already set
+             */
+            void loadCompiledInto(Map* mapPtr) const;
+
         public:
             
             //-- Constructors, Destructor, Copy Constructor, Assignment Operator, Stream Insertion Operator  --//
@@ -923,6 +1259,35 @@ namespace WarzoneMap {
              */
             pair<int, Map*> loadMap();
 
+            /**
+             * @brief MappedFile::hashBytes() of the last imported .map contents, used to identify the map in checkpoints
+             * @return Hash, 0 before a successful import
+             */
+            uint64_t getSourceHash() const;
+
+            /**
+             * @brief Whether the last import found a fresh compiled map and skipped the text parse
+             * @return true if loadMap() builds from the .wzm
+             */
+            bool isCompiled() const;
+
+            /**
+             * @brief Path of the compiled map kept next to a .map file (same name, COMPILED_MAP_EXTENSION)
+             * @param mapPath Path of the .map file
+             * @return Path of its .wzm
+             */
+            static string compiledMapPath(const string& mapPath);
+
+            /**
+             * @brief Parses a .map file and writes its compiled form next to it.
+             *
+             * importMapInfo() uses the compiled map instead of parsing the text as long as the .map contents
+             * are unchanged; a stale .wzm is ignored until it is compiled again.
+             * @param mapPath Path of the .map file
+             * @return MAP_OK, an importMapInfo() error code, MAP_PARSE_ERROR if the map could not be built, or MAP_WRITE_ERROR
+             */
+            static int compileMap(const string& mapPath);
+
     };
 
 }
\ No newline at end of file
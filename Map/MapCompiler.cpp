@@ -0,0 +1,39 @@
+#include "Map.h"
+
+using namespace WarzoneMap;
+
+/**
+ * @brief Map compiler: writes the compiled .wzm of every .map file given on the command line, next to it.
+ *
+ * MapLoader::importMapInfo() picks the .wzm up automatically while the .map contents stay unchanged.
+ * Usage: ./map_compiler <file.map> [more.map ...]
+ */
+int main(int argc, char* argv[]) {
+
+    if(argc < 2) {
+
+        cerr << "Usage: " << argv[0] << " <file.map> [more.map ...]" << endl;
+        return 1;
+
+    }
+
+    int failures = 0;
+
+    for(int i = 1; i < argc; i++) {
+
+        string mapPath = argv[i];
+        int code = MapLoader::compileMap(mapPath);
+
+        if(code == MAP_OK) { cout << mapPath << " -> " << MapLoader::compiledMapPath(mapPath) << endl; }
+        else {
+
+            cerr << "Failed to compile " << mapPath << " (error code " << code << ")" << endl;
+            failures++;
+
+        }
+
+    }
+
+    return failures == 0 ? 0 : 1;
+
+}
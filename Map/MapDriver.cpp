@@ -232,3 +232,148 @@ void testLoadMaps() {
     delete gameMap;
 
 }
+
+void testTerritoryQueries() {
+
+    cout << "=== testTerritoryQueries() ===" << endl;
+
+    // --- Load Map ---
+    string mapPath = "../Map/test_maps/Brazil/Brazil.map";
+    MapLoader loader;
+
+    if (loader.importMapInfo(mapPath) != 0) {
+
+        cerr << "Map import failed!" << endl;
+        return;
+
+    }
+
+    pair<bool, Map*> loadMapResults = loader.loadMap();
+
+    if (loadMapResults.first != 0 || loadMapResults.second == nullptr) {
+
+        cerr << "Map build failed!" << endl;
+        return;
+
+    }
+
+    Map* gameMap = loadMapResults.second;
+    vector<Territory*> allTerritories = gameMap -> getTerritories();
+    unordered_map<Continent*, long long> playerContHashmap = gameMap -> buildEmptyContinentHashmap();
+
+    // --- Setup Players: Bob holds IDs 3 and 4 in Amazonas, Alice everything else ---
+    Player* alice = new Player("Alice", playerContHashmap);
+    Player* bob = new Player("Bob", playerContHashmap);
+
+    for(Territory* t : allTerritories) { alice -> addOwnedTerritories(t); }
+    bob -> addOwnedTerritories(allTerritories[2]); //ID 3. Neighbours: 2, 4, 7, 8
+    bob -> addOwnedTerritories(allTerritories[3]); //ID 4. Neighbours: 3, 5
+
+    int checks = 0, failed = 0;
+    auto check = [&](const string& name, bool passed) {
+
+        checks++;
+        if(!passed) { failed++; }
+        cout << "  " << name << ": " << (passed ? "PASSED" : "FAILED") << endl;
+
+    };
+
+    //A path is usable if consecutive territories are neighbors and everything before the goal belongs to owner
+    auto walkable = [](const vector<Territory*>& path, Player* owner) {
+
+        for(size_t i = 0; i < path.size(); i++) {
+
+            if(i + 1 < path.size() && path[i] -> getOwner() != owner) { return false; }
+
+            if(i > 0) {
+
+                const vector<Territory*>& neighbors = path[i - 1] -> getNeighbors();
+                if(find(neighbors.begin(), neighbors.end(), path[i]) == neighbors.end()) { return false; }
+
+            }
+
+        }
+
+        return !path.empty();
+
+    };
+
+    // --- Shortest path through owned territory ---
+    cout << "\n--- shortestPathThroughOwned ---" << endl;
+
+    Territory* terrA = allTerritories[0]; //ID 1. Neighbours: 2
+    Territory* terrC = allTerritories[2]; //ID 3, Bob
+    Territory* terrE = allTerritories[4]; //ID 5. Neighbours: 4, 6, 7
+
+    vector<Territory*> ownedPath;
+    bool found = gameMap -> shortestPathThroughOwned(terrA, terrE, alice, ownedPath);
+    vector<Territory*> anyPath = gameMap -> shortestPathBetweenTerritories(terrA, terrE);
+
+    cout << "  1 -> 5 through Alice's territory:";
+    for(Territory* t : ownedPath) { cout << " " << t -> getID(); }
+    cout << " (" << anyPath.size() << " territories when Bob's may be crossed)" << endl;
+
+    check("path to an owned goal avoids Bob's territories", found && walkable(ownedPath, alice) && ownedPath.front() == terrA && ownedPath.back() == terrE);
+    check("detour is no shorter than the unrestricted path", found && ownedPath.size() >= anyPath.size());
+
+    found = gameMap -> shortestPathThroughOwned(terrA, terrC, alice, ownedPath);
+    check("hostile goal is reached as the final attack hop", found && walkable(ownedPath, alice) && ownedPath.back() == terrC && ownedPath.size() == 3);
+
+    check("start owned by someone else finds no path", !gameMap -> shortestPathThroughOwned(terrC, terrA, alice, ownedPath) && ownedPath.empty());
+
+    // --- Frontline field ---
+    cout << "\n--- computeFrontlineField ---" << endl;
+
+    FrontlineField field;
+    int frontlineCount = gameMap -> computeFrontlineField(alice, field);
+    cout << "  Alice has " << frontlineCount << " frontline territories" << endl;
+
+    bool frontlineMatches = true; //Distance 0 exactly on territories bordering someone else's
+    bool hopsDescend = true; //Every next hop is an owned neighbor one step closer
+    bool distancesMatchPaths = true; //Distance equals the owned path length to the nearest frontline
+    int deepest = 0;
+
+    for(Territory* t : allTerritories) {
+
+        int i = t -> getIndex();
+        int distance = field.distance[i];
+
+        if(t -> getOwner() != alice) {
+
+            frontlineMatches = frontlineMatches && distance == -1;
+            continue;
+
+        }
+
+        bool bordersOther = false;
+        for(Territory* neighbor : t -> getNeighbors()) { bordersOther = bordersOther || neighbor -> getOwner() != alice; }
+
+        frontlineMatches = frontlineMatches && (distance == 0) == bordersOther;
+        if(distance <= 0) { continue; }
+
+        deepest = max(deepest, distance);
+
+        Territory* next = allTerritories[field.nextHop[i]];
+        const vector<Territory*>& neighbors = t -> getNeighbors();
+        hopsDescend = hopsDescend && next -> getOwner() == alice && field.distance[next -> getIndex()] == distance - 1
+                      && find(neighbors.begin(), neighbors.end(), next) != neighbors.end();
+
+        Territory* frontline = allTerritories[field.nearestFrontline[i]];
+        distancesMatchPaths = distancesMatchPaths && gameMap -> shortestPathThroughOwned(t, frontline, alice, ownedPath)
+                              && static_cast<int>(ownedPath.size()) == distance + 1;
+
+    }
+
+    cout << "  Deepest territory is " << deepest << " hop(s) from the frontline" << endl;
+    check("frontline is exactly the territories bordering Bob", frontlineCount > 0 && frontlineMatches);
+    check("next hops lead one step closer to the frontline", hopsDescend);
+    check("distances match owned shortest paths", distancesMatchPaths);
+
+    cout << "\n=== " << checks - failed << "/" << checks << " checks passed ===" << endl;
+
+    //ALWAYS delete players first.
+    delete alice;
+    delete bob;
+    delete gameMap;
+
+}
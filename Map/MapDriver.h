@@ -1,6 +1,7 @@
 #pragma once
 
 #include <iostream>
+#include <algorithm>
 #include <filesystem>
 #include <vector>
 #include <string>
@@ -13,3 +14,9 @@ using namespace WarzonePlayer;
  * @brief Free function to test loading and validating ALL .map files from the "test_maps" directory and its subfolders.
  */
 void testLoadMaps();
+
+/**
+ * @brief Free function to check the ownership-aware queries on Brazil.map: shortest paths through owned territory only,
+ * and the frontline distance field, against what can be checked by hand from neighbors and owners.
+ */
+void testTerritoryQueries();
@@ -0,0 +1,82 @@
+#include "MapRegistry.h"
+
+#include <filesystem>
+
+#include "Map.h"
+#include "MappedFile.h"
+
+namespace WarzoneMap {
+
+    MapRegistry& MapRegistry::getInstance() {
+
+        static MapRegistry instance;
+        return instance;
+
+    }
+
+    string MapRegistry::canonicalPath(const string& path) {
+
+        error_code error;
+        filesystem::path canonical = filesystem::weakly_canonical(filesystem::path(path), error);
+
+        return error ? path : canonical.string();
+
+    }
+
+    bool MapRegistry::hashFile(const string& path, uint64_t& contentHash) {
+
+        MappedFile source;
+        if(!source.open(path)) { return false; }
+
+        contentHash = MappedFile::hashBytes(source.data(), source.size());
+        return true;
+
+    }
+
+    Map* MapRegistry::acquire(const string& path, uint64_t contentHash) const {
+
+        string key = canonicalPath(path);
+        shared_ptr<const Map> registered;
+
+        {
+
+            lock_guard<mutex> lock(registryMutex);
+
+            auto entry = entries.find(key);
+            if(entry == entries.end() || entry -> second.contentHash != contentHash) { return nullptr; }
+
+            registered = entry -> second.map;
+
+        }
+
+        //Copied without the lock, the template is immutable and keeps living through registered
+        return new Map(*registered);
+
+    }
+
+    void MapRegistry::add(const string& path, uint64_t contentHash, const Map& loaded) {
+
+        //Copying also builds loaded's topology, so the engine's map and the template share it
+        shared_ptr<const Map> registered = make_shared<const Map>(loaded);
+        string key = canonicalPath(path);
+
+        lock_guard<mutex> lock(registryMutex);
+        entries[key] = {contentHash, registered};
+
+    }
+
+    void MapRegistry::clear() {
+
+        lock_guard<mutex> lock(registryMutex);
+        entries.clear();
+
+    }
+
+    size_t MapRegistry::size() const {
+
+        lock_guard<mutex> lock(registryMutex);
+        return entries.size();
+
+    }
+
+}
@@ -0,0 +1,102 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+using namespace std;
+
+namespace WarzoneMap {
+
+    class Map; //Forward declaration
+
+    // ================= MapRegistry ================= //
+    /**
+     * @class MapRegistry
+     * @brief Process-wide cache of loaded maps, keyed by canonical path and content hash.
+     *
+     * The first engine to load a map registers a pristine copy of it. Every later load of the same file contents
+     * copies that template instead of parsing: the copy shares the template's MapTopology and RoutingTable, and
+     * only allocates the per-game state (territories with their owner and armies, continents).
+     * A file whose contents changed gets a different hash, so its old entry is replaced on the next load.
+     * All methods are thread-safe; copies are made outside the lock, so engines can load concurrently.
+     *
+     * Nothing is ever evicted: the registry keeps one template per distinct map path until the process exits, even
+     * after every engine using it is gone. A process that goes through many different maps should call clear()
+     * between batches of games.
+     */
+    class MapRegistry {
+
+        private:
+
+            struct Entry {
+
+                uint64_t contentHash;
+                shared_ptr<const Map> map; //Never modified once registered
+
+            };
+
+            unordered_map<string, Entry> entries; //Canonical path -> last registered contents
+            mutable mutex registryMutex;
+
+            MapRegistry() = default;
+
+        public:
+
+            MapRegistry(const MapRegistry&) = delete;
+            MapRegistry& operator=(const MapRegistry&) = delete;
+
+            /**
+             * @brief The registry shared by every engine of the process
+             * @return Registry instance
+             */
+            static MapRegistry& getInstance();
+
+            /**
+             * @brief Canonical form of a map path, so "Map/x.map" and "./Map/../Map/x.map" share an entry
+             * @param path File path
+             * @return Canonical path, or path itself if it cannot be resolved
+             */
+            static string canonicalPath(const string& path);
+
+            /**
+             * @brief Hashes a map file's contents the same way MapLoader does
+             * @param path File path
+             * @param contentHash Set to MappedFile::hashBytes() of the contents
+             * @return false if the file cannot be read
+             */
+            static bool hashFile(const string& path, uint64_t& contentHash);
+
+            /**
+             * @brief Copies the registered map of a file
+             * @param path File path
+             * @param contentHash Hash of the file's current contents
+             * @return New Map owned by the caller, sharing the template's topology and routing table,
+             * or nullptr if nothing is registered for these contents
+             */
+            Map* acquire(const string& path, uint64_t contentHash) const;
+
+            /**
+             * @brief Registers a freshly loaded map, replacing any entry of the same path
+             * @param path File path the map was loaded from
+             * @param contentHash Hash of the contents it was loaded from
+             * @param loaded Map as returned by MapLoader::loadMap(), before any game state is set on it
+             */
+            void add(const string& path, uint64_t contentHash, const Map& loaded);
+
+            /**
+             * @brief Drops every registered map. Maps already handed out stay valid.
+             */
+            void clear();
+
+            /**
+             * @brief Number of registered maps
+             * @return Entry count
+             */
+            size_t size() const;
+
+    };
+
+}
@@ -0,0 +1,72 @@
+#include "MappedFile.h"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace WarzoneMap {
+
+    // ================= MappedFile ================= //
+
+    MappedFile::MappedFile() : bytes(nullptr), length(0) {}
+
+    MappedFile::~MappedFile() { close(); }
+
+    bool MappedFile::open(const string& path) {
+
+        close();
+
+        int fd = ::open(path.c_str(), O_RDONLY);
+        if(fd < 0) { return false; }
+
+        struct stat info;
+        if(fstat(fd, &info) != 0 || info.st_size <= 0) {
+
+            ::close(fd);
+            return false;
+
+        }
+
+        void* mapping = mmap(nullptr, static_cast<size_t>(info.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+        ::close(fd); //The mapping keeps the file alive
+
+        if(mapping == MAP_FAILED) { return false; }
+
+        bytes = static_cast<const uint8_t*>(mapping);
+        length = static_cast<size_t>(info.st_size);
+        return true;
+
+    }
+
+    void MappedFile::close() {
+
+        if(bytes != nullptr) { munmap(const_cast<uint8_t*>(bytes), length); }
+
+        bytes = nullptr;
+        length = 0;
+
+    }
+
+    bool MappedFile::isOpen() const { return bytes != nullptr; }
+
+    const uint8_t* MappedFile::data() const { return bytes; }
+
+    size_t MappedFile::size() const { return length; }
+
+    uint64_t MappedFile::hashBytes(const uint8_t* data, size_t size) {
+
+        uint64_t hash = 1469598103934665603ULL;
+
+        for(size_t i = 0; i < size; i++) {
+
+            hash ^= data[i];
+            hash *= 1099511628211ULL;
+
+        }
+
+        return hash;
+
+    }
+
+}
@@ -0,0 +1,84 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+using namespace std;
+
+namespace WarzoneMap {
+
+    // ================= MappedFile ================= //
+    /**
+     * @class MappedFile
+     * @brief Read-only memory mapping of a whole file, for binary formats that are validated in place instead of parsed.
+     *
+     * The mapping starts on a page boundary, so sections padded to 8 bytes can be read through typed pointers.
+     */
+    class MappedFile {
+
+        private:
+
+            const uint8_t* bytes;
+            size_t length;
+
+        public:
+
+            //-- Constructors, Destructor --//
+
+            /**
+             * @brief Default constructor, nothing is mapped
+             */
+            MappedFile();
+
+            /**
+             * @brief Destructor, unmaps the file
+             */
+            ~MappedFile();
+
+            MappedFile(const MappedFile&) = delete;
+            MappedFile& operator=(const MappedFile&) = delete;
+
+            //-- Class Methods --//
+
+            /**
+             * @brief Maps a file, unmapping the previous one
+             * @param path File path
+             * @return false if the file cannot be opened or is empty
+             */
+            bool open(const string& path);
+
+            /**
+             * @brief Unmaps the file
+             */
+            void close();
+
+            /**
+             * @brief Whether a file is mapped
+             * @return true if mapped
+             */
+            bool isOpen() const;
+
+            /**
+             * @brief First byte of the file
+             * @return Pointer to the mapping, nullptr if nothing is mapped
+             */
+            const uint8_t* data() const;
+
+            /**
+             * @brief Size of the mapped file
+             * @return Size in bytes
+             */
+            size_t size() const;
+
+            /**
+             * @brief FNV-1a hash of a byte range, used to identify file contents
+             * @param data First byte
+             * @param size Number of bytes
+             * @return 64-bit hash
+             */
+            static uint64_t hashBytes(const uint8_t* data, size_t size);
+
+    };
+
+}
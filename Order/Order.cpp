@@ -1,5 +1,9 @@
 #include "Order.h"
 
+#include <mutex>
+#include <atomic>
+#include <iomanip>
+
 namespace WarzoneOrder {
 
     /*------------------------------------------TIME UTILITY CLASS--------------------------------------------------*/
@@ -32,6 +36,602 @@ namespace WarzoneOrder {
         
     }
 
+    /*------------------------------------------BATTLE DICE--------------------------------------------------*/
+
+    namespace {
+
+        thread_local unsigned long long battleSeed = 0;
+
+        //SplitMix64 step, small and good enough to spread a battle's rolls
+        unsigned long long splitMix(unsigned long long& state) {
+
+            unsigned long long z = (state += 0x9E3779B97F4A7C15ULL);
+            z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+            z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+            return z ^ (z >> 31);
+
+        }
+
+    }
+
+    void BattleDice::setSeed(unsigned long long seed) { battleSeed = seed; }
+
+    unsigned long long BattleDice::getSeed() { return battleSeed; }
+
+    /*------------------------------------------ORDER POOL--------------------------------------------------*/
+
+    namespace {
+
+        //Block sizes are rounded up to this granularity, one free list per multiple
+        const size_t ORDER_POOL_GRANULARITY = 16;
+        const size_t ORDER_POOL_CLASSES = ORDER_POOL_MAX_BLOCK / ORDER_POOL_GRANULARITY;
+
+        struct FreeBlock { FreeBlock* next; };
+
+        struct OrderPoolState {
+
+            mutex lock;
+            FreeBlock* freeLists[ORDER_POOL_CLASSES] = {};
+            vector<char*> chunks;
+            char* chunkCursor = nullptr;
+            size_t chunkRemaining = 0;
+            size_t liveBlocks = 0;
+
+        };
+
+        //Never destroyed, orders owned by static objects may still be deleted during program exit
+        OrderPoolState& orderPoolState() {
+
+            static OrderPoolState* state = new OrderPoolState();
+            return *state;
+
+        }
+
+        size_t orderPoolClass(size_t size) { return (size + ORDER_POOL_GRANULARITY - 1) / ORDER_POOL_GRANULARITY - 1; }
+
+    }
+
+    void* OrderPool::allocate(size_t size) {
+
+        if(size == 0 || size > ORDER_POOL_MAX_BLOCK) { return ::operator new(size); } //Not pooled
+
+        size_t sizeClass = orderPoolClass(size);
+        size_t blockSize = (sizeClass + 1) * ORDER_POOL_GRANULARITY;
+
+        OrderPoolState& state = orderPoolState();
+        lock_guard<mutex> guard(state.lock);
+
+        state.liveBlocks++;
+
+        //Reuse a freed block of the same size class
+        if(state.freeLists[sizeClass] != nullptr) {
+
+            FreeBlock* block = state.freeLists[sizeClass];
+            state.freeLists[sizeClass] = block -> next;
+            return block;
+
+        }
+
+        //Otherwise carve a new one, starting a new chunk if needed (the tail of the old one is dropped)
+        if(state.chunkRemaining < blockSize) {
+
+            state.chunkCursor = static_cast<char*>(::operator new(ORDER_POOL_CHUNK_BYTES));
+            state.chunks.push_back(state.chunkCursor);
+            state.chunkRemaining = ORDER_POOL_CHUNK_BYTES;
+
+        }
+
+        void* block = state.chunkCursor;
+        state.chunkCursor += blockSize;
+        state.chunkRemaining -= blockSize;
+
+        return block;
+
+    }
+
+    void OrderPool::deallocate(void* ptr, size_t size) {
+
+        if(ptr == nullptr) { return; }
+
+        if(size == 0 || size > ORDER_POOL_MAX_BLOCK) { //Not pooled
+
+            ::operator delete(ptr);
+            return;
+
+        }
+
+        size_t sizeClass = orderPoolClass(size);
+
+        OrderPoolState& state = orderPoolState();
+        lock_guard<mutex> guard(state.lock);
+
+        FreeBlock* block = static_cast<FreeBlock*>(ptr);
+        block -> next = state.freeLists[sizeClass];
+        state.freeLists[sizeClass] = block;
+
+        state.liveBlocks--;
+
+    }
+
+    size_t OrderPool::getLiveBlocks() {
+
+        OrderPoolState& state = orderPoolState();
+        lock_guard<mutex> guard(state.lock);
+        return state.liveBlocks;
+
+    }
+
+    size_t OrderPool::getReservedBytes() {
+
+        OrderPoolState& state = orderPoolState();
+        lock_guard<mutex> guard(state.lock);
+        return state.chunks.size() * ORDER_POOL_CHUNK_BYTES;
+
+    }
+
+    /*------------------------------------------ORDER STATS--------------------------------------------------*/
+
+    namespace {
+
+        size_t battleBucketOf(int armies) {
+
+            size_t bucket = 0;
+            for(unsigned int v = static_cast<unsigned int>(max(armies, 0)); v != 0; v >>= 1) { bucket++; }
+            return min(bucket, ORDER_STATS_BATTLE_BUCKETS - 1);
+
+        }
+
+    }
+
+    uint64_t LatencyHistogram::total() const {
+
+        uint64_t sum = 0;
+        for(uint64_t c : counts) { sum += c; }
+        return sum;
+
+    }
+
+    long long LatencyHistogram::percentile(double q) const {
+
+        uint64_t samples = total();
+        if(samples == 0) { return 0; }
+
+        uint64_t rank = static_cast<uint64_t>(q * static_cast<double>(samples - 1)) + 1;
+        uint64_t seen = 0;
+
+        for(size_t b = 0; b < counts.size(); b++) {
+
+            seen += counts[b];
+            if(seen >= rank) { return bucketLowerBound(b); }
+
+        }
+
+        return bucketLowerBound(counts.size() - 1);
+
+    }
+
+    size_t LatencyHistogram::bucketOf(long long nanos) {
+
+        if(nanos < 16) { return nanos < 0 ? 0 : static_cast<size_t>(nanos); }
+
+        unsigned long long v = static_cast<unsigned long long>(nanos);
+        size_t msb = 63;
+        while(((v >> msb) & 1ULL) == 0) { msb--; }
+
+        return 16 + (msb - 4) * 8 + ((v >> (msb - 3)) & 7ULL);
+
+    }
+
+    long long LatencyHistogram::bucketLowerBound(size_t bucket) {
+
+        if(bucket < 16) { return static_cast<long long>(bucket); }
+
+        size_t msb = 4 + (bucket - 16) / 8;
+        unsigned long long sub = (bucket - 16) % 8;
+        return static_cast<long long>((8ULL + sub) << (msb - 3));
+
+    }
+
+    ostream& operator<<(ostream& os, const OrderStatsSnapshot& stats) {
+
+        static const char* names[ORDER_TYPE_COUNT] = { "Deploy", "Advance", "Bomb", "Blockade", "Airlift", "Negotiate" };
+
+        os << "[OrderStats] type       executed    success    failure    invalid   p50(ns)   p99(ns)  max(ns)\n";
+
+        for(size_t t = 0; t < ORDER_TYPE_COUNT; t++) {
+
+            const OrderTypeStats& s = stats.types[t];
+            os << "[OrderStats] " << left << setw(10) << names[t] << right
+               << setw(9) << s.executed() << setw(11) << s.succeeded << setw(11) << s.failed << setw(11) << s.invalid
+               << setw(10) << s.latency.percentile(0.5) << setw(10) << s.latency.percentile(0.99)
+               << setw(9) << s.latency.percentile(1.0) << "\n";
+
+        }
+
+        os << "[OrderStats] Advance battles: " << stats.battles << "\n";
+
+        for(size_t b = 0; b < ORDER_STATS_BATTLE_BUCKETS; b++) {
+
+            if(stats.battleAttackers[b] == 0 && stats.battleDefenders[b] == 0) { continue; }
+
+            long long low = b == 0 ? 0 : 1LL << (b - 1);
+            long long high = b == 0 ? 0 : (1LL << b) - 1;
+            os << "[OrderStats]   armies " << low << "-" << high << ": "
+               << stats.battleAttackers[b] << " attacking, " << stats.battleDefenders[b] << " defending\n";
+
+        }
+
+        return os;
+
+    }
+
+    thread_local OrderStats* OrderStats::current = nullptr;
+
+    void OrderStats::setEnabled(bool enabled) { this -> enabled.store(enabled, memory_order_relaxed); }
+
+    bool OrderStats::isEnabled() const { return enabled.load(memory_order_relaxed); }
+
+    long long OrderStats::start() const {
+
+        if(!isEnabled()) { return 0; }
+        return chrono::duration_cast<chrono::nanoseconds>(chrono::steady_clock::now().time_since_epoch()).count();
+
+    }
+
+    void OrderStats::record(OrderType type, ExecutionResult result, long long started) {
+
+        if(started == 0) { return; }
+
+        long long now = chrono::duration_cast<chrono::nanoseconds>(chrono::steady_clock::now().time_since_epoch()).count();
+        recordElapsed(type, result, now - started);
+
+    }
+
+    void OrderStats::recordElapsed(OrderType type, ExecutionResult result, long long elapsed) {
+
+        size_t t = static_cast<size_t>(type);
+
+        results[t][static_cast<size_t>(result)].fetch_add(1, memory_order_relaxed);
+        latency[t][LatencyHistogram::bucketOf(elapsed)].fetch_add(1, memory_order_relaxed);
+
+    }
+
+    void OrderStats::recordBattle(int attackers, int defenders) {
+
+        if(!isEnabled()) { return; }
+
+        battleAttackers[battleBucketOf(attackers)].fetch_add(1, memory_order_relaxed);
+        battleDefenders[battleBucketOf(defenders)].fetch_add(1, memory_order_relaxed);
+        battles.fetch_add(1, memory_order_relaxed);
+
+    }
+
+    OrderStatsSnapshot OrderStats::snapshot() const {
+
+        OrderStatsSnapshot stats;
+
+        for(size_t t = 0; t < ORDER_TYPE_COUNT; t++) {
+
+            stats.types[t].succeeded = results[t][static_cast<size_t>(ExecutionResult::Success)].load(memory_order_relaxed);
+            stats.types[t].failed = results[t][static_cast<size_t>(ExecutionResult::Failure)].load(memory_order_relaxed);
+            stats.types[t].invalid = results[t][static_cast<size_t>(ExecutionResult::Invalid)].load(memory_order_relaxed);
+
+            for(size_t b = 0; b < ORDER_STATS_LATENCY_BUCKETS; b++) { stats.types[t].latency.counts[b] = latency[t][b].load(memory_order_relaxed); }
+
+        }
+
+        for(size_t b = 0; b < ORDER_STATS_BATTLE_BUCKETS; b++) {
+
+            stats.battleAttackers[b] = battleAttackers[b].load(memory_order_relaxed);
+            stats.battleDefenders[b] = battleDefenders[b].load(memory_order_relaxed);
+
+        }
+
+        stats.battles = battles.load(memory_order_relaxed);
+        return stats;
+
+    }
+
+    void OrderStats::reset() {
+
+        for(size_t t = 0; t < ORDER_TYPE_COUNT; t++) {
+
+            for(auto& c : results[t]) { c.store(0, memory_order_relaxed); }
+            for(auto& c : latency[t]) { c.store(0, memory_order_relaxed); }
+
+        }
+
+        for(auto& c : battleAttackers) { c.store(0, memory_order_relaxed); }
+        for(auto& c : battleDefenders) { c.store(0, memory_order_relaxed); }
+        battles.store(0, memory_order_relaxed);
+
+    }
+
+    /*------------------------------------------ORDER KERNELS--------------------------------------------------*/
+    //Game state changes shared by the Order classes and the OrderRecord executor, callers validate first
+
+    namespace {
+
+        bool hasTruceWith(const Player* issuer, const Player* other) {
+
+            const vector<Player*>& neutrals = issuer -> getNeutralEnemies(); //List of players under truce
+            return find(neutrals.begin(), neutrals.end(), other) != neutrals.end();
+
+        }
+
+        bool isAdjacentTo(const Territory* source, const Territory* target) {
+
+            const vector<Territory*>& neighbors = source -> getNeighbors();
+            return find(neighbors.begin(), neighbors.end(), target) != neighbors.end();
+
+        }
+
+        ValidationStatus checkDeploy(const Player* issuer, const Territory* target, int numArmies) {
+
+            if(issuer == nullptr || target == nullptr) { return ValidationStatus::NullPointer; }
+            if(target -> getOwner() != issuer) { return ValidationStatus::NotOwned; } // Territory must belong to the issuing player
+            if(numArmies <= 0) { return ValidationStatus::NotEnoughArmies; } // Army count must be positive
+
+            return ValidationStatus::Valid;
+
+        }
+
+        ValidationStatus checkAdvance(const Player* issuer, const Territory* source, const Territory* target, int numArmies) {
+
+            if(issuer == nullptr || source == nullptr || target == nullptr) { return ValidationStatus::NullPointer; }
+            if(source -> getOwner() != issuer) { return ValidationStatus::NotOwned; } //Player must own the source territory
+            if(numArmies <= 0 || source -> getNumArmies() < numArmies) { return ValidationStatus::NotEnoughArmies; }
+            if(!isAdjacentTo(source, target)) { return ValidationStatus::NotAdjacent; } //Any advance order requires the target to be adjacent to the source
+
+            //Check if the attacker has a truce with the defender
+            Player* defender = target -> getOwner();
+            if(defender != nullptr && hasTruceWith(issuer, defender)) { return ValidationStatus::TruceActive; }
+
+            return ValidationStatus::Valid;
+
+        }
+
+        ValidationStatus checkBomb(const Player* issuer, const Territory* target) {
+
+            if(issuer == nullptr || target == nullptr) { return ValidationStatus::NullPointer; }
+
+            Player* defender = target -> getOwner();
+            if(defender == nullptr) { return ValidationStatus::NoOwner; }
+            if(defender == issuer) { return ValidationStatus::OwnTerritory; }
+            if(hasTruceWith(issuer, defender)) { return ValidationStatus::TruceActive; }
+
+            //Same targets as Player::getBombCandidates(): more than 1 army, adjacent to an owned territory
+            if(target -> getNumArmies() <= 1) { return ValidationStatus::NotBombable; }
+
+            for(Territory* owned : issuer -> getOwnedTerritories().getTerritories()) {
+
+                if(owned != nullptr && isAdjacentTo(owned, target)) { return ValidationStatus::Valid; }
+
+            }
+
+            return ValidationStatus::NotBombable;
+
+        }
+
+        ValidationStatus checkBlockade(const Player* issuer, const Territory* target, const Player* neutralPlayer) {
+
+            if(issuer == nullptr || target == nullptr || neutralPlayer == nullptr) { return ValidationStatus::NullPointer; }
+            if(target -> getOwner() != issuer) { return ValidationStatus::NotOwned; } //Target must belong to the issuing player
+
+            //Player must own more than 1 territory. They would make themselves lose otherwise
+            if(issuer -> getOwnedTerritories().getTerritories().size() <= 1) { return ValidationStatus::LastTerritory; }
+
+            return ValidationStatus::Valid;
+
+        }
+
+        ValidationStatus checkAirlift(const Player* issuer, const Territory* source, const Territory* target, int numArmies) {
+
+            if(issuer == nullptr || source == nullptr || target == nullptr) { return ValidationStatus::NullPointer; }
+
+            //Make sure the player owns both the source and the target territory
+            if(source -> getOwner() != issuer || target -> getOwner() != issuer) { return ValidationStatus::NotOwned; }
+
+            // Check if enough armies to move (must leave at least 1 behind)
+            if(numArmies <= 0 || source -> getNumArmies() <= 1) { return ValidationStatus::NotEnoughArmies; }
+            if(numArmies > source -> getNumArmies() - 1) { return ValidationStatus::TooManyArmies; }
+
+            return ValidationStatus::Valid;
+
+        }
+
+        ValidationStatus checkNegotiate(const Player* issuer, const Player* targetPlayer) {
+
+            if(issuer == nullptr || targetPlayer == nullptr) { return ValidationStatus::NullPointer; }
+            if(issuer == targetPlayer) { return ValidationStatus::SelfTarget; } //Player can't negotiate with themselves
+            if(hasTruceWith(issuer, targetPlayer)) { return ValidationStatus::TruceActive; } //Truce already declared
+
+            return ValidationStatus::Valid;
+
+        }
+
+        void applyDeploy(Player* issuer, Territory* target, int numArmies) {
+
+            // Add armies to target
+            target -> setNumArmies(target -> getNumArmies() + numArmies);
+
+            // --- Safeguard: ensure target is tracked by issuer ---
+            if (!issuer -> getOwnedTerritories().owns(target)) { issuer -> addOwnedTerritories(target); }
+
+        }
+
+        /**
+         * @brief Result of an Advance, armies is the number moved (Moved), surviving attackers (Conquered)
+         * or remaining defenders (Repelled, Inconclusive)
+         */
+        struct AdvanceOutcome {
+
+            enum class Kind { NotEnoughArmies, Moved, Conquered, Inconclusive, Repelled };
+
+            Kind kind;
+            int armies;
+
+        };
+
+        AdvanceOutcome applyAdvance(Player* issuer, Territory* source, Territory* target, int numArmies, OrderStats* stats) {
+
+            // --- If target is also owned by issuer, reinforce ---
+            if (target -> getOwner() == issuer) {
+
+                if (source -> getNumArmies() <= 1) { return { AdvanceOutcome::Kind::NotEnoughArmies, 0 }; } //1 Army MUST remain on the source 
+
+                int numArmiesMovable = min(numArmies, source -> getNumArmies() - 1); //Ensure 1 army stays on source
+
+                source -> setNumArmies(source -> getNumArmies() - numArmiesMovable); // Remove Armies from source
+                target -> setNumArmies(target -> getNumArmies() + numArmiesMovable); // Add armies to target
+
+                //Ensure both territories are tracked by issuer ---
+                if (!issuer -> getOwnedTerritories().owns(source)) { issuer -> addOwnedTerritories(source); }
+                if (!issuer -> getOwnedTerritories().owns(target)) { issuer -> addOwnedTerritories(target); }
+
+                return { AdvanceOutcome::Kind::Moved, numArmiesMovable };
+            
+            }
+
+            // --- Perform battle logic
+            if(source -> getNumArmies() <= 1) { return { AdvanceOutcome::Kind::NotEnoughArmies, 0 }; } //1 Army MUST remain on the source 
+
+            int attackArmies = min(numArmies, source -> getNumArmies() - 1); //Ensure 1 army stays on source
+            int defenseArmies = target -> getNumArmies();
+            if(stats != nullptr) { stats -> recordBattle(attackArmies, defenseArmies); }
+
+            //Seeded battles roll from their own stream, clock otherwise
+            unsigned long long diceState = BattleDice::getSeed();
+            if(diceState != 0) {
+
+                diceState ^= (static_cast<unsigned long long>(source -> getIndex()) << 40) ^ (static_cast<unsigned long long>(target -> getIndex()) << 20);
+                diceState ^= (static_cast<unsigned long long>(attackArmies) << 32) ^ static_cast<unsigned long long>(defenseArmies);
+                splitMix(diceState);
+
+            }
+
+            auto roll = [&diceState]() -> long long {
+
+                if(diceState == 0) { return static_cast<long long>(TimeUtil::getSystemTimeNano()) % 10000; }
+                return static_cast<long long>(splitMix(diceState) % 10000);
+
+            };
+
+            //Remove armies from source no matter what
+            source -> setNumArmies(source -> getNumArmies() - attackArmies);
+
+            int attackersRemaining = attackArmies;
+            int defendersRemaining = defenseArmies;
+
+            //Boolean flags to help determine the result of battle-turns
+            bool reduceAttacker = false;
+            bool reduceDefense = false;
+
+            /**
+             * Simultaneous battle: attackers have 60% chance kill a defender, defenders have a 70% chance to kill an attacker
+             * Attacker has to have 1 army on their source territory at a minimum
+             */
+             while(attackersRemaining > 1 && defendersRemaining > 0){ 
+
+                reduceAttacker = false;
+                reduceDefense = false;
+
+                //Defender has 70% chance to kill attacking army
+                if(roll() < 7000) {
+                    
+                    reduceAttacker = true;
+
+                }
+
+
+                //Attacker has 60% chance to kill defending army
+                if(roll() < 6000){
+
+                    reduceDefense = true;
+
+                }
+
+                //Prevents attackers from being reduced to 1 in the case of attacker winning
+                if(reduceAttacker  && attackersRemaining > 1){ attackersRemaining--; }
+                if(reduceDefense && defendersRemaining > 0){ defendersRemaining--; }
+
+            }
+
+            //--- Resolve outcome ---
+            if(defendersRemaining <= 0) {
+
+                if(attackersRemaining > 1) { // Successful conquest
+
+                    //Transfer ownership
+                    issuer -> addOwnedTerritories(target);
+                    target -> setNumArmies(attackersRemaining);
+
+                    issuer -> setGenerateCardThisTurn(true); //Attacker earns a card at turn end
+
+                    return { AdvanceOutcome::Kind::Conquered, attackersRemaining };
+
+                }
+
+                //Edge case: attacker “wins” but can’t move in
+                target -> setNumArmies(1);
+                return { AdvanceOutcome::Kind::Inconclusive, 1 };
+
+            }
+
+            // Defender Wins
+            target -> setNumArmies(defendersRemaining);
+            return { AdvanceOutcome::Kind::Repelled, defendersRemaining };
+
+        }
+
+        int applyBomb(Territory* target) {
+
+            int currentArmies = target -> getNumArmies();
+            int armiesToRemove = currentArmies / 2; // Remove half, rounded down
+            
+            target -> setNumArmies(currentArmies - armiesToRemove);
+            return armiesToRemove;
+
+        }
+
+        void applyBlockade(Territory* target, Player* neutralPlayer) {
+
+            //Step 1: Triple the armies
+            target -> setNumArmies((target -> getNumArmies()) * 3);
+
+            //Step 2: Transfer ownership to Neutral player
+            neutralPlayer -> addOwnedTerritories(target); //Add territory to neutral player
+
+        }
+
+        int applyAirlift(Territory* source, Territory* target, int numArmies) {
+
+            int armiesToMove = min(numArmies, source -> getNumArmies() - 1);
+
+            source -> setNumArmies(source -> getNumArmies() - armiesToMove);
+            target -> setNumArmies(target -> getNumArmies() + armiesToMove);
+            return armiesToMove;
+
+        }
+
+        void applyNegotiate(Player* issuer, Player* targetPlayer) {
+
+            issuer -> addNeutralEnemy(targetPlayer);
+            targetPlayer -> addNeutralEnemy(issuer);
+
+        }
+
+        int32_t territoryIndexOf(const Territory* t) { return t != nullptr ? t -> getIndex() : -1; }
+
+        Territory* resolveTerritory(int32_t index, const vector<Territory*>& territories) {
+
+            if(index < 0 || index >= static_cast<int32_t>(territories.size())) { return nullptr; }
+            return territories[index];
+
+        }
+
+    }
+
     /*------------------------------------------ ORDER SUPER-CLASS ------------------------------------------------*/
     // ================= Order (base class) ================= //
 
@@ -60,6 +660,10 @@ namespace WarzoneOrder {
 
     }
 
+    void* Order::operator new(size_t size) { return OrderPool::allocate(size); }
+
+    void Order::operator delete(void* ptr, size_t size) { OrderPool::deallocate(ptr, size); }
+
     Order::Order(const Order& other) {
 
         this -> orderType = other.orderType;
@@ -141,6 +745,33 @@ namespace WarzoneOrder {
         return "[OrderLog] " + getOrderTypeString() + " | Effect: " + (effect.empty() ? "None" : effect);
     }
 
+    pair<bool, string> Order::validate() const {
+
+        ValidationStatus status = check();
+        return { status == ValidationStatus::Valid, validationMessage(status) };
+
+    }
+
+    void Order::execute() {
+
+        OrderStats* stats = OrderStats::getCurrent();
+        long long started = stats != nullptr ? stats -> start() : 0;
+        ValidationStatus status = check();
+
+        if(status != ValidationStatus::Valid) {
+
+            this -> setEffect(validationMessage(status));
+            if(stats != nullptr) { stats -> record(orderType, ExecutionResult::Invalid, started); }
+            notify(this);
+            return;
+
+        }
+
+        bool succeeded = executeValidated();
+        if(stats != nullptr) { stats -> record(orderType, succeeded ? ExecutionResult::Success : ExecutionResult::Failure, started); }
+
+    }
+
 
 
     /*------------------------------------------ SINGLE ORDER SUB-CLASSES ------------------------------------------------*/
@@ -231,70 +862,55 @@ namespace WarzoneOrder {
 
     Order* Deploy::clone() const { return new Deploy(*this); }
 
-    pair<bool, string> Deploy::validate() const {
+    OrderRecord Deploy::toRecord() const { return { issuer, nullptr, -1, territoryIndexOf(target), numArmies, OrderType::Deploy }; }
+
+    ValidationStatus Deploy::check() const { return checkDeploy(issuer, target, numArmies); }
+
+    string Deploy::validationMessage(ValidationStatus status) const {
 
         ostringstream output;
 
-        //Check if either the territory or the player are null pointers
-        if(issuer == nullptr || target == nullptr){ 
-        
-            return {false, "[IssueOrder] This deploy order is invalid, at least one inputted pointer (issuer/target) is null."}; 
-        
-        } 
+        switch(status) {
 
-        // Territory must belong to the issuing player
-        if(target -> getOwner() != issuer){
+            case ValidationStatus::Valid: return "[IssueOrder] This deploy order is valid";
 
+            case ValidationStatus::NullPointer: return "[IssueOrder] This deploy order is invalid, at least one inputted pointer (issuer/target) is null.";
 
-            output << "[IssueOrder] This deploy order is invalid, target territory "
-                   << target -> getID() << " is owned not owned by the issuer, "
-                   << issuer -> getPlayerName()
-                   << ". It is owned by "
-                   << (target -> getOwner() ? target -> getOwner() -> getPlayerName() : "an unknown player")
-                   << ".";
+            case ValidationStatus::NotOwned:
 
-            return {false, output.str()}; 
+                output << "[IssueOrder] This deploy order is invalid, target territory "
+                       << target -> getID() << " is owned not owned by the issuer, "
+                       << issuer -> getPlayerName()
+                       << ". It is owned by "
+                       << (target -> getOwner() ? target -> getOwner() -> getPlayerName() : "an unknown player")
+                       << ".";
+                break;
 
-        }
+            case ValidationStatus::NotEnoughArmies:
 
-        // Army count must be positive
-        if(numArmies <= 0){ 
+                output << "[IssueOrder] This deploy order is invalid, target territory "
+                       << target -> getID() << " does not contain a sufficent number of armies ("
+                       << to_string(target -> getNumArmies())
+                       << ").";
+                break;
 
-            output << "[IssueOrder] This deploy order is invalid, target territory "
-                   << target -> getID() << " does not contain a sufficent number of armies ("
-                   << to_string(target -> getNumArmies())
-                   << ").";
-            
-            return {false, output.str()}; 
+            default: return "[IssueOrder] This deploy order is invalid.";
 
         }
 
-        return {true, "[IssueOrder] This deploy order is valid"}; //Return true if all conditions are met
+        return output.str();
 
     }
 
-    void Deploy::execute() {
+    bool Deploy::executeValidated() {
 
-        pair<bool, string> validateResults = validate();
-
-        if(validateResults.first == false) {
-
-            this -> setEffect(validateResults.second);
-            notify(this);
-            return;
-
-        }
-
-        // Add armies to target
-        target->setNumArmies(target->getNumArmies() + numArmies);
-
-        // --- Safeguard: ensure target is tracked by issuer ---
-        if (!issuer->getOwnedTerritories().owns(target)) { issuer->addOwnedTerritories(target); }
+        applyDeploy(issuer, target, numArmies);
 
         this -> setEffect("Deploy successful: placed " + to_string(numArmies) +
                         " armies on " + target->getID() + ".");
 
         notify(this);
+        return true;
 
     }
 
@@ -331,301 +947,178 @@ namespace WarzoneOrder {
 
         //Construct effect string safely
         this -> effect = "Player " + p -> getPlayerName() + " intends to move " 
-                        + to_string(armies) + " army/armies, from " 
-                        + s -> getID() + ", to " + t -> getID() + ".";
-
-    }
-
-    //When order is deleted, it should NOT remove any other pointers, since they still exist
-    Advance::~Advance() = default;
-
-    Advance::Advance(const Advance& other) : Order(other) {
-
-        this -> issuer = other.issuer;
-        this -> source = other.source;
-        this -> target = other.target;
-        this -> numArmies = other.numArmies;
-        this -> effect = other.effect;
-
-    }
-
-    Advance& Advance::operator=(const Advance& other) {
-
-        if(this != &other) {
-
-            Order::operator=(other);
-            this -> issuer = other.issuer;
-            this -> source = other.source;
-            this -> target = other.target;
-            this -> numArmies = other.numArmies;
-            this -> effect = other.effect;
-        
-        }
-
-        return *this;
-
-    }
-
-    void Advance::print(std::ostream& os) const {
-
-        os << "Advance Order: "
-           << (issuer ? issuer -> getPlayerName() : "Unknown Player") //Get player name
-           << " moves " << numArmies << " armies " //Get number of armies
-           << "from " << (source ? source -> getID() : "Unknown Source") //Get source territory
-           << ", owned by: " << (source ? source -> getOwner() -> getPlayerName() : "Unknown Player")
-           << " to " << (target ? target -> getID() : "Unknown Target") //Get target territory
-           << ", owned by: " << (target ? target -> getOwner() -> getPlayerName() : "Unknown Player");
-
-    }
-
-    //-- Accessors and Mutators --//
-
-    Player* Advance::getIssuer() const { return issuer; }
-    void Advance::setIssuer(Player* p) { issuer = p; }
-
-    Territory* Advance::getSource() const { return source; }
-    void Advance::setSource(Territory* s) { source = s; }
-
-    Territory* Advance::getTarget() const { return target; }
-    void Advance::setTarget(Territory* t) { target = t; }
-
-    int Advance::getNumArmies() const { return numArmies; }
-    void Advance::setNumArmies(int armies) { numArmies = armies; }
-
-    //-- Overridden Class Methods --//
-
-    Order* Advance::clone() const { return new Advance(*this); }
-
-    pair<bool, string> Advance::validate() const {
-
-        ostringstream output; // Collect validation details
-
-        //Check if either of the territories, or the player, are null pointers
-        if(issuer == nullptr || source == nullptr || target == nullptr) { 
-            
-            return { false, "[IssueOrder] This advance order is invalid: one or more inputted pointers (issuer/source/target) are null." }; 
-        
-        }
-
-        //Player must own the source territory
-        if(source -> getOwner() != issuer){ 
-
-            output << "[IssueOrder] This advance order is invalid: source territory "
-                   << source -> getID() << " is not owned by the issuing player "
-                   << issuer -> getPlayerName() << ". It is owned by "
-                   << (source -> getOwner() ? source -> getOwner() -> getPlayerName() : "an unknown player")
-                   << ".";
-
-            return { false, output.str() }; 
-
-        }
-
-        //Player must have enough armies, or the number of armies they use must be geq 0
-        if(numArmies <= 0 || source -> getNumArmies() < numArmies) { 
-
-            output << "[IssueOrder] This advance order is invalid: attempted to move "
-                   << numArmies << " armies, but source territory "
-                   << source -> getID() << " only has "
-                   << source -> getNumArmies() << " armies available.";
-
-            return { false, output.str() }; 
-
-        }
-
-        //Any advance order requires the target to be adjacent to the source
-        vector<Territory*> neighbors = source -> getNeighbors();
-
-        //Check if the target territory is a neighbour of the source territory
-        bool isAdjacent = (find(neighbors.begin(), neighbors.end(), target) != neighbors.end());
-        if(!isAdjacent) { 
-
-            output << "[IssueOrder] This advance order is invalid: target territory "
-                   << target -> getID() << " is not adjacent to source territory "
-                   << source -> getID() << ".";
-
-            return { false, output.str() }; 
-
-        }
-
-        //Check if the attacker has a truce with the defender
-        Player* defender = target -> getOwner();
-        
-        if(defender != nullptr) {
-
-            const vector<Player*>& neutrals = issuer -> getNeutralEnemies(); //List of players under truce
-
-            //If the defender is in the neutral list, advancing is invalid
-            if(find(neutrals.begin(), neutrals.end(), defender) != neutrals.end()) { 
-
-                output << "[IssueOrder] This advance order is invalid: the issuer ("
-                       << issuer -> getPlayerName() << ") currently has a truce with "
-                       << defender -> getPlayerName() << ", and cannot attack them.";
-
-                return { false, output.str() }; 
-            
-            }
-        
-        }
-
-        return { true, "[IssueOrder] This advance order is valid." };
+                        + to_string(armies) + " army/armies, from " 
+                        + s -> getID() + ", to " + t -> getID() + ".";
 
     }
 
+    //When order is deleted, it should NOT remove any other pointers, since they still exist
+    Advance::~Advance() = default;
 
-    void Advance::execute() {
-
-        // --- 1. Validate ownership and adjacency ---
-        pair<bool, string> validateResults = validate();
-        if(!validateResults.first) {
+    Advance::Advance(const Advance& other) : Order(other) {
 
-            this -> setEffect(validateResults.second);
-            notify(this);
-            return;
+        this -> issuer = other.issuer;
+        this -> source = other.source;
+        this -> target = other.target;
+        this -> numArmies = other.numArmies;
+        this -> effect = other.effect;
 
-        }
+    }
 
-        // --- 2. Check if source belongs to issuer ---
-        if(source -> getOwner() != issuer) {
+    Advance& Advance::operator=(const Advance& other) {
 
-            this -> setEffect("Advance failed: source territory not owned by issuer.");
-            return;
+        if(this != &other) {
 
+            Order::operator=(other);
+            this -> issuer = other.issuer;
+            this -> source = other.source;
+            this -> target = other.target;
+            this -> numArmies = other.numArmies;
+            this -> effect = other.effect;
+        
         }
 
-        // --- 3. Check adjacency ---
-        const vector<Territory*>& neighbors = source -> getNeighbors();
-
-        //Check if the target is in the neighbour vector
-        if(find(neighbors.begin(), neighbors.end(), target) == neighbors.end()){
+        return *this;
 
-            this -> setEffect("Advance failed: target territory is not adjacent.");
-            return;
+    }
 
-        }
+    void Advance::print(std::ostream& os) const {
 
-        // --- 4. If target is also owned by issuer, reinforce ---
-        if (target->getOwner() == issuer) {
+        os << "Advance Order: "
+           << (issuer ? issuer -> getPlayerName() : "Unknown Player") //Get player name
+           << " moves " << numArmies << " armies " //Get number of armies
+           << "from " << (source ? source -> getID() : "Unknown Source") //Get source territory
+           << ", owned by: " << (source ? source -> getOwner() -> getPlayerName() : "Unknown Player")
+           << " to " << (target ? target -> getID() : "Unknown Target") //Get target territory
+           << ", owned by: " << (target ? target -> getOwner() -> getPlayerName() : "Unknown Player");
 
-            if (source->getNumArmies() <= 1) { //1 Army MUST remain on the source 
+    }
 
-                this -> setEffect("Advance failed: Not enough armies to advance with.");
-                return;
-                
-            }
+    //-- Accessors and Mutators --//
 
-            int numArmiesMovable = min(numArmies, source->getNumArmies() - 1); //Ensure 1 army stays on source
+    Player* Advance::getIssuer() const { return issuer; }
+    void Advance::setIssuer(Player* p) { issuer = p; }
 
-            source->setNumArmies(source->getNumArmies() - numArmiesMovable); // Remove Armies from source
-            target->setNumArmies(target->getNumArmies() + numArmiesMovable); // Add armies to target
+    Territory* Advance::getSource() const { return source; }
+    void Advance::setSource(Territory* s) { source = s; }
 
-            //Ensure both territories are tracked by issuer ---
-            if (!issuer -> getOwnedTerritories().owns(source)) { issuer -> addOwnedTerritories(source); }
-            if (!issuer->getOwnedTerritories().owns(target)) { issuer->addOwnedTerritories(target); }
+    Territory* Advance::getTarget() const { return target; }
+    void Advance::setTarget(Territory* t) { target = t; }
 
-            this->setEffect("Advance successful: moved " + to_string(numArmiesMovable) +
-                            " armies from " + source -> getID() +
-                            " to " + target -> getID() + ".");
+    int Advance::getNumArmies() const { return numArmies; }
+    void Advance::setNumArmies(int armies) { numArmies = armies; }
 
-            return;
-        
-        }
+    //-- Overridden Class Methods --//
 
+    Order* Advance::clone() const { return new Advance(*this); }
 
-        // --- 5. Perform battle logic
-        if(source -> getNumArmies() <= 1) { //1 Army MUST remain on the source 
+    OrderRecord Advance::toRecord() const { return { issuer, nullptr, territoryIndexOf(source), territoryIndexOf(target), numArmies, OrderType::Advance }; }
 
-            this -> setEffect("Advance failed: Not enough armies to attack with.");
-            return;
+    ValidationStatus Advance::check() const { return checkAdvance(issuer, source, target, numArmies); }
 
-        }
+    string Advance::validationMessage(ValidationStatus status) const {
 
-        int attackArmies = min(numArmies, source -> getNumArmies() - 1); //Ensure 1 army stays on source
-        int defenseArmies = target -> getNumArmies();
+        ostringstream output;
 
-        //Remove armies from source no matter what
-        source -> setNumArmies(source -> getNumArmies() - attackArmies);
+        switch(status) {
 
-        int attackersRemaining = attackArmies;
-        int defendersRemaining = defenseArmies;
+            case ValidationStatus::Valid: return "[IssueOrder] This advance order is valid.";
 
-        //Boolean flags to help determine the result of battle-turns
-        bool reduceAttacker = false;
-        bool reduceDefense = false;
+            case ValidationStatus::NullPointer: return "[IssueOrder] This advance order is invalid: one or more inputted pointers (issuer/source/target) are null.";
 
-        /**
-         * Simultaneous battle: attackers have 60% chance kill a defender, defenders have a 70% chance to kill an attacker
-         * Attacker has to have 1 army on their source territory at a minimum
-         */
-         while(attackersRemaining > 1 && defendersRemaining > 0){ 
+            case ValidationStatus::NotOwned:
 
-            reduceAttacker = false;
-            reduceDefense = false;
+                output << "[IssueOrder] This advance order is invalid: source territory "
+                       << source -> getID() << " is not owned by the issuing player "
+                       << issuer -> getPlayerName() << ". It is owned by "
+                       << (source -> getOwner() ? source -> getOwner() -> getPlayerName() : "an unknown player")
+                       << ".";
+                break;
 
-            //Defender has 70% chance to kill attacking army
-            if((static_cast<long long>(TimeUtil::getSystemTimeNano()) % 10000) < 7000) {
-                
-                reduceAttacker = true;
+            case ValidationStatus::NotEnoughArmies:
 
-            }
+                output << "[IssueOrder] This advance order is invalid: attempted to move "
+                       << numArmies << " armies, but source territory "
+                       << source -> getID() << " only has "
+                       << source -> getNumArmies() << " armies available.";
+                break;
 
+            case ValidationStatus::NotAdjacent:
 
-            //Attacker has 60% chance to kill defending army
-            if((static_cast<long long>(TimeUtil::getSystemTimeNano()) % 10000) < 6000){
+                output << "[IssueOrder] This advance order is invalid: target territory "
+                       << target -> getID() << " is not adjacent to source territory "
+                       << source -> getID() << ".";
+                break;
 
-                reduceDefense = true;
+            case ValidationStatus::TruceActive:
 
-            }
+                output << "[IssueOrder] This advance order is invalid: the issuer ("
+                       << issuer -> getPlayerName() << ") currently has a truce with "
+                       << (target -> getOwner() ? target -> getOwner() -> getPlayerName() : "an unknown player")
+                       << ", and cannot attack them.";
+                break;
 
-            //Prevents attackers from being reduced to 1 in the case of attacker winning
-            if(reduceAttacker  && attackersRemaining > 1){ attackersRemaining--; }
-            if(reduceDefense && defendersRemaining > 0){ defendersRemaining--; }
+            default: return "[IssueOrder] This advance order is invalid.";
 
         }
 
-        //--- 6. Resolve outcome ---
+        return output.str();
 
+    }
+
+
+    bool Advance::executeValidated() {
+
+        // --- 1. Move or battle ---
+        bool reinforcing = (target -> getOwner() == issuer);
         Player* oldOwner = target->getOwner(); //Get old conquered territory owner
         string oldOwnerName = (oldOwner ? oldOwner -> getPlayerName() : "Unknown Player");
 
-        if(defendersRemaining <= 0) {
+        AdvanceOutcome outcome = applyAdvance(issuer, source, target, numArmies, OrderStats::getCurrent());
 
-            if(attackersRemaining > 1) { // Successful conquest
+        // --- 2. Resolve outcome ---
+        switch(outcome.kind) {
 
-                //Transfer ownership
-                issuer -> addOwnedTerritories(target);
-                target -> setNumArmies(attackersRemaining);
+            case AdvanceOutcome::Kind::NotEnoughArmies:
 
-                issuer -> setGenerateCardThisTurn(true); //Attacker earns a card at turn end
+                this -> setEffect(reinforcing ? "Advance failed: Not enough armies to advance with." : "Advance failed: Not enough armies to attack with.");
+                return false;
+
+            case AdvanceOutcome::Kind::Moved:
+
+                this->setEffect("Advance successful: moved " + to_string(outcome.armies) +
+                                " armies from " + source -> getID() +
+                                " to " + target -> getID() + ".");
+                return true;
+
+            case AdvanceOutcome::Kind::Conquered:
 
                 this -> setEffect("Advance battle successful: " + issuer->getPlayerName() +
                                   " defeated " + oldOwnerName +
                                   ", and conquered " + target->getID() + " with " +
-                                  to_string(attackersRemaining) + " surviving armies.");
-
-            } else { //Edge case: attacker “wins” but can’t move in
+                                  to_string(outcome.armies) + " surviving armies.");
+                break;
 
-                defendersRemaining = 1;
-                target -> setNumArmies(defendersRemaining);
+            case AdvanceOutcome::Kind::Inconclusive:
 
                 this->setEffect("Advance battle inconclusive: " +
                                 issuer->getPlayerName() + " tried to beat " + oldOwnerName +
                                 ", but didn't have enough armies to move in. The defender clings onto " + target->getID() +
                                 " with 1 army, after a desperate defense.");
+                break;
 
-            }
-
-        } else { // Defender Wins
-
-            target -> setNumArmies(defendersRemaining);
+            case AdvanceOutcome::Kind::Repelled:
 
-            this->setEffect("Advance battle failed: defender " +
-                            oldOwnerName + " beat " + issuer -> getPlayerName() + ", and holds onto "
-                            + target -> getID() + " with " +
-                            to_string(defendersRemaining) + " armies remaining.");
+                this->setEffect("Advance battle failed: defender " +
+                                oldOwnerName + " beat " + issuer -> getPlayerName() + ", and holds onto "
+                                + target -> getID() + " with " +
+                                to_string(outcome.armies) + " armies remaining.");
+                break;
 
         }
 
         notify(this);
+        return outcome.kind == AdvanceOutcome::Kind::Conquered;
 
     }
 
@@ -714,90 +1207,66 @@ namespace WarzoneOrder {
 
     Order* Bomb::clone() const { return new Bomb(*this); }
 
-    pair<bool, string> Bomb::validate() const {
+    OrderRecord Bomb::toRecord() const { return { issuer, nullptr, -1, territoryIndexOf(target), 0, OrderType::Bomb }; }
 
-        ostringstream output; // Collect validation details
-
-        //Make sure player and territory target aren't nullpointers 
-        if(issuer == nullptr || target == nullptr) { 
-            
-            return { false, "[IssueOrder] This bomb order is invalid: one or more inputted pointers (issuer/target) is a null pointer." }; 
-        
-        }
+    ValidationStatus Bomb::check() const { return checkBomb(issuer, target); }
 
-        //Check if the target territory has an owner
-        Player* defender = target -> getOwner();
-        if(defender == nullptr) {
+    string Bomb::validationMessage(ValidationStatus status) const {
 
-            output << "[IssueOrder] This bomb order is invalid: target territory "
-                   << target -> getID() << " has no owner.";
+        ostringstream output;
 
-            return{ false, output.str() };
+        switch(status) {
 
-        }
+            case ValidationStatus::Valid: return "[IssueOrder] This bomb order is valid.";
 
-        //Check if the target territory belongs to the issuing player
-        if(defender == issuer) {
+            case ValidationStatus::NullPointer: return "[IssueOrder] This bomb order is invalid: one or more inputted pointers (issuer/target) is a null pointer.";
 
-            output << "[IssueOrder] This bomb order is invalid: the issuer ("
-                   << issuer -> getPlayerName() << ") cannot bomb their own territory ("
-                   << target -> getID() << ").";
-            return { false, output.str() };
+            case ValidationStatus::NoOwner:
 
-        }
+                output << "[IssueOrder] This bomb order is invalid: target territory "
+                       << target -> getID() << " has no owner.";
+                break;
 
-        //Check if the attacker has a truce with the defender
-        const vector<Player*>& neutrals = issuer -> getNeutralEnemies(); //List of players under truce
+            case ValidationStatus::OwnTerritory:
 
-        if(find(neutrals.begin(), neutrals.end(), defender) != neutrals.end()) { 
+                output << "[IssueOrder] This bomb order is invalid: the issuer ("
+                       << issuer -> getPlayerName() << ") cannot bomb their own territory ("
+                       << target -> getID() << ").";
+                break;
 
-            output << "[IssueOrder] This bomb order is invalid: the issuer ("
-                   << issuer -> getPlayerName() << ") currently has a truce with "
-                   << defender -> getPlayerName()
-                   << ", and cannot target their territories.";
-            return { false, output.str() }; 
+            case ValidationStatus::TruceActive:
 
-        }
+                output << "[IssueOrder] This bomb order is invalid: the issuer ("
+                       << issuer -> getPlayerName() << ") currently has a truce with "
+                       << (target -> getOwner() ? target -> getOwner() -> getPlayerName() : "an unknown player")
+                       << ", and cannot target their territories.";
+                break;
 
-        //Use the player's existing bomb candidate logic for validation
-        vector<Territory*> bombCandidates = issuer -> getBombCandidates();
+            case ValidationStatus::NotBombable:
 
-        //Target must exist in the list of valid bombable territories
-        bool isValidTarget = (find(bombCandidates.begin(), bombCandidates.end(), target) != bombCandidates.end());
-        if(!isValidTarget) {
+                output << "[IssueOrder] This bomb order is invalid: target territory "
+                       << target -> getID()
+                       << " is not a valid bombing target (not adjacent to owned territory).";
+                break;
 
-            output << "[IssueOrder] This bomb order is invalid: target territory "
-                   << target -> getID()
-                   << " is not a valid bombing target (not adjacent to owned territory).";
-            return { false, output.str() }; 
+            default: return "[IssueOrder] This bomb order is invalid.";
 
         }
 
-        return { true, "[IssueOrder] This bomb order is valid." };
+        return output.str();
 
     }
 
 
-    void Bomb::execute() {
-
-        pair<bool, string> validateResults = validate();
-        if(!validateResults.first) {
-
-            this -> setEffect(validateResults.second);
-            notify(this);
-            return;
-
-        }
+    bool Bomb::executeValidated() {
 
-        int currentArmies = target -> getNumArmies();
-        int armiesToRemove = currentArmies / 2; // Remove half, rounded down
-        
-        target -> setNumArmies(currentArmies - armiesToRemove);
+        int armiesToRemove = applyBomb(target);
 
         this->setEffect("Bomb order executed. Player " + target -> getOwner() -> getPlayerName() + ", at territory " 
                         + target -> getID() + ", lost " + to_string(armiesToRemove) + " armies.");
 
         notify(this);
+        return true;
         
     }
 
@@ -900,74 +1369,59 @@ namespace WarzoneOrder {
 
     Order* Blockade::clone() const { return new Blockade(*this); }
 
-    pair<bool, string> Blockade::validate() const {
-
-        ostringstream output; // Collect validation details
-
-        //Check if the target territory, the issuing player, or the neutral player are null pointers
-        if(issuer == nullptr || target == nullptr || neutralPlayer == nullptr) { 
-            
-            return { false, "[IssueOrder] This blockade order is invalid: one or more inputted pointers (issuer/target/neutral) is null." }; 
-        
-        }
-
-        //Target must belong to the issuing player
-        if(target -> getOwner() != issuer) { 
+    OrderRecord Blockade::toRecord() const { return { issuer, neutralPlayer, -1, territoryIndexOf(target), 0, OrderType::Blockade }; }
 
-            output << "[IssueOrder] This blockade order is invalid: target territory "
-                   << target -> getID() << " is not owned by the issuing player "
-                   << issuer -> getPlayerName() << ". It is currently owned by "
-                   << (target -> getOwner() ? target -> getOwner() -> getPlayerName() : "an unknown player")
-                   << ".";
+    ValidationStatus Blockade::check() const { return checkBlockade(issuer, target, neutralPlayer); }
 
-            return { false, output.str() }; 
+    string Blockade::validationMessage(ValidationStatus status) const {
 
-        }
+        ostringstream output;
 
-        //Player must own more than 1 territory. They would make themselves lose otherwise
-        size_t numTerritories = issuer -> getOwnedTerritories().getTerritories().size();
-        if(numTerritories <= 1) { 
+        switch(status) {
 
-            output << "[IssueOrder] This blockade order is invalid: the issuing player ("
-                   << issuer -> getPlayerName()
-                   << ") only owns " << numTerritories
-                   << " territory. Performing a blockade would result in having no owned territories left.";
+            case ValidationStatus::Valid: return "[IssueOrder] This blockade order is valid.";
 
-            return { false, output.str() }; 
+            case ValidationStatus::NullPointer: return "[IssueOrder] This blockade order is invalid: one or more inputted pointers (issuer/target/neutral) is null.";
 
-        }
+            case ValidationStatus::NotOwned:
 
-        //TODO: When adding player pattern, check if netral has neutral behaviour implemented
+                output << "[IssueOrder] This blockade order is invalid: target territory "
+                       << target -> getID() << " is not owned by the issuing player "
+                       << issuer -> getPlayerName() << ". It is currently owned by "
+                       << (target -> getOwner() ? target -> getOwner() -> getPlayerName() : "an unknown player")
+                       << ".";
+                break;
 
-        return { true, "[IssueOrder] This blockade order is valid." };
+            case ValidationStatus::LastTerritory:
 
-    }
+                output << "[IssueOrder] This blockade order is invalid: the issuing player ("
+                       << issuer -> getPlayerName()
+                       << ") only owns " << issuer -> getOwnedTerritories().getTerritories().size()
+                       << " territory. Performing a blockade would result in having no owned territories left.";
+                break;
 
+            default: return "[IssueOrder] This blockade order is invalid.";
 
-    void Blockade::execute() {
+        }
 
-        pair<bool, string> validateResults = validate();
-        if(!validateResults.first) {
+        return output.str();
 
-            this -> setEffect(validateResults.second);
-            notify(this);
-            return;
+    }
 
-        }
 
-        //Step 1: Triple the armies
-        target -> setNumArmies((target -> getNumArmies()) * 3);
+    bool Blockade::executeValidated() {
 
-        //Step 2: Transfer ownership to Neutral player
-        neutralPlayer -> addOwnedTerritories(target); //Add territory to neutral player
+        //Triple the armies, and transfer ownership to Neutral player
+        applyBlockade(target, neutralPlayer);
 
-        //Step 3: Update effect string
+        //Update effect string
         this -> setEffect("Blockade executed: " + target -> getID() + " now has " 
                           + std::to_string(target->getNumArmies()) +
                           " armies and belongs to Neutral player (" +
                           neutralPlayer->getPlayerName() + ").");
 
         notify(this);
+        return true;
     
     }
 
@@ -1078,95 +1532,62 @@ namespace WarzoneOrder {
 
     Order* Airlift::clone() const { return new Airlift(*this); }
 
-    pair<bool, string> Airlift::validate() const {
-
-        ostringstream output; // Collect validation details
-
-        //Make sure that the player, and the source / target territories, exist.
-
-        if(issuer == nullptr) {
-
-            return { false, "This airlift order is invalid, as the Issuer territory pointer is null\n" }; 
-
-        }
-
-        if(source == nullptr) {
-
-            return { false, "This airlift order is invalid, as the Source territory pointer is null\n" }; 
-
-        }
-
-        if(target == nullptr) {
+    OrderRecord Airlift::toRecord() const { return { issuer, nullptr, territoryIndexOf(source), territoryIndexOf(target), numArmies, OrderType::Airlift }; }
 
-            return { false, "This airlift order is invalid, as the Target territory pointer is null\n" }; 
-
-        }
+    ValidationStatus Airlift::check() const { return checkAirlift(issuer, source, target, numArmies); }
 
-        if(source == nullptr && target == nullptr) {
+    string Airlift::validationMessage(ValidationStatus status) const {
 
-            return { false, "This airlift order is invalid, as both the Source and Target territory pointers are null\n" }; 
+        ostringstream output;
 
-        }
+        switch(status) {
 
-        //Make sure the player owns both the source and the target territory
-        if(source -> getOwner() != issuer || target -> getOwner() != issuer) {
+            case ValidationStatus::Valid: return "[IssueOrder] This airlift order is valid.";
 
-            output << "[IssueOrder] This airlift order is invalid: both source and target territories must be owned by the issuing player "
-                   << issuer -> getPlayerName() << ". Source territory '"
-                   << source -> getID() << "' is owned by "
-                   << (source -> getOwner() ? source -> getOwner() -> getPlayerName() : "unknown")
-                   << ", and target territory '" << target -> getID() << "' is owned by "
-                   << (target -> getOwner() ? target -> getOwner() -> getPlayerName() : "unknown") << ".";
+            case ValidationStatus::NullPointer:
 
-            return { false, output.str() }; 
+                if(issuer == nullptr) { return "This airlift order is invalid, as the Issuer territory pointer is null\n"; }
+                if(source == nullptr) { return "This airlift order is invalid, as the Source territory pointer is null\n"; }
+                return "This airlift order is invalid, as the Target territory pointer is null\n";
 
-        }
+            case ValidationStatus::NotOwned:
 
-        // Check if enough armies to move (must leave at least 1 behind)
-        if(numArmies <= 0 || source -> getNumArmies() <= 1) {
+                output << "[IssueOrder] This airlift order is invalid: both source and target territories must be owned by the issuing player "
+                       << issuer -> getPlayerName() << ". Source territory '"
+                       << source -> getID() << "' is owned by "
+                       << (source -> getOwner() ? source -> getOwner() -> getPlayerName() : "unknown")
+                       << ", and target territory '" << target -> getID() << "' is owned by "
+                       << (target -> getOwner() ? target -> getOwner() -> getPlayerName() : "unknown") << ".";
+                break;
 
-            output << "[IssueOrder] This airlift order is invalid: source territory "
-                   << source -> getID() << " does not have enough armies to perform an airlift. "
-                   << "Current armies: " << source -> getNumArmies() 
-                   << ", armies requested: " << numArmies << ".";
+            case ValidationStatus::NotEnoughArmies:
 
-            return { false, output.str() }; 
-        
-        }
+                output << "[IssueOrder] This airlift order is invalid: source territory "
+                       << source -> getID() << " does not have enough armies to perform an airlift. "
+                       << "Current armies: " << source -> getNumArmies() 
+                       << ", armies requested: " << numArmies << ".";
+                break;
 
-        //Check if the number of armies proposed to be moved is small enough to be valid 
-        if(numArmies > source -> getNumArmies() - 1) { 
+            case ValidationStatus::TooManyArmies:
 
-            output << "[IssueOrder] This airlift order is invalid: attempted to move "
-                   << numArmies << " armies, but only "
-                   << (source -> getNumArmies() - 1)
-                   << " can be moved (must leave at least 1 behind).";
+                output << "[IssueOrder] This airlift order is invalid: attempted to move "
+                       << numArmies << " armies, but only "
+                       << (source -> getNumArmies() - 1)
+                       << " can be moved (must leave at least 1 behind).";
+                break;
 
-            return { false, output.str() }; 
+            default: return "[IssueOrder] This airlift order is invalid.";
 
         }
 
-        return { true, "[IssueOrder] This airlift order is valid." };
+        return output.str();
 
     }
 
-    void Airlift::execute() {
-
-        pair<bool, string> validateResults = validate();
-        if(!validateResults.first) {
-
-            this -> setEffect(validateResults.second);
-            notify(this);
-            return;
-
-        }
+    bool Airlift::executeValidated() {
 
         // --- Perform the move ---
-        int armiesToMove = min(numArmies, source -> getNumArmies() - 1);
-
-
-        source -> setNumArmies(source -> getNumArmies() - armiesToMove);
-        target -> setNumArmies(target -> getNumArmies() + armiesToMove);
+        int armiesToMove = applyAirlift(source, target, numArmies);
 
         // --- Update effect ---
         this -> setEffect("Airlift successful: " + issuer -> getPlayerName() + 
@@ -1175,6 +1596,7 @@ namespace WarzoneOrder {
                           " to " + target -> getID() + ".");
 
         notify(this);
+        return armiesToMove > 0;
         
     }
 
@@ -1263,61 +1685,47 @@ namespace WarzoneOrder {
 
     Order* Negotiate::clone() const { return new Negotiate(*this); }
 
-    pair<bool, string> Negotiate::validate() const {
-
-        ostringstream output; // Collect validation details
+    OrderRecord Negotiate::toRecord() const { return { issuer, targetPlayer, -1, -1, 0, OrderType::Negotiate }; }
 
-        //Make sure both the source and target players exist
-        if(issuer == nullptr || targetPlayer == nullptr) { 
-            
-            return { false, "[IssueOrder] This negotiate order is invalid: one of the inputted pointers (issuer/targetPlayer) is null." }; 
-        
-        }
+    ValidationStatus Negotiate::check() const { return checkNegotiate(issuer, targetPlayer); }
 
-        //Player can't negotiate with themselves
-        if(issuer == targetPlayer) { 
-            
-            output << "[IssueOrder] This negotiate order is invalid: the issuer ("
-                   << issuer -> getPlayerName()
-                   << ") cannot negotiate with themselves.";
+    string Negotiate::validationMessage(ValidationStatus status) const {
 
-            return { false, output.str() }; 
-        
-        }
+        ostringstream output;
 
-        //Check if a truce has already been declared between the issuer and target
-        const vector<Player*>& neutrals = issuer -> getNeutralEnemies(); //List of players the issuer has a truce with
+        switch(status) {
 
-        if(find(neutrals.begin(), neutrals.end(), targetPlayer) != neutrals.end()) { 
-            
-            output << "[IssueOrder] This negotiate order is invalid: a truce already exists between "
-                   << issuer -> getPlayerName()
-                   << " and " << targetPlayer -> getPlayerName()
-                   << ".";
+            case ValidationStatus::Valid: return "[IssueOrder] This negotiate order is valid.";
 
-            return { false, output.str() }; 
-            
-        }
+            case ValidationStatus::NullPointer: return "[IssueOrder] This negotiate order is invalid: one of the inputted pointers (issuer/targetPlayer) is null.";
 
-        return { true, "[IssueOrder] This negotiate order is valid." };
+            case ValidationStatus::SelfTarget:
 
-    }
+                output << "[IssueOrder] This negotiate order is invalid: the issuer ("
+                       << issuer -> getPlayerName()
+                       << ") cannot negotiate with themselves.";
+                break;
 
-    void Negotiate::execute() {
+            case ValidationStatus::TruceActive:
 
-        // Validate order
-        pair<bool, string> validateResults = validate();
-        if(!validateResults.first) {
+                output << "[IssueOrder] This negotiate order is invalid: a truce already exists between "
+                       << issuer -> getPlayerName()
+                       << " and " << targetPlayer -> getPlayerName()
+                       << ".";
+                break;
 
-            this -> setEffect(validateResults.second);
-            notify(this);
-            return;
+            default: return "[IssueOrder] This negotiate order is invalid.";
 
         }
 
+        return output.str();
+
+    }
+
+    bool Negotiate::executeValidated() {
+
         //Apply neutrality
-        issuer -> addNeutralEnemy(targetPlayer);
-        targetPlayer -> addNeutralEnemy(issuer);
+        applyNegotiate(issuer, targetPlayer);
 
         //Update effect
         this -> setEffect("Negotiate successful: " + issuer -> getPlayerName() +
@@ -1325,33 +1733,125 @@ namespace WarzoneOrder {
                         " cannot attack each other this turn.");
 
         notify(this);
+        return true;
+
+    }
+
+
+    /*------------------------------------------ORDER RECORD FUNCTIONS--------------------------------------------------*/
+
+    ValidationStatus validateRecord(const OrderRecord& record, const vector<Territory*>& territories) {
+
+        Territory* source = resolveTerritory(record.source, territories);
+        Territory* target = resolveTerritory(record.target, territories);
+
+        switch(record.type) {
+
+            case OrderType::Deploy: return checkDeploy(record.issuer, target, record.numArmies);
+            case OrderType::Advance: return checkAdvance(record.issuer, source, target, record.numArmies);
+            case OrderType::Bomb: return checkBomb(record.issuer, target);
+            case OrderType::Blockade: return checkBlockade(record.issuer, target, record.targetPlayer);
+            case OrderType::Airlift: return checkAirlift(record.issuer, source, target, record.numArmies);
+            case OrderType::Negotiate: return checkNegotiate(record.issuer, record.targetPlayer);
+
+        }
+
+        return ValidationStatus::NullPointer;
+
+    }
+
+    bool executeRecord(const OrderRecord& record, const vector<Territory*>& territories, OrderStats* stats) {
+
+        long long started = stats != nullptr ? stats -> start() : 0;
+
+        if(validateRecord(record, territories) != ValidationStatus::Valid) {
+
+            if(stats != nullptr) { stats -> record(record.type, ExecutionResult::Invalid, started); }
+            return false;
+
+        }
+
+        Territory* source = resolveTerritory(record.source, territories);
+        Territory* target = resolveTerritory(record.target, territories);
+        bool succeeded = true;
+
+        switch(record.type) {
+
+            case OrderType::Deploy: applyDeploy(record.issuer, target, record.numArmies); break;
+            case OrderType::Bomb: applyBomb(target); break;
+            case OrderType::Blockade: applyBlockade(target, record.targetPlayer); break;
+            case OrderType::Airlift: succeeded = applyAirlift(source, target, record.numArmies) > 0; break;
+            case OrderType::Negotiate: applyNegotiate(record.issuer, record.targetPlayer); break;
+
+            case OrderType::Advance: {
+                AdvanceOutcome::Kind kind = applyAdvance(record.issuer, source, target, record.numArmies, stats).kind;
+                succeeded = kind == AdvanceOutcome::Kind::Moved || kind == AdvanceOutcome::Kind::Conquered;
+                break;
+            }
+
+        }
+
+        if(stats != nullptr) { stats -> record(record.type, succeeded ? ExecutionResult::Success : ExecutionResult::Failure, started); }
+        return true;
 
     }
 
+    Order* makeOrder(const OrderRecord& record, const vector<Territory*>& territories) {
+
+        Territory* source = resolveTerritory(record.source, territories);
+        Territory* target = resolveTerritory(record.target, territories);
+
+        switch(record.type) {
+
+            case OrderType::Deploy: return new Deploy(record.issuer, target, record.numArmies);
+            case OrderType::Advance: return new Advance(record.issuer, source, target, record.numArmies);
+            case OrderType::Bomb: return new Bomb(record.issuer, target);
+            case OrderType::Blockade: return new Blockade(record.issuer, target, record.targetPlayer);
+            case OrderType::Airlift: return new Airlift(record.issuer, source, target, record.numArmies);
+            case OrderType::Negotiate: return new Negotiate(record.issuer, record.targetPlayer);
+
+        }
+
+        return nullptr;
+
+    }
 
     // ================= OrderList ================= //
 
+    //Consumed prefix size below which popFront() never compacts
+    static const size_t ORDERLIST_MIN_COMPACT = 32;
+
     //-- Constructors, Destructor, Copy Constructor, Assignment Operator, Stream Insertion Operator --//
 
     OrderList::OrderList() {
 
         this -> orders = vector<Order*>(); //Initialize empty container
+        this -> head = 0;
+        this -> batchDepth = 0;
+        this -> batchDirty = false;
+        this -> recordsCompiled = false;
 
     }
 
     OrderList::~OrderList() {
 
-        for(Order* o : orders) { delete o; } //Delete all orders in the list
+        for(size_t i = head; i < orders.size(); i++) { delete orders[i]; } //Delete all orders in the list
 
     }
 
     OrderList::OrderList(const OrderList& other) {
 
         this -> orders = vector<Order*>();
+        this -> head = 0;
+        this -> batchDepth = 0;
+        this -> batchDirty = false;
+        this -> recordsCompiled = false;
 
-        for(Order* o : other.orders) { //Deep copy using clone()
+        orders.reserve(other.size());
 
-            orders.push_back(o -> clone());
+        for(size_t i = other.head; i < other.orders.size(); i++) { //Deep copy using clone()
+
+            orders.push_back(other.orders[i] != nullptr ? other.orders[i] -> clone() : nullptr); //Elided slots stay elided
 
         }
 
@@ -1361,15 +1861,17 @@ namespace WarzoneOrder {
 
         if(this != &other) {
 
-            for(Order* o : this -> orders) { delete o; } //Delete existing orders in the list
-            orders.clear();
+            for(size_t i = head; i < orders.size(); i++) { delete orders[i]; } //Delete existing orders in the list
 
             //Rebuild container with deep copy
             this -> orders = vector<Order*>();
+            this -> head = 0;
+            invalidateRecords();
+            orders.reserve(other.size());
 
-            for(Order* o : other.orders) {
+            for(size_t i = other.head; i < other.orders.size(); i++) {
 
-                orders.push_back(o -> clone());
+                orders.push_back(other.orders[i] != nullptr ? other.orders[i] -> clone() : nullptr); //Elided slots stay elided
 
             }
 
@@ -1383,9 +1885,11 @@ namespace WarzoneOrder {
 
         os << "OrderList:" << std::endl;
 
-        for (size_t i = 0; i < ol.orders.size(); i++) {//Iterate over all orders
+        for (size_t i = ol.head; i < ol.orders.size(); i++) {//Iterate over all orders
 
-            os << "  [" << i << "] " << *ol.orders[i] << std::endl;
+            os << "  [" << i - ol.head << "] ";
+            if(ol.orders[i] != nullptr) { os << *ol.orders[i]; } else { os << "(elided)"; }
+            os << std::endl;
 
         }
 
@@ -1394,19 +1898,27 @@ namespace WarzoneOrder {
 
     //-- Accessors and Mutators --//
 
-    vector<Order*>& OrderList::getOrders() { return orders; }
+    vector<Order*>& OrderList::getOrders() { 
+        
+        compact();
+        invalidateRecords(); //Caller may edit the vector
+        return orders; 
+    
+    }
     
     void OrderList::setOrders(const vector<Order*> newOrders) { 
     
         // Clean up existing orders
-        for(Order* o : orders) { delete o; }
+        for(size_t i = head; i < orders.size(); i++) { delete orders[i]; }
 
         // Allocate a new vector and clone each order
         this -> orders = vector<Order*>();
+        this -> head = 0;
+        invalidateRecords();
 
         for(Order* o : newOrders) {
 
-            orders.push_back(o -> clone()); 
+            orders.push_back(o != nullptr ? o -> clone() : nullptr); 
 
         }
 
@@ -1415,24 +1927,111 @@ namespace WarzoneOrder {
 
     //-- Class Methods --//
 
+    void OrderList::notifyChange() {
+
+        if(batchDepth > 0) { batchDirty = true; } 
+        else { notify(this); }
+
+    }
+
+    void OrderList::compact() {
+
+        if(head == 0) { return; }
+
+        orders.erase(orders.begin(), orders.begin() + head);
+        if(recordsCompiled) { records.erase(records.begin(), records.begin() + head); }
+        head = 0;
+
+    }
+
+    void OrderList::invalidateRecords() {
+
+        records.clear();
+        recordsCompiled = false;
+
+    }
+
+    void OrderList::compileRecords() {
+
+        records.resize(orders.size());
+
+        for(size_t i = head; i < orders.size(); i++) { records[i] = orders[i] != nullptr ? orders[i] -> toRecord() : OrderRecord{ nullptr, nullptr, -1, -1, 0, OrderType::Deploy }; }
+
+        recordsCompiled = true;
+
+    }
+
+    const OrderRecord* OrderList::peekRecord() const {
+
+        if(!recordsCompiled || head >= orders.size()) { return nullptr; }
+        return &records[head];
+
+    }
+
+    void OrderList::beginBatch() { batchDepth++; }
+
+    void OrderList::endBatch() {
+
+        if(batchDepth <= 0) { return; } //Unbalanced call
+
+        batchDepth--;
+
+        if(batchDepth == 0 && batchDirty) {
+
+            batchDirty = false;
+            notify(this);
+
+        }
+
+    }
+
     void OrderList::addOrder(Order* o) {
 
         if(o != nullptr) { 
             
             orders.push_back(o); 
-            notify(this);
+            invalidateRecords();
+            notifyChange();
 
         }
     
     }
 
+    void OrderList::popFront() {
+
+        if(head >= orders.size()) { return; } //Empty list
+
+        delete orders[head]; //Free memory of the removed order
+        orders[head] = nullptr;
+        head++;
+
+        //Reuse the buffer once fully drained, drop the consumed prefix once it dominates
+        if(head == orders.size()) {
+
+            orders.clear();
+            records.clear();
+            head = 0;
+
+        } else if(head >= ORDERLIST_MIN_COMPACT && head * 2 >= orders.size()) {
+
+            compact();
+
+        }
+
+        notifyChange();
+
+    }
+
     void OrderList::removeOrder(int index) {
 
-        if(index >= 0 && index < static_cast<int>(orders.size())) { //Check if the inputed index is valid
+        if(index == 0) { popFront(); return; }
 
-            delete orders[index]; //Free memory of the removed order
-            orders.erase(orders.begin() + index);  //Shift all elements in the OrderList to the left by 1 index
-            notify(this);
+        if(index > 0 && index < static_cast<int>(size())) { //Check if the inputed index is valid
+
+            delete orders[head + index]; //Free memory of the removed order
+            orders.erase(orders.begin() + head + index);  //Shift all later elements in the OrderList to the left by 1 index
+            invalidateRecords();
+            notifyChange();
 
         }
 
@@ -1442,12 +2041,16 @@ namespace WarzoneOrder {
 
         if(orderPtr == nullptr){ return; }
 
-        for(size_t i = 0; i < orders.size(); i++){
+        for(size_t i = head; i < orders.size(); i++){
 
             if(orders[i] == orderPtr) {
+
+                if(i == head) { popFront(); return; }
+
                 delete orders[i];                      // free memory
                 orders.erase(orders.begin() + i);      // erase slot
-                notify(this);
+                invalidateRecords();
+                notifyChange();
                 return;
             
             }
@@ -1456,20 +2059,34 @@ namespace WarzoneOrder {
     
     }
 
+    void OrderList::elideOrder(int index) {
+
+        if(index < 0 || index >= static_cast<int>(size())) { return; }
+
+        delete orders[head + index]; //Free memory, but keep the slot
+        orders[head + index] = nullptr;
+        invalidateRecords();
+        notifyChange();
+
+    }
+
     void OrderList::moveOrder(int oldPos, int newPos){
 
         //Check if the positions are valid
         bool geqZeroOldPos = oldPos >= 0;
-        bool leqListSizeOldPos = oldPos < static_cast<int>(orders.size());
+        bool leqListSizeOldPos = oldPos < static_cast<int>(size());
         bool geqZeroNewPos = newPos >= 0;
-        bool leqListSizeNewPos = newPos < static_cast<int>(orders.size());
+        bool leqListSizeNewPos = newPos < static_cast<int>(size());
 
         if(geqZeroOldPos && leqListSizeOldPos && geqZeroNewPos && leqListSizeNewPos) { //Perform check
 
+            compact(); //Positions are relative to the live orders
+
             Order* tempOrder = orders[oldPos]; //Take out the order
             orders.erase(orders.begin() + oldPos); //Remove from old position
             orders.insert(orders.begin() + newPos, tempOrder); //Insert at new position
-            notify(this);
+            invalidateRecords();
+            notifyChange();
 
         }
 
@@ -1477,33 +2094,30 @@ namespace WarzoneOrder {
 
     Order* OrderList::peek() const {
         
-        if(!orders.empty()){ return orders.front(); }
+        if(head < orders.size()){ return orders[head]; }
         return nullptr;
         
     }
 
     Order* OrderList::back() const {
         
-        if(!orders.empty()) { return orders.back(); }
+        if(head < orders.size()) { return orders.back(); }
         return nullptr; 
         
     }
 
     void OrderList::replaceOrder(int index, Order* newOrder) {
         
-        notify(this);
+        notifyChange();
 
         //Verify both newOrder pointer is valid
         if(newOrder == nullptr){ return; }
 
-        //Check if the list is empty
-        if(orders.empty()){ return; }
-
-        //Check if index is valid
-        if(index < 0 || index >= static_cast<int>(orders.size())) { return; }
+        //Check if index is valid (also covers the empty list)
+        if(index < 0 || index >= static_cast<int>(size())) { return; }
 
         //Delete the old order safely
-        Order* oldOrder = orders[index];
+        Order* oldOrder = orders[head + index];
         if(oldOrder != nullptr) {
 
             delete oldOrder;
@@ -1511,23 +2125,21 @@ namespace WarzoneOrder {
         
         }
 
-        //Replace in place (ordinality preserved)
-        orders[index] = newOrder;
+        //Replace in place (ordinality preserved, no iterators or indices are invalidated)
+        orders[head + index] = newOrder;
+        invalidateRecords();
 
     }
 
     void OrderList::replaceOrder(Order* oldOrder, Order* newOrder) {
         
-        notify(this);
+        notifyChange();
 
         //Verify both Order pointers are valid
         if(oldOrder == nullptr || newOrder == nullptr){ return; }
 
-        //Check if the list is empty
-        if(orders.empty()){ return; }
-
-        //Find position of old order
-        auto it = std::find(orders.begin(), orders.end(), oldOrder);
+        //Find position of old order among the live orders
+        auto it = std::find(orders.begin() + head, orders.end(), oldOrder);
         
         //If not found, return
         if(it == orders.end()){ return; }
@@ -1535,15 +2147,16 @@ namespace WarzoneOrder {
         // --- Delete the old order safely ---
         delete *it;
 
-        // --- Replace in place (ordinality preserved) ---
+        // --- Replace in place (ordinality preserved, no iterators or indices are invalidated) ---
         *it = newOrder;
+        invalidateRecords();
     
     }
 
-    size_t OrderList::size() const { return orders.size(); }
+    size_t OrderList::size() const { return orders.size() - head; }
 
     std::string OrderList::stringToLog(){
-        return "[OrderList] State updated. Total orders: " + std::to_string(orders.size());
+        return "[OrderList] State updated. Total orders: " + std::to_string(size());
     }
 
-}
\ No newline at end of file
+}
@@ -4,7 +4,10 @@
 #include <string>
 #include <iostream>
 #include <chrono>
+#include <cstdint>
 #include <utility>
+#include <array>
+#include <atomic>
 
 #include "../Player/Player.h"
 #include "../LoggingObserver/LoggingObserver.h"
@@ -57,6 +60,84 @@ namespace WarzoneOrder {
             static long long getSystemTimeNano();
     };
 
+    /*------------------------------------------BATTLE DICE--------------------------------------------------*/
+
+    /**
+     * @class BattleDice
+     * @brief Source of the battle rolls of Advance orders.
+     *
+     * Unseeded (seed 0), rolls come from TimeUtil like every other random event. With a seed, each battle draws from
+     * its own stream derived from the seed and the battle (source, target, attacking and defending armies), so a battle
+     * rolls the same no matter which thread runs it or what ran before it. The seed is per thread.
+     */
+    class BattleDice {
+
+        public:
+
+            /**
+             * @brief Sets the seed used by battles on the calling thread
+             * @param seed Battle seed, 0 for clock-based rolls
+             */
+            static void setSeed(unsigned long long seed);
+
+            /**
+             * @brief Seed used by battles on the calling thread
+             * @return Battle seed, 0 if rolls are clock-based
+             */
+            static unsigned long long getSeed();
+
+    };
+
+    /*------------------------------------------ORDER POOL--------------------------------------------------*/
+
+    //Orders bigger than this are not pooled
+    const size_t ORDER_POOL_MAX_BLOCK = 512;
+
+    //Size of the chunks the pool carves blocks from
+    const size_t ORDER_POOL_CHUNK_BYTES = 64 * 1024;
+
+    /**
+     * @class OrderPool
+     * @brief Recycles the memory of deleted orders.
+     *
+     * Every Order is allocated through Order::operator new, which takes a block from a per-size free list,
+     * and returned to it by Order::operator delete. Blocks are carved from 64KB chunks, so a long simulation
+     * only touches the heap while the number of live orders grows past its previous peak.
+     *
+     * Safe to use from several threads (the parallel issue orders phase allocates concurrently).
+     */
+    class OrderPool {
+
+        public:
+
+            /**
+             * @brief Takes a block of at least size bytes
+             * @param size Requested size in bytes
+             * @return Pointer to the block
+             */
+            static void* allocate(size_t size);
+
+            /**
+             * @brief Returns a block obtained from allocate()
+             * @param ptr Block to return
+             * @param size Size that was passed to allocate()
+             */
+            static void deallocate(void* ptr, size_t size);
+
+            /**
+             * @brief Number of blocks currently handed out
+             * @return Live block count
+             */
+            static size_t getLiveBlocks();
+
+            /**
+             * @brief Number of bytes the pool obtained from the heap so far
+             * @return Reserved bytes
+             */
+            static size_t getReservedBytes();
+
+    };
+
     /**
      * @brief List of enums that helps to differentiate order types.
      * 
@@ -68,12 +149,259 @@ namespace WarzoneOrder {
      * - Airlift: Move armies between any two territories owned by the player, regardless of adjacency (requires Airlift card).
      * - Negotiate: Prevent attacks between two players for the remainder of the turn (requires Diplomacy card).
      */
-    enum class OrderType {
+    enum class OrderType : uint8_t {
 
         Deploy, Advance, Bomb, Blockade, Airlift, Negotiate 
     
     };
 
+    /**
+     * @brief Result of validating an order, the message text is only built on demand (Order::validationMessage()).
+     */
+    enum class ValidationStatus : uint8_t {
+
+        Valid,
+        NullPointer,        //A required issuer, territory or player pointer is null
+        NotOwned,           //The issuer does not own a territory it has to own
+        NotEnoughArmies,    //Army count is not positive, or the source cannot provide it
+        TooManyArmies,      //Airlift: more armies than the source can spare
+        NotAdjacent,        //Advance: target is not a neighbour of the source
+        TruceActive,        //Issuer has a truce with the defender / target player
+        NoOwner,            //Bomb: target has no owner
+        OwnTerritory,       //Bomb: target belongs to the issuer
+        NotBombable,        //Bomb: target has at most 1 army, or is not adjacent to an owned territory
+        LastTerritory,      //Blockade: issuer would give away its last territory
+        SelfTarget          //Negotiate: issuer targets themselves
+
+    };
+
+    /*------------------------------------------ORDER RECORD--------------------------------------------------*/
+    /**
+     * @struct OrderRecord
+     * @brief Compact value form of an order (32 bytes), used to execute orders without the Order class overhead.
+     *
+     * Territories are referenced by Territory::getIndex(), and resolved against the map's territory list
+     * at execution time. Unused fields are -1 / nullptr.
+     */
+    struct OrderRecord {
+
+        Player* issuer;         //Issuing player
+        Player* targetPlayer;   //Blockade: neutral player, Negotiate: target player
+        int32_t source;         //Advance, Airlift: source territory index
+        int32_t target;         //Deploy, Advance, Bomb, Blockade, Airlift: target territory index
+        int32_t numArmies;      //Deploy, Advance, Airlift: armies to move
+        OrderType type;
+
+    };
+
+    static_assert(sizeof(OrderRecord) <= 32, "OrderRecord should stay within 32 bytes");
+
+    /*------------------------------------------ORDER STATS--------------------------------------------------*/
+
+    //Number of OrderType values
+    const size_t ORDER_TYPE_COUNT = 6;
+
+    //Latency buckets: 16 exact ones, then 8 per power of two up to 2^63 ns
+    const size_t ORDER_STATS_LATENCY_BUCKETS = 496;
+
+    //Battle size buckets: 0, then one per power of two
+    const size_t ORDER_STATS_BATTLE_BUCKETS = 32;
+
+    /**
+     * @brief Outcome of one executed order, as counted by OrderStats.
+     * Failure means the order was valid but did not get its way (e.g. a repelled attack, an Airlift that moved nothing).
+     */
+    enum class ExecutionResult : uint8_t { Success, Failure, Invalid };
+
+    /**
+     * @struct LatencyHistogram
+     * @brief Log-linear (HDR-style) histogram of nanosecond latencies, about 12% resolution at every scale.
+     */
+    struct LatencyHistogram {
+
+        array<uint64_t, ORDER_STATS_LATENCY_BUCKETS> counts{};
+
+        /**
+         * @brief Number of recorded samples
+         * @return Sum of all buckets
+         */
+        uint64_t total() const;
+
+        /**
+         * @brief Approximate percentile
+         * @param q Quantile in [0, 1]
+         * @return Lower bound (ns) of the bucket holding the q-th sample, 0 if empty
+         */
+        long long percentile(double q) const;
+
+        /**
+         * @brief Bucket a latency falls into
+         * @param nanos Latency in nanoseconds
+         * @return Bucket index
+         */
+        static size_t bucketOf(long long nanos);
+
+        /**
+         * @brief Smallest latency of a bucket
+         * @param bucket Bucket index
+         * @return Lower bound in nanoseconds
+         */
+        static long long bucketLowerBound(size_t bucket);
+
+    };
+
+    /**
+     * @struct OrderTypeStats
+     * @brief Counters of one OrderType
+     */
+    struct OrderTypeStats {
+
+        uint64_t succeeded = 0;
+        uint64_t failed = 0;
+        uint64_t invalid = 0;
+        LatencyHistogram latency; //Validation + execution time of every order, invalid ones included
+
+        uint64_t executed() const { return succeeded + failed + invalid; }
+
+    };
+
+    /**
+     * @struct OrderStatsSnapshot
+     * @brief Copy of the OrderStats counters at one point in time, indexed by OrderType
+     */
+    struct OrderStatsSnapshot {
+
+        array<OrderTypeStats, ORDER_TYPE_COUNT> types;
+        array<uint64_t, ORDER_STATS_BATTLE_BUCKETS> battleAttackers{}; //Attacking armies per Advance battle (power of two buckets)
+        array<uint64_t, ORDER_STATS_BATTLE_BUCKETS> battleDefenders{}; //Defending armies per Advance battle
+        uint64_t battles = 0;
+
+    };
+
+    /**
+     * @brief Prints per-type counts and latency percentiles, then the battle size distribution
+     * @param os Output stream
+     * @param stats Snapshot to print
+     * @return Output stream
+     */
+    ostream& operator<<(ostream& os, const OrderStatsSnapshot& stats);
+
+    /**
+     * @class OrderStats
+     * @brief Instrumentation of order execution: per-OrderType result counts, latency histograms and Advance battle sizes.
+     *
+     * Each GameEngine owns one, disabled by default. Counters are relaxed atomics, so orders executing on several threads
+     * can record without locks. executeRecord() and the engine's execute orders phase record into the sink they are given;
+     * Order::execute() and Advance battles, which have no such parameter, record into the calling thread's current sink,
+     * installed with a Scope (the engine installs its own around its execute orders phase).
+     */
+    class OrderStats {
+
+        private:
+
+            static thread_local OrderStats* current; //Sink of the calling thread, nullptr if none
+
+            atomic<bool> enabled{false};
+            atomic<uint64_t> results[ORDER_TYPE_COUNT][3] = {};
+            atomic<uint64_t> latency[ORDER_TYPE_COUNT][ORDER_STATS_LATENCY_BUCKETS] = {};
+            atomic<uint64_t> battleAttackers[ORDER_STATS_BATTLE_BUCKETS] = {};
+            atomic<uint64_t> battleDefenders[ORDER_STATS_BATTLE_BUCKETS] = {};
+            atomic<uint64_t> battles{0};
+
+        public:
+
+            /**
+             * @class Scope
+             * @brief Makes a sink the calling thread's current one until the scope ends, then restores the previous one
+             */
+            class Scope {
+
+                private:
+
+                    OrderStats* previous;
+
+                public:
+
+                    /**
+                     * @param stats Sink to record in, nullptr to record nothing for the scope
+                     */
+                    explicit Scope(OrderStats* stats) : previous(current) { current = stats; }
+
+                    ~Scope() { current = previous; }
+
+                    Scope(const Scope&) = delete;
+                    Scope& operator=(const Scope&) = delete;
+
+            };
+
+            /**
+             * @brief Default constructor, recording is off and every counter is 0
+             */
+            OrderStats() = default;
+
+            OrderStats(const OrderStats&) = delete;
+            OrderStats& operator=(const OrderStats&) = delete;
+
+            /**
+             * @brief Sink that Order::execute() and Advance battles record into on the calling thread
+             * @return Current sink, or nullptr
+             */
+            static OrderStats* getCurrent() { return current; }
+
+            /**
+             * @brief Turns recording on or off (counters are kept)
+             * @param enabled true to record
+             */
+            void setEnabled(bool enabled);
+
+            /**
+             * @brief Whether recording is on
+             * @return true if orders are being recorded
+             */
+            bool isEnabled() const;
+
+            /**
+             * @brief Starts timing an order
+             * @return Current steady clock time in nanoseconds, or 0 when recording is off
+             */
+            long long start() const;
+
+            /**
+             * @brief Records one executed order
+             * @param type Type of the order
+             * @param result How the order ended
+             * @param started Value returned by start() (nothing is recorded if 0)
+             */
+            void record(OrderType type, ExecutionResult result, long long started);
+
+            /**
+             * @brief Records one executed order whose latency was measured by the caller (e.g. a share of a batch)
+             * @param type Type of the order
+             * @param result How the order ended
+             * @param elapsed Latency in nanoseconds
+             */
+            void recordElapsed(OrderType type, ExecutionResult result, long long elapsed);
+
+            /**
+             * @brief Records the armies on both sides of an Advance battle
+             * @param attackers Attacking armies
+             * @param defenders Defending armies
+             */
+            void recordBattle(int attackers, int defenders);
+
+            /**
+             * @brief Copies all counters
+             * @return Snapshot of the counters
+             */
+            OrderStatsSnapshot snapshot() const;
+
+            /**
+             * @brief Sets every counter back to 0
+             */
+            void reset();
+
+    };
+
     /*------------------------------------------ORDER SUPER-CLASS------------------------------------------------*/
     /**
      * @class Order
@@ -168,6 +496,20 @@ namespace WarzoneOrder {
          */
         friend ostream& operator<<(ostream& os, const Order& order);
 
+        /**
+         * @brief Allocates orders from the OrderPool instead of the global heap.
+         * @param size Size of the dynamic order type
+         * @return Pointer to uninitialized memory for the order
+         */
+        static void* operator new(size_t size);
+
+        /**
+         * @brief Returns an order's memory to the OrderPool.
+         * @param ptr Memory of the destroyed order
+         * @param size Size of the dynamic order type
+         */
+        static void operator delete(void* ptr, size_t size);
+
         //-- Accessors and Mutators --//
 
         /**
@@ -219,35 +561,72 @@ namespace WarzoneOrder {
         virtual Order* clone() const = 0;
 
         /**
-         * @brief Validate method (pure virtual).
+         * @brief Check method (pure virtual).
          * 
          * Determines whether the Order is valid according to the game rules.
-         * Must be implemented in each subclass.
-         * @return True if the Order is valid, false otherwise.
+         * Must be implemented in each subclass, and must not allocate.
+         * @return ValidationStatus::Valid, or the first rule the order breaks.
          * 
-         * @see Deploy::validate()
-         * @see Advance::validate()
-         * @see Bomb::validate()
-         * @see Blockade::validate()
-         * @see Airlift::validate()
-         * @see Negotiate::validate()
+         * @see Deploy::check()
+         * @see Advance::check()
+         * @see Bomb::check()
+         * @see Blockade::check()
+         * @see Airlift::check()
+         * @see Negotiate::check()
          */
-        virtual pair<bool, string> validate() const = 0;
+        virtual ValidationStatus check() const = 0;
 
         /**
-         * @brief Execute method (pure virtual).
+         * @brief Validation message method (pure virtual).
          * 
-         * Executes the Order’s action if it is valid, updating the game state.
-         * Must be implemented in each subclass.
+         * Builds the text describing a validation result, only called when a message is wanted.
+         * @param status Result of check()
+         * @return Human-readable message
+         */
+        virtual string validationMessage(ValidationStatus status) const = 0;
+
+        /**
+         * @brief Validate the order.
          * 
-         * @see Deploy::execute()
-         * @see Advance::execute()
-         * @see Bomb::execute()
-         * @see Blockade::execute()
-         * @see Airlift::execute()
-         * @see Negotiate::execute()
+         * Equivalent to check() followed by validationMessage(), kept for code that wants the message.
+         * @return True if the Order is valid, and the validation message.
          */
-        virtual void execute() = 0;
+        pair<bool, string> validate() const;
+
+        /**
+         * @brief Execute the order.
+         * 
+         * Checks the Order once: if invalid, the effect is set to the validation message,
+         * otherwise executeValidated() updates the game state.
+         */
+        void execute();
+
+        /**
+         * @brief Execute method for an order already known to be valid (pure virtual).
+         * 
+         * Updates the game state without checking the rules again. Only call it right after check()
+         * returned ValidationStatus::Valid, with no game state change in between.
+         * 
+         * @return False if the order did not get its way (see ExecutionResult::Failure)
+         * 
+         * @see Deploy::executeValidated()
+         * @see Advance::executeValidated()
+         * @see Bomb::executeValidated()
+         * @see Blockade::executeValidated()
+         * @see Airlift::executeValidated()
+         * @see Negotiate::executeValidated()
+         */
+        virtual bool executeValidated() = 0;
+
+        /**
+         * @brief Compact value form of this order (pure virtual).
+         * 
+         * Territories without a map index (Territory::getIndex() == -1) are stored as -1.
+         * @return The OrderRecord describing this order.
+         * 
+         * @see executeRecord()
+         */
+        virtual OrderRecord toRecord() const = 0;
 
         /**
          * @brief Returns the string to be written to the log file.
@@ -362,16 +741,28 @@ namespace WarzoneOrder {
             Order* clone() const override;
 
             /**
-             * @brief Validate the order.
-             * @return True if the order is valid, string for method output as string
+             * @brief Check the order against the game rules, without building any message.
+             * @return ValidationStatus::Valid, or the first rule the order breaks
+             */
+            ValidationStatus check() const override;
+
+            /**
+             * @brief Describe a validation result of this order.
+             * @param status Result of check()
+             * @return Human-readable message
              */
-            pair<bool, string> validate() const override;
+            string validationMessage(ValidationStatus status) const override;
 
             /**
-             * @brief Execute the order.
-             * If valid, adds armies to the target territory.
+             * @brief Execute the order, already known to be valid. adds armies to the target territory.
              */
-            void execute() override;
+            bool executeValidated() override;
+
+            /**
+             * @brief Compact value form of this order.
+             * @return The OrderRecord describing this order.
+             */
+            OrderRecord toRecord() const override;
 
     };
 
@@ -489,18 +880,31 @@ namespace WarzoneOrder {
             Order* clone() const override;
 
             /**
-             * @brief Validate the order.
-             * @return True if the order is valid, string for method output as string
+             * @brief Check the order against the game rules, without building any message.
+             * @return ValidationStatus::Valid, or the first rule the order breaks
+             */
+            ValidationStatus check() const override;
+
+            /**
+             * @brief Describe a validation result of this order.
+             * @param status Result of check()
+             * @return Human-readable message
              */
-            pair<bool, string> validate() const override;
+            string validationMessage(ValidationStatus status) const override;
 
             /**
-             * @brief Execute the order.
-             * If valid, moves armies between territories.
+             * @brief Execute the order, already known to be valid. moves armies between territories.
              * If target is enemy territory, resolves battle.
              * If target is friendly, reinforces it.
+             * @return True if the armies moved in (reinforcement or conquest)
              */
-            void execute() override;
+            bool executeValidated() override;
+
+            /**
+             * @brief Compact value form of this order.
+             * @return The OrderRecord describing this order.
+             */
+            OrderRecord toRecord() const override;
     };
 
     /**
@@ -588,16 +992,28 @@ namespace WarzoneOrder {
             Order* clone() const override;
 
             /**
-             * @brief Validate the order.
-             * @return True if the order is valid, string for method output as string
+             * @brief Check the order against the game rules, without building any message.
+             * @return ValidationStatus::Valid, or the first rule the order breaks
+             */
+            ValidationStatus check() const override;
+
+            /**
+             * @brief Describe a validation result of this order.
+             * @param status Result of check()
+             * @return Human-readable message
+             */
+            string validationMessage(ValidationStatus status) const override;
+
+            /**
+             * @brief Execute the order, already known to be valid. removes half the armies from the target territory.
              */
-            pair<bool, string> validate() const override;
+            bool executeValidated() override;
 
             /**
-             * @brief Execute the order.
-             * If valid, removes half the armies from the target territory.
+             * @brief Compact value form of this order.
+             * @return The OrderRecord describing this order.
              */
-            void execute() override;
+            OrderRecord toRecord() const override;
 
     };
 
@@ -700,17 +1116,29 @@ namespace WarzoneOrder {
             Order* clone() const override;
 
             /**
-             * @brief Validate the order.
-             * @return True if the order is valid, string for method output as string
+             * @brief Check the order against the game rules, without building any message.
+             * @return ValidationStatus::Valid, or the first rule the order breaks
              */
-            pair<bool, string> validate() const override;
+            ValidationStatus check() const override;
 
             /**
-             * @brief Execute the order.
-             * If valid, doubles the number of armies on the target territory
+             * @brief Describe a validation result of this order.
+             * @param status Result of check()
+             * @return Human-readable message
+             */
+            string validationMessage(ValidationStatus status) const override;
+
+            /**
+             * @brief Execute the order, already known to be valid. doubles the number of armies on the target territory
              * and transfers its ownership to the Neutral player.
              */
-            void execute() override;
+            bool executeValidated() override;
+
+            /**
+             * @brief Compact value form of this order.
+             * @return The OrderRecord describing this order.
+             */
+            OrderRecord toRecord() const override;
     };
 
 
@@ -827,18 +1255,31 @@ namespace WarzoneOrder {
             Order* clone() const override;
 
             /**
-             * @brief Validate the order.
-             * @return True if the order is valid, string for method output as string
+             * @brief Check the order against the game rules, without building any message.
+             * @return ValidationStatus::Valid, or the first rule the order breaks
              */
-            pair<bool, string> validate() const override;
+            ValidationStatus check() const override;
 
             /**
-             * @brief Execute the order.
-             * If valid, moves the specified number of armies
+             * @brief Describe a validation result of this order.
+             * @param status Result of check()
+             * @return Human-readable message
+             */
+            string validationMessage(ValidationStatus status) const override;
+
+            /**
+             * @brief Execute the order, already known to be valid. moves the specified number of armies
              * from the source territory to the target territory,
              * regardless of adjacency.
+             * @return True if at least one army moved
+             */
+            bool executeValidated() override;
+
+            /**
+             * @brief Compact value form of this order.
+             * @return The OrderRecord describing this order.
              */
-            void execute() override;
+            OrderRecord toRecord() const override;
 
     };
 
@@ -929,39 +1370,110 @@ namespace WarzoneOrder {
             Order* clone() const override;
 
             /**
-             * @brief Validate the order.
-             * @return True if the order is valid, string for method output as string
+             * @brief Check the order against the game rules, without building any message.
+             * @return ValidationStatus::Valid, or the first rule the order breaks
+             */
+            ValidationStatus check() const override;
+
+            /**
+             * @brief Describe a validation result of this order.
+             * @param status Result of check()
+             * @return Human-readable message
              */
-            pair<bool, string> validate() const override;
+            string validationMessage(ValidationStatus status) const override;
 
             /**
-             * @brief Execute the order.
+             * @brief Execute the order, already known to be valid.
              * 
-             * If valid, this order modifies both players’ state by adding each player
+             * This order modifies both players’ state by adding each player
              * to the other’s list of neutral enemies (via Player::addNeutralEnemy()).
              * 
              * Later, when toAttack() is called, territories belonging to neutral enemies
              * will not appear in the list of valid attack options, preventing
              * attacks between the two players for the rest of the turn.
              */
+            bool executeValidated() override;
 
-            void execute() override;
+            /**
+             * @brief Compact value form of this order.
+             * @return The OrderRecord describing this order.
+             */
+            OrderRecord toRecord() const override;
 
     };
 
+    /*------------------------------------------ORDER RECORD FUNCTIONS--------------------------------------------------*/
+
+    /**
+     * @brief Checks an order record against the game rules, without building any message.
+     * Uses the same rules as the matching Order subclass' check().
+     * @param record Order to check
+     * @param territories Territory list of the map, indexed by Territory::getIndex()
+     * @return ValidationStatus::Valid, or the first rule the order breaks
+     */
+    ValidationStatus validateRecord(const OrderRecord& record, const vector<Territory*>& territories);
+
+    /**
+     * @brief Executes an order record, dispatching on its type with a switch.
+     * Same effect on the game state as the matching Order subclass' execute(), but no effect string is built
+     * and no observer is notified.
+     * @param record Order to execute
+     * @param territories Territory list of the map, indexed by Territory::getIndex()
+     * @param stats Sink the order and its battle are recorded in, nullptr to record nothing
+     * @return True if the order was valid and executed, false if it was skipped
+     */
+    bool executeRecord(const OrderRecord& record, const vector<Territory*>& territories, OrderStats* stats = nullptr);
+
+    /**
+     * @brief Builds the Order object described by a record (adapter for code using the class API).
+     * @param record Order to convert
+     * @param territories Territory list of the map, indexed by Territory::getIndex()
+     * @return Heap-allocated Order of the record's type
+     */
+    Order* makeOrder(const OrderRecord& record, const vector<Territory*>& territories);
+
     /*------------------------------------------ORDERLIST CLASS--------------------------------------------------*/
     
     /**
      * @class OrderList
      * @brief Manages a collection of Order objects for a player.
+     *
+     * Orders are consumed from the front through a read cursor: popFront() only advances the cursor, and the
+     * consumed prefix is dropped in one go once it makes up half the buffer, so draining a list is O(n) overall.
      */
     class OrderList : public WarzoneLog::Subject, public WarzoneLog::ILoggable {
         
         private:
 
-            //Container for orders
+            //Container for orders, live orders are orders[head, orders.size())
             vector<Order*> orders;
 
+            //Read cursor, index of the first live order
+            size_t head;
+
+            //Nesting depth of beginBatch() calls, and whether anything changed inside the batch
+            int batchDepth;
+            bool batchDirty;
+
+            //Compact copies of the orders while recordsCompiled, records[i] describes orders[i]
+            vector<OrderRecord> records;
+            bool recordsCompiled;
+
+            /**
+             * @brief Drops the compiled records, after any change other than popFront()
+             */
+            void invalidateRecords();
+
+            /**
+             * @brief Notifies observers, or defers the notification to endBatch() while a batch is open
+             */
+            void notifyChange();
+
+            /**
+             * @brief Drops the consumed prefix so that live orders start at index 0
+             */
+            void compact();
+
         public:
 
             //-- Constructors, Destructor, Copy Constructor, Assignment Operator, Stream Insertion Operator --//
@@ -1013,6 +1525,7 @@ namespace WarzoneOrder {
 
             /**
              * @brief Get the vector of Orders (non-const version).
+             * Compacts the list first if orders were popped, so the vector only holds live orders.
              * @return A reference to the vector of Order pointers.
              */
             vector<Order*>& getOrders();
@@ -1050,6 +1563,46 @@ namespace WarzoneOrder {
              */
             void removeOrder(Order* o);
 
+            /**
+             * @brief Remove the first Order from the list.
+             * 
+             * Deletes the Order and advances the read cursor, amortized O(1).
+             */
+            void popFront();
+
+            /**
+             * @brief Stores the records of all live orders contiguously, for peekRecord().
+             * 
+             * Records stay valid through popFront(); any other change to the list drops them.
+             */
+            void compileRecords();
+
+            /**
+             * @brief Get the record of the first order.
+             * @return Pointer to the record of the first order, or nullptr if empty or not compiled
+             */
+            const OrderRecord* peekRecord() const;
+
+            /**
+             * @brief Opens a batch: observers are notified once by the matching endBatch(), instead of once per change.
+             * Batches nest, only the outermost endBatch() notifies.
+             */
+            void beginBatch();
+
+            /**
+             * @brief Closes a batch opened by beginBatch(), notifying observers once if the list changed.
+             */
+            void endBatch();
+
+            /**
+             * @brief Delete an Order but keep its slot.
+             * 
+             * The slot still counts in size() and takes its turn during round-robin execution, so the
+             * interleaving of the remaining orders with other players' orders is unchanged. peek() returns nullptr for it.
+             * @param index The position of the Order to elide.
+             */
+            void elideOrder(int index);
+
             /**
              * @brief Move an Order within the list.
              * 
@@ -1,4 +1,5 @@
 #include "Player.h"
+#include "PlayerStrategies.h"
 #include "../Order/Order.h"
 
 using namespace std;
@@ -121,6 +122,7 @@ namespace WarzonePlayer {
 
         if(this -> owns(t)){ return; } //Check if null or already exists
         
+        StateJournal::record(undoAddTerritory, this, t, 0);
         territories.push_back(t);
         territoryIndex[t -> getID()] = t;
 
@@ -144,6 +146,7 @@ namespace WarzonePlayer {
 
         if(vectorTerrIndex != territories.end()) { //Ensure that the territory to be removed exists in the vector
 
+            StateJournal::record(undoRemoveTerritory, this, t, vectorTerrIndex - territories.begin());
             territories.erase(vectorTerrIndex);
         
         }
@@ -157,6 +160,26 @@ namespace WarzonePlayer {
 
     }
 
+    void PlayerTerrContainer::undoAddTerritory(const JournalEntry& entry) {
+
+        PlayerTerrContainer* container = static_cast<PlayerTerrContainer*>(entry.object);
+        Territory* t = static_cast<Territory*>(entry.pointer);
+
+        container -> territories.pop_back(); //Changes are undone newest first, so it is still the last one
+        container -> territoryIndex.erase(t -> getID());
+
+    }
+
+    void PlayerTerrContainer::undoRemoveTerritory(const JournalEntry& entry) {
+
+        PlayerTerrContainer* container = static_cast<PlayerTerrContainer*>(entry.object);
+        Territory* t = static_cast<Territory*>(entry.pointer);
+
+        container -> territories.insert(container -> territories.begin() + entry.value, t); //Back to its old position, iteration order matters to the AI
+        container -> territoryIndex[t -> getID()] = t;
+
+    }
+
     bool PlayerTerrContainer::owns(Territory* t) const {
 
         if(t == nullptr) { return false; }
@@ -164,6 +187,37 @@ namespace WarzonePlayer {
 
     }
 
+    void PlayerTerrContainer::rebind(const vector<Territory*>& mapTerritories, Player* newOwner) {
+
+        auto inOtherMap = [&mapTerritories](const Territory* t) {
+
+            return t != nullptr && t -> getIndex() >= 0 && static_cast<size_t>(t -> getIndex()) < mapTerritories.size();
+
+        };
+
+        size_t kept = 0;
+        for(Territory* t : territories) {
+
+            if(inOtherMap(t)) { territories[kept++] = mapTerritories[t -> getIndex()]; }
+
+        }
+
+        territories.resize(kept);
+
+        //Same IDs in both maps, only the values change
+        for(auto it = territoryIndex.begin(); it != territoryIndex.end();) {
+
+            if(!inOtherMap(it -> second)) { it = territoryIndex.erase(it); continue; }
+
+            it -> second = mapTerritories[it -> second -> getIndex()];
+            it++;
+
+        }
+
+        for(Territory* t : territories) { t -> setOwner(newOwner); }
+
+    }
+
     void PlayerTerrContainer::clear() {
 
         territories.clear();
@@ -190,7 +244,10 @@ namespace WarzonePlayer {
         this -> playerOrders = new OrderList();
         this -> generateCardThisTurn = false;
         this -> reinforcementPool = 0;
+        this -> playerIndex = PLAYER_NO_INDEX;
+        this -> role = PlayerRole::Active;
         this -> continentLookupTablePlayer = {};
+        this -> strategy = nullptr;
 
     }
 
@@ -203,7 +260,10 @@ namespace WarzonePlayer {
         this -> playerOrders = new OrderList();
         this -> generateCardThisTurn = false;
         this -> reinforcementPool = 0;
+        this -> playerIndex = PLAYER_NO_INDEX;
+        this -> role = PlayerRole::Active;
         this -> continentLookupTablePlayer = emptyHashMap;
+        this -> strategy = nullptr;
 
     }
 
@@ -218,7 +278,10 @@ namespace WarzonePlayer {
         this -> playerOrders = orders;
         this -> generateCardThisTurn = generateCard;
         this -> reinforcementPool = reinforcmentPool;
+        this -> playerIndex = PLAYER_NO_INDEX;
+        this -> role = PlayerRole::Active;
         this -> continentLookupTablePlayer = emptyHashMap;
+        this -> strategy = nullptr;
 
 
         //Assign ownership of each territory to this player
@@ -233,9 +296,10 @@ namespace WarzonePlayer {
 
     Player::~Player() {
 
-        // Release hand and orders
+        // Release hand, orders and strategy
         delete this -> playerHand; 
         delete this -> playerOrders;
+        delete this -> strategy;
 
         // Reset ownership for territories
         for(Territory* terr : this -> ownedTerritories.getTerritories()) {
@@ -257,7 +321,11 @@ namespace WarzonePlayer {
         this -> playerHand = (other.playerHand ? new Hand(*other.playerHand) : nullptr);
         this -> playerOrders = (other.playerOrders ? new OrderList(*other.playerOrders) : nullptr);
         this -> generateCardThisTurn = other.generateCardThisTurn;
+        this -> playerIndex = other.playerIndex;
+        this -> role = other.role;
         this -> continentLookupTablePlayer = other.continentLookupTablePlayer;
+        this -> decisionRng = other.decisionRng;
+        this -> strategy = (other.strategy ? other.strategy -> clone() : nullptr);
 
         //Update ownership of copied territories
         for (Territory* terr : this->ownedTerritories.getTerritories()) {
@@ -275,6 +343,7 @@ namespace WarzonePlayer {
             // Clean up existing dynamic allocations
             delete this -> playerHand;
             delete this -> playerOrders;
+            delete this -> strategy;
 
             // Copy basic fields
             this->playerName = other.playerName;
@@ -283,7 +352,11 @@ namespace WarzonePlayer {
             this->playerHand = (other.playerHand ? new Hand(*other.playerHand) : nullptr);
             this->playerOrders = (other.playerOrders ? new OrderList(*other.playerOrders) : nullptr);
             this->generateCardThisTurn = other.generateCardThisTurn;
+            this -> playerIndex = other.playerIndex;
+            this -> role = other.role;
             this -> continentLookupTablePlayer = other.continentLookupTablePlayer;
+            this -> decisionRng = other.decisionRng;
+            this -> strategy = (other.strategy ? other.strategy -> clone() : nullptr);
 
             // --- Fix: update ownership of copied territories ---
             for (Territory* terr : this->ownedTerritories.getTerritories()) {
@@ -298,6 +371,66 @@ namespace WarzonePlayer {
 
     }
 
+    Player::Player(const Player& other, const vector<Territory*>& mapTerritories, const unordered_map<Continent*, long long>& emptyHashMap) {
+
+        this -> playerName = other.playerName;
+        this -> neutralEnemies = {}; //See resolveReferencesFrom()
+        this -> ownedTerritories = other.ownedTerritories;
+        this -> ownedTerritories.rebind(mapTerritories, this);
+        this -> playerHand = (other.playerHand ? new Hand(*other.playerHand) : nullptr);
+        this -> playerOrders = new OrderList(); //See resolveReferencesFrom()
+        this -> generateCardThisTurn = other.generateCardThisTurn;
+        this -> reinforcementPool = other.reinforcementPool;
+        this -> playerIndex = other.playerIndex;
+        this -> role = other.role;
+        this -> decisionRng = other.decisionRng;
+        this -> strategy = (other.strategy ? other.strategy -> clone() : nullptr);
+
+        //Continent sums are keyed by the copied map's continents, so they are summed again from the owned territories
+        this -> continentLookupTablePlayer = emptyHashMap;
+        for(Territory* t : ownedTerritories.getTerritories()) {
+
+            if(t -> getContinent() != nullptr) { continentLookupTablePlayer[t -> getContinent()] += t -> getNumericTerrID(); }
+
+        }
+
+    }
+
+    void Player::resolveReferencesFrom(const Player& other, const vector<Player*>& playersByIndex, const vector<Territory*>& mapTerritories) {
+
+        auto resolve = [&playersByIndex](Player* p) -> Player* {
+
+            if(p == nullptr || p -> getPlayerIndex() >= playersByIndex.size()) { return nullptr; }
+            return playersByIndex[p -> getPlayerIndex()];
+
+        };
+
+        neutralEnemies.clear();
+        for(Player* enemy : other.neutralEnemies) {
+
+            Player* resolved = resolve(enemy);
+            if(resolved != nullptr) { neutralEnemies.push_back(resolved); }
+
+        }
+
+        if(other.playerOrders == nullptr || playerOrders == nullptr) { return; }
+
+        //Orders go through their record form, which names territories by dense index
+        for(Order* o : other.playerOrders -> getOrders()) {
+
+            if(o == nullptr) { continue; } //Elided slot
+
+            WarzoneOrder::OrderRecord record = o -> toRecord();
+            record.issuer = resolve(record.issuer);
+            record.targetPlayer = resolve(record.targetPlayer);
+
+            Order* copy = WarzoneOrder::makeOrder(record, mapTerritories);
+            if(copy != nullptr) { playerOrders -> addOrder(copy); }
+
+        }
+
+    }
+
     ostream& operator<<(ostream& os, const Player& p) {
 
         os << "Player Info:" << endl << "Name: " << p.playerName << endl
@@ -365,6 +498,14 @@ namespace WarzonePlayer {
 
     void Player::setPlayerName(const string& name) { playerName = name; }
 
+    uint16_t Player::getPlayerIndex() const { return playerIndex; }
+
+    void Player::setPlayerIndex(uint16_t index) { playerIndex = index; }
+
+    PlayerRole Player::getRole() const { return role; }
+
+    void Player::setRole(PlayerRole newRole) { role = newRole; }
+
     const vector<Player*>& Player::getNeutralEnemies() const { return neutralEnemies; }
 
     void Player::setNeutralEnemies(const vector<Player*>& enemies) { neutralEnemies = enemies; }
@@ -404,7 +545,12 @@ namespace WarzonePlayer {
 
     bool Player::getGenerateCardThisTurn() const { return this -> generateCardThisTurn; }
 
-    void Player::setGenerateCardThisTurn(bool flag) { this -> generateCardThisTurn = flag; }
+    void Player::setGenerateCardThisTurn(bool flag) { 
+        
+        StateJournal::record(undoGenerateCardFlag, this, nullptr, this -> generateCardThisTurn);
+        this -> generateCardThisTurn = flag; 
+    
+    }
 
     int Player::getReinforcementPool() const { return this -> reinforcementPool; }
 
@@ -420,18 +566,72 @@ namespace WarzonePlayer {
 
     //----------------- Class Methods -------------------//
 
-    unordered_map<Territory*, Territory*> Player::toAttack() {
+    size_t Player::territoryTableSize() const {
+
+        size_t tableSize = 0;
+
+        for(Territory* t : ownedTerritories.getTerritories()) {
+
+            if(t != nullptr && t -> getIndex() >= 0) { tableSize = max(tableSize, (size_t) t -> getIndex() + 1); }
+
+        }
+
+        return tableSize;
+
+    }
+
+    pmr::memory_resource* Player::getScratchArena() {
+
+        //Left uninitialized, the tables built on it set every slot they read
+        if(scratchArena == nullptr) {
+
+            scratchBuffer.reset(new std::byte[PLAYER_SCRATCH_ARENA_BYTES]);
+            scratchArena = make_unique<pmr::monotonic_buffer_resource>(scratchBuffer.get(), PLAYER_SCRATCH_ARENA_BYTES);
+
+        }
+
+        return scratchArena.get();
+
+    }
+
+    void Player::resetScratchArena() { if(scratchArena != nullptr) { scratchArena -> release(); } }
+
+    PlayerStrategy* Player::getStrategy() const { return this -> strategy; }
+
+    void Player::setStrategy(PlayerStrategy* newStrategy) {
+
+        if(this -> strategy == newStrategy) { return; }
+
+        delete this -> strategy;
+        this -> strategy = newStrategy;
+
+    }
+
+    void Player::seedDecisionRng(unsigned int seed) { decisionRng.seed(seed); }
+
+    mt19937& Player::getDecisionRng() { return decisionRng; }
 
-        unordered_map<Territory*, Territory*> attackMap; //Mapping of owned territory, best enemy target
+    void Player::returnPendingCards(Deck* gameDeck) {
+
+        if(gameDeck == nullptr) { return; }
+
+        for(Card* c : pendingDeckReturns) { gameDeck -> returnToDeck(c); }
+        pendingDeckReturns.clear();
+
+    }
+
+    TerritoryTable Player::toAttack() {
+
+        TerritoryTable attackTable(territoryTableSize(), nullptr, getScratchArena()); //Owned territory index -> best enemy target
 
         //Iterate through all owned territories
         for(Territory* currTerr : ownedTerritories.getTerritories()) {
 
-            if(currTerr == nullptr) { continue; }
+            if(currTerr == nullptr || currTerr -> getIndex() < 0) { continue; }
 
-            vector<Territory*> enemyNeighbors;
+            Territory* bestTarget = nullptr;
 
-            //Collect all valid enemy neighbors
+            //Single pass over valid enemy neighbors, keeping the top-ranked one
             for(Territory* neighTerr : currTerr -> getNeighbors()) {
 
                 if(neighTerr == nullptr) { continue; }
@@ -453,28 +653,16 @@ namespace WarzonePlayer {
 
                 if(neighOwner == this || isNeutral || neighOwner == nullptr) { continue; }
 
-                enemyNeighbors.push_back(neighTerr);
+                //Argmax using the improved comparator (includes continent bonus logic)
+                if(bestTarget == nullptr || Territory::territoryAttackPriorityCompare(neighTerr, bestTarget)) { bestTarget = neighTerr; }
 
             }
 
-            //Skip if this territory has no valid enemies nearby
-            if(enemyNeighbors.empty()) {
-
-                attackMap[currTerr] = nullptr;
-                continue;
-
-            }
-
-            //Sort using the improved comparator (includes continent bonus logic)
-            sort(enemyNeighbors.begin(), enemyNeighbors.end(), Territory::territoryAttackPriorityCompare);
-
-            //Select the top-ranked attack target
-            Territory* bestTarget = enemyNeighbors.front();
-            attackMap[currTerr] = bestTarget;
+            attackTable[currTerr -> getIndex()] = bestTarget; //Stays nullptr if this territory has no valid enemies nearby
 
         }
 
-        return attackMap;
+        return attackTable;
 
     }
 
@@ -547,48 +735,58 @@ namespace WarzonePlayer {
 
     }
 
-    unordered_map<Territory*, Territory*> Player::toDefend() {
+    TerritoryTable Player::toDefend() {
 
-        //Get all territories owned by this player that border at least one enemy territory
-        vector<Territory*> borderTerritories = getTerritoriesAdjacentToEnemy();
+        size_t tableSize = territoryTableSize();
+
+        TerritoryTable defenseTable(tableSize, nullptr, getScratchArena()); //Territory index -> next territory 1 layer closer to enemy
+        pmr::vector<char> visited(tableSize, 0, getScratchArena()); //Visited territory
+        pmr::vector<Territory*> frontier(getScratchArena()); //BFS queue, read with a moving head instead of popping
+        frontier.reserve(ownedTerritories.size());
+
+        //Collect all territories owned by this player that border at least one enemy territory
+        for(Territory* owned : ownedTerritories.getTerritories()) {
 
-        unordered_map<Territory*, Territory*> defenseMap; //Territory, ptr to next territory 1 layer closer to enemy
-        unordered_set<Territory*> visited; //Visited territory
-        queue<Territory*> q;
+            if(owned == nullptr || owned -> getIndex() < 0) { continue; } //Ignore null pointer
 
-        //Initialize BFS with all border territories
-        for(Territory* border : borderTerritories) {
+            for(Territory* neighbor : owned -> getNeighbors()) {
 
-            if(border == nullptr) { continue; } //Ignore null pointer
+                if(neighbor != nullptr && neighbor -> getOwner() != nullptr && neighbor -> getOwner() != this) {
 
-            visited.insert(border);
-            q.push(border);
-            defenseMap[border] = nullptr; //Border territories have no forward target, since they're on the border
+                    frontier.push_back(owned);
+                    break;
+
+                }
+
+            }
 
         }
 
+        //Weakest borders are expanded first, so rear territories lean towards them
+        sort(frontier.begin(), frontier.end(), Territory::territoryNumArmiesCompareAscend);
+
+        //Border territories have no forward target, since they're on the border
+        for(Territory* border : frontier) { visited[border -> getIndex()] = 1; }
+
         //Perform BFS traversal inward through owned territories
-        while(!q.empty()) {
+        for(size_t head = 0; head < frontier.size(); head++) {
 
-            Territory* current = q.front(); //Get current territory
-            q.pop();
+            Territory* current = frontier[head]; //Get current territory
 
             for(Territory* neighbor : current -> getNeighbors()) {
 
                 if(neighbor == nullptr) { continue; } //Ignore null neighbours
 
-                Player* owner = neighbor -> getOwner();
-
                 //Only propagate through territories owned by this player
-                if(owner == this && visited.find(neighbor) == visited.end()) {
+                if(neighbor -> getOwner() == this && !visited[neighbor -> getIndex()]) {
 
-                    visited.insert(neighbor);
+                    visited[neighbor -> getIndex()] = 1;
 
                     //Assign neighbor’s "defense target" to point toward current
-                    defenseMap[neighbor] = current;
+                    defenseTable[neighbor -> getIndex()] = current;
 
                     //Continue exploring inward
-                    q.push(neighbor);
+                    frontier.push_back(neighbor);
 
                 }
 
@@ -596,7 +794,7 @@ namespace WarzonePlayer {
 
         }
 
-        return defenseMap;
+        return defenseTable;
 
     }
 
@@ -713,16 +911,8 @@ namespace WarzonePlayer {
         //If no reinforcements are available, skip this phase
         if(reinforcementPool <= 0) { return; }
 
-        //Build defensive routing map (Territory -> next toward enemy)
-        unordered_map<Territory*, Territory*> defenseMap = toDefend();
-
-        //Collect frontline territories (those with nextTerritories that are nullptr)
-        vector<Territory*> frontlines;
-        for(pair<Territory*, Territory*> currTerr : defenseMap) {
-
-            if(currTerr.second == nullptr) { frontlines.push_back(currTerr.first); }
-
-        }
+        //Collect frontline territories, already sorted by ascending army count so weakest frontlines get reinforced first
+        vector<Territory*> frontlines = getTerritoriesAdjacentToEnemy();
 
         if(frontlines.empty()) { //This should not happen
 
@@ -735,9 +925,6 @@ namespace WarzonePlayer {
 
         }
 
-        //Sort by ascending army count so weakest frontlines get reinforced first
-        sort(frontlines.begin(), frontlines.end(), Territory::territoryNumArmiesCompareAscend);
-
         int remainingArmies = reinforcementPool;
         output << "[IssueOrder] " << playerName
             << " is distributing " << reinforcementPool
@@ -754,7 +941,7 @@ namespace WarzonePlayer {
 
             //Randomly vary between minArmies and remainingArmies / 2 (never exceed remaining)
             int maxDeploy = max(minArmies, remainingArmies / 2);
-            int armiesToDeploy = static_cast<int>(TimeUtil::getSystemTimeNano() % maxDeploy) + 1;
+            int armiesToDeploy = static_cast<int>(decisionRng() % maxDeploy) + 1;
             armiesToDeploy = min(armiesToDeploy, remainingArmies);
 
             //Create and add Deploy order
@@ -791,12 +978,12 @@ namespace WarzonePlayer {
         //Get player’s border territories
         vector<Territory*> borderTerrs = getTerritoriesAdjacentToEnemy(); //Get border territories
 
-        //Get per-territory preferred attack targets (Territory -> best enemy neighbor)
-        unordered_map<Territory*, Territory*> attackMap = toAttack();
+        //Get per-territory preferred attack targets (Territory index -> best enemy neighbor)
+        TerritoryTable attackTable = toAttack();
 
         //Determine if any NON-NEUTRAL attack is possible at all.
         bool nonNeutralAttackPossible = false; //Default set to false
-        vector<Player*> neutrals = this -> getNeutralEnemies(); // players under truce / peaceful list
+        pmr::vector<Player*> neutrals(neutralEnemies.begin(), neutralEnemies.end(), getScratchArena()); // players under truce / peaceful list
         neutrals.push_back(neutralPlayer); //Add neutral player from game engine
 
         for(Territory* source : borderTerrs) {
@@ -845,12 +1032,9 @@ namespace WarzonePlayer {
             //Only attack if current territory has more than 1 army (cannot move last defender)
             if(sourceArmies <= 1) { continue; }
 
-            //Find this territory's preferred target from the attack map
-            //Find this territory's preferred target from the attack map
-            Territory* target = nullptr;
-
-            if(attackMap.count(source) > 0) { target = attackMap[source]; } //Check if source exists in the unordered_map
-            else { continue; } //No target computed for this source
+            //Find this territory's preferred target from the attack table
+            if(source -> getIndex() < 0 || source -> getIndex() >= (int) attackTable.size()) { continue; } //No target computed for this source
+            Territory* target = attackTable[source -> getIndex()];
 
             //If no valid target, skip
             if(target == nullptr) { continue; }
@@ -924,10 +1108,10 @@ namespace WarzonePlayer {
 
     void Player::issueDefendOrders(ostringstream& output, bool surpressOutput) {
 
-        //Obtain the defensive mapping (each territory points to the next closer to enemy)
-        unordered_map<Territory*, Territory*> defenseMap = toDefend();
+        //Obtain the defensive table (each territory points to the next closer to enemy)
+        TerritoryTable defenseTable = toDefend();
 
-        if(defenseMap.empty()) {
+        if(defenseTable.empty()) {
 
             if(!surpressOutput) {
                 output << "[IssueOrder] " << playerName
@@ -938,13 +1122,14 @@ namespace WarzonePlayer {
 
         }
 
-        //Iterate through all owned territories in the defense map
-        for(const auto& entry : defenseMap) { //Compiler gets mad if I dont use auto here :( 
+        //Iterate through all owned territories
+        for(Territory* source : ownedTerritories.getTerritories()) { //Territory that will send reinforcements
+
+            if(source == nullptr || source -> getIndex() < 0) { continue; } //Skip null entries
 
-            Territory* source = entry.first; //Territory that will send reinforcements
-            Territory* target = entry.second; //Territory closer to enemy (destination)
+            Territory* target = defenseTable[source -> getIndex()]; //Territory closer to enemy (destination)
 
-            if(source == nullptr || target == nullptr) { continue; } //Skip null entries, as well as frontlines
+            if(target == nullptr) { continue; } //Skip frontlines and unreachable territories
 
             int sourceArmies = source -> getNumArmies();
             if(sourceArmies <= 1) { continue; } //Cannot move last defender
@@ -1009,7 +1194,7 @@ namespace WarzonePlayer {
         while(randomOrder == -1 && !orderTypesAvailableByCard.empty()) { 
 
             //Get random card
-            int randomOrderIndex = static_cast<int>(TimeUtil::getSystemTimeNano() % orderTypesAvailableByCard.size());
+            int randomOrderIndex = static_cast<int>(decisionRng() % orderTypesAvailableByCard.size());
             pair<bool, int> orderTypeInfo = orderTypesAvailableByCard[randomOrderIndex];
 
             if(orderTypeInfo.first == true) { randomOrder = orderTypeInfo.second; } //If the order is valid 
@@ -1024,13 +1209,21 @@ namespace WarzonePlayer {
 
         }
 
+        playCardOrder(randomOrder, output, surpressOutput, gameDeck);
+
+    }
+
+    bool Player::playCardOrder(int orderType, ostringstream& output, bool surpressOutput, Deck* gameDeck) {
+
+        if(playerHand == nullptr || playerOrders == nullptr) { return false; }
+
         //Create the selected order type
         Order* tempOrder = nullptr;
 
         //Get relevant card
         Card* usedCard = nullptr;
 
-        switch(randomOrder) {
+        switch(orderType) {
 
             case 0: 
                 
@@ -1060,9 +1253,19 @@ namespace WarzonePlayer {
 
         }
 
-        //Remove used card from player's hand, return to game deck
+        //Player doesn't actually hold this card
+        if(usedCard == nullptr) {
+
+            delete tempOrder;
+            return false;
+
+        }
+
+        //Remove used card from player's hand, return to game deck (or hold it until the engine can return it safely)
         playerHand -> removeCardFromHand(usedCard);
-        gameDeck -> returnToDeck(usedCard);
+
+        if(gameDeck != nullptr) { gameDeck -> returnToDeck(usedCard); }
+        else { pendingDeckReturns.push_back(usedCard); }
 
         //Inform that a card has been used
         if(!surpressOutput){
@@ -1094,6 +1297,8 @@ namespace WarzonePlayer {
 
         }
 
+        return tempOrder != nullptr;
+
     }
 
     string Player::issueOrder(bool surpressOutput, Deck* gameDeck, Player* neutralPlayer) {
@@ -1102,6 +1307,17 @@ namespace WarzonePlayer {
 
         if(this -> playerOrders == nullptr) { return "[IssueOrder] Error: Player order list not initialized.\n"; }
 
+        //New turn, drop last turn's AI tables
+        resetScratchArena();
+
+        //Attached strategies take over the whole decision process
+        if(this -> strategy != nullptr) {
+
+            this -> strategy -> issueOrder(this, output, surpressOutput, gameDeck, neutralPlayer);
+            return output.str();
+
+        }
+
         //PART 1: DEPLOYING ARMIES ACROSS WEAKEST TERRITORIES
         deployReinforcements(output, surpressOutput);
 
@@ -1218,6 +1434,12 @@ namespace WarzonePlayer {
 
     void Player::clearNeutralEnemies() {
 
+        if(StateJournal::getActive() != nullptr) { //Journal every removal, last first, so undoing reinserts in order
+
+            for(size_t i = neutralEnemies.size(); i > 0; i--) { StateJournal::record(undoRemoveNeutralEnemy, this, neutralEnemies[i - 1], static_cast<long long>(i - 1)); }
+
+        }
+
         this -> neutralEnemies.clear();
         
     }
@@ -1239,7 +1461,12 @@ namespace WarzonePlayer {
         ownedTerritories.addTerritory(territory, this);
 
         WarzoneMap::Continent* cont = territory -> getContinent();
-        if(cont != nullptr) { continentLookupTablePlayer[cont] += territory -> getNumericTerrID(); } //Increment continent score by territory ID
+        if(cont != nullptr) { //Increment continent score by territory ID
+
+            continentLookupTablePlayer[cont] += territory -> getNumericTerrID();
+            StateJournal::record(undoContinentScore, this, cont, territory -> getNumericTerrID());
+
+        }
 
     }
 
@@ -1253,7 +1480,12 @@ namespace WarzonePlayer {
 
         // Update continent sums
         WarzoneMap::Continent* cont = territory -> getContinent();
-        if(cont != nullptr) { continentLookupTablePlayer[cont] -= territory -> getNumericTerrID(); }  //Decrement continent score by territory ID
+        if(cont != nullptr) { //Decrement continent score by territory ID
+
+            continentLookupTablePlayer[cont] -= territory -> getNumericTerrID();
+            StateJournal::record(undoContinentScore, this, cont, -territory -> getNumericTerrID());
+
+        }
 
     }
 
@@ -1261,6 +1493,7 @@ namespace WarzonePlayer {
 
         if(find(neutralEnemies.begin(), neutralEnemies.end(), enemyName) == neutralEnemies.end()) {
 
+            StateJournal::record(undoAddNeutralEnemy, this, enemyName, 0);
             neutralEnemies.push_back(enemyName); 
 
         }
@@ -1273,15 +1506,34 @@ namespace WarzonePlayer {
 
         if(enemyNameIndex != neutralEnemies.end()) {
 
+            StateJournal::record(undoRemoveNeutralEnemy, this, enemyName, enemyNameIndex - neutralEnemies.begin());
             neutralEnemies.erase(enemyNameIndex);
 
         } 
 
     }
 
+    void Player::undoContinentScore(const JournalEntry& entry) {
+
+        static_cast<Player*>(entry.object) -> continentLookupTablePlayer[static_cast<Continent*>(entry.pointer)] -= entry.value;
+
+    }
+
+    void Player::undoAddNeutralEnemy(const JournalEntry& entry) { static_cast<Player*>(entry.object) -> neutralEnemies.pop_back(); }
+
+    void Player::undoRemoveNeutralEnemy(const JournalEntry& entry) {
+
+        vector<Player*>& enemies = static_cast<Player*>(entry.object) -> neutralEnemies;
+        enemies.insert(enemies.begin() + entry.value, static_cast<Player*>(entry.pointer));
+
+    }
+
+    void Player::undoGenerateCardFlag(const JournalEntry& entry) { static_cast<Player*>(entry.object) -> generateCardThisTurn = entry.value != 0; }
+
     vector<Territory*> Player::getTerritoriesAdjacentToEnemy() const {
 
-        unordered_set<Territory*> adjacentToEnemySet;
+        //Each owned territory is visited once, so no set is needed; collecting in ownership order keeps the result reproducible
+        vector<Territory*> territoriesAdjacentToEnemy;
 
         // Loop through each owned territory
         for(Territory* owned : ownedTerritories.getTerritories()) {
@@ -1300,7 +1552,7 @@ namespace WarzonePlayer {
                 //If neighbor exists, and belongs to someone else (enemy), mark this territory
                 if(neighborOwner != nullptr && neighborOwner != this) {
 
-                    adjacentToEnemySet.insert(owned);
+                    territoriesAdjacentToEnemy.push_back(owned);
                     break; //No need to check other neighbors for this territory, it is adjacent to at least 1 enemy
 
                 }
@@ -1309,18 +1561,8 @@ namespace WarzonePlayer {
 
         }
 
-        //Convert to a vector safely
-        vector<Territory*> territoriesAdjacentToEnemy;
-        territoriesAdjacentToEnemy.reserve(adjacentToEnemySet.size());
-
-        for(Territory* t : adjacentToEnemySet) {
-            
-            if(t != nullptr) { territoriesAdjacentToEnemy.push_back(t); }
-        
-        }
-
-        //Sort by ascending army count (weakest borders first)
-        sort(territoriesAdjacentToEnemy.begin(), territoriesAdjacentToEnemy.end(), Territory::territoryNumArmiesCompareAscend);
+        //Sort by ascending army count (weakest borders first), ties keep ownership order
+        stable_sort(territoriesAdjacentToEnemy.begin(), territoriesAdjacentToEnemy.end(), Territory::territoryNumArmiesCompareAscend);
 
         return territoriesAdjacentToEnemy;
         
@@ -1356,6 +1598,7 @@ namespace WarzonePlayer {
     vector<Territory*> Player::getBombCandidates() const {
 
         unordered_set<Territory*> candidateSet; //Ensure uniqueness of bombing targets
+        vector<Territory*> candidates;
         const vector<Player*>& neutrals = this -> getNeutralEnemies(); //Truce list
 
         //Get all territories owned by player that are adjacent to at least one enemy
@@ -1383,25 +1626,15 @@ namespace WarzonePlayer {
                 //Skip neighbors with <= 1 army (bombing would have no meaningful effect)
                 if(neighbor -> getNumArmies() <= 1) { continue; }
 
-                //Otherwise, this is a valid bombing target
-                candidateSet.insert(neighbor);
+                //Otherwise, this is a valid bombing target (kept in discovery order, so ties are reproducible)
+                if(candidateSet.insert(neighbor).second) { candidates.push_back(neighbor); }
 
             }
 
         }
 
-        //Convert unordered_set to vector for return
-        vector<Territory*> candidates;
-        candidates.reserve(candidateSet.size());
-
-        for(Territory* t : candidateSet) {
-        
-            if(t != nullptr) { candidates.push_back(t); }
-        
-        }
-
         //Prioritize largest army counts first (high-value bomb targets)
-        sort(candidates.begin(), candidates.end(), Territory::territoryNumArmiesCompareDescend);
+        stable_sort(candidates.begin(), candidates.end(), Territory::territoryNumArmiesCompareDescend);
 
         return candidates;
 
@@ -2,11 +2,15 @@
 
 
 #include <algorithm>
+#include <cstdint>
 #include <string>
 #include <vector>
 #include <unordered_map>
 #include <iostream>
+#include <memory>
+#include <memory_resource>
 #include <queue>
+#include <random>
 
 #include "../Map/Map.h"
 #include "../Card/Card.h"
@@ -19,6 +23,8 @@ namespace WarzonePlayer {
 
     using WarzoneMap::Territory;
     using WarzoneMap::Continent;
+    using WarzoneMap::JournalEntry;
+    using WarzoneMap::StateJournal;
     using WarzoneCard::Hand;
     using WarzoneOrder::TimeUtil;
     using WarzoneOrder::OrderList;
@@ -27,6 +33,16 @@ namespace WarzonePlayer {
     using WarzoneCard::Hand;
     using WarzoneCard::Card;
 
+    class PlayerStrategy; //Forward declaration, see PlayerStrategies.h
+
+    //Initial size of each player's per-turn scratch arena, enough for the AI tables of maps with a few thousand territories
+    const size_t PLAYER_SCRATCH_ARENA_BYTES = 64 * 1024;
+
+    /**
+     * @brief Flat per-territory table indexed by Territory::getIndex(), allocated from a player's scratch arena.
+     */
+    using TerritoryTable = pmr::vector<Territory*>;
+
     /**
      * @brief Manages a Player's owned territories using both a vector (for iteration), and an unordered_map (for fast lookups).
      */
@@ -37,6 +53,10 @@ namespace WarzonePlayer {
             vector<Territory*> territories; //Iteration
             unordered_map<string, Territory*> territoryIndex; //For O(1) lookup by ID
 
+            //-- StateJournal undo functions --//
+            static void undoAddTerritory(const JournalEntry& entry);
+            static void undoRemoveTerritory(const JournalEntry& entry);
+
         public:
 
             //-- Constructors, Destructor, Copy Constructor, Assignment Operator, Stream Insertion Operator --//
@@ -130,6 +150,14 @@ namespace WarzonePlayer {
              */
             bool owns(Territory* t) const;
 
+            /**
+             * @brief Swaps every territory for the one with the same dense index in another map (copied games).
+             * Keeps the iteration order, and makes newOwner the owner of the swapped-in territories.
+             * @param mapTerritories Territories of the other map, by dense index
+             * @param newOwner Owner of the swapped-in territories
+             */
+            void rebind(const vector<Territory*>& mapTerritories, Player* newOwner);
+
             /**
              * @brief Clears all owned territories.
              */
@@ -142,6 +170,20 @@ namespace WarzonePlayer {
             
     };
 
+    //Index of a player the engine has not numbered yet
+    const uint16_t PLAYER_NO_INDEX = UINT16_MAX;
+
+    /**
+     * @enum PlayerRole
+     * @brief What the engine uses a player for, set once when the game starts
+     */
+    enum class PlayerRole : uint8_t {
+
+        Active,  //Issues and executes orders
+        Neutral  //Holds leftover and blockaded territories, never in the turn rotation
+
+    };
+
     /**
      * @brief The Player class represents a Warzone player.
      */
@@ -157,9 +199,38 @@ namespace WarzonePlayer {
             OrderList* playerOrders;
             bool generateCardThisTurn;
             int reinforcementPool;
+            uint16_t playerIndex; //Dense id assigned by the engine, indexes its per-player tables
+            PlayerRole role;
 
             //-- Game Logic Info --/
             unordered_map<Continent*, long long> continentLookupTablePlayer;
+
+            //-- Decision making --//
+            PlayerStrategy* strategy; //Owned. nullptr = built-in default behaviour (same as DefaultPlayerStrategy)
+            mt19937 decisionRng; //Seeded by the engine every turn, so issued orders only depend on the game seed
+            vector<Card*> pendingDeckReturns; //Cards played while issuing without a deck, returned later by returnPendingCards()
+
+            //-- Per-turn AI scratch memory (never copied, allocated on first use, released by resetScratchArena) --//
+            unique_ptr<std::byte[]> scratchBuffer;
+            unique_ptr<pmr::monotonic_buffer_resource> scratchArena;
+
+            //-- StateJournal undo functions --//
+            static void undoContinentScore(const JournalEntry& entry);
+            static void undoAddNeutralEnemy(const JournalEntry& entry);
+            static void undoRemoveNeutralEnemy(const JournalEntry& entry);
+            static void undoGenerateCardFlag(const JournalEntry& entry);
+
+            /**
+             * @brief The scratch arena, allocating its PLAYER_SCRATCH_ARENA_BYTES initial block on the first call
+             * @return Arena the AI tables are allocated from
+             */
+            pmr::memory_resource* getScratchArena();
+
+            /**
+             * @brief Size needed for a TerritoryTable covering every owned territory
+             * @return 1 + the largest dense index among owned territories (0 if none)
+             */
+            size_t territoryTableSize() const;
       
         public:
 
@@ -208,6 +279,27 @@ namespace WarzonePlayer {
              */
             Player& operator=(const Player& other);
 
+            /**
+             * @brief Copies a player into a copied game (see GameEngine's copy constructor).
+             *
+             * Unlike the copy constructor, owned territories are taken from the copied map by dense index, and the
+             * territories of other's map are left alone. Truces and orders reference other players, so they are
+             * filled in afterwards by resolveReferencesFrom().
+             *
+             * @param other Player to copy
+             * @param mapTerritories Territories of the copied map, by dense index
+             * @param emptyHashMap Empty continent table of the copied map
+             */
+            Player(const Player& other, const vector<Territory*>& mapTerritories, const unordered_map<Continent*, long long>& emptyHashMap);
+
+            /**
+             * @brief Copies other's truces and pending orders, resolving players and territories in a copied game.
+             * @param other Player this one was copied from
+             * @param playersByIndex Players of the copied game, by player index
+             * @param mapTerritories Territories of the copied map, by dense index
+             */
+            void resolveReferencesFrom(const Player& other, const vector<Player*>& playersByIndex, const vector<Territory*>& mapTerritories);
+
             /**
              * @brief Stream insertion operator for Player.
              * @param os Output stream.
@@ -230,6 +322,36 @@ namespace WarzonePlayer {
              */
             void setPlayerName(const string& playerName);
 
+            /**
+             * @brief Accessor for the player's dense index
+             * @return Index into the engine's per-player tables, PLAYER_NO_INDEX if unassigned
+             */
+            uint16_t getPlayerIndex() const;
+
+            /**
+             * @brief Mutator for the player's dense index, set by the engine
+             * @param index New index
+             */
+            void setPlayerIndex(uint16_t index);
+
+            /**
+             * @brief Accessor for the player's role
+             * @return Role of the player
+             */
+            PlayerRole getRole() const;
+
+            /**
+             * @brief Mutator for the player's role, set by the engine
+             * @param newRole New role
+             */
+            void setRole(PlayerRole newRole);
+
+            /**
+             * @brief Whether this is the neutral player
+             * @return true if the role is PlayerRole::Neutral
+             */
+            bool isNeutral() const { return role == PlayerRole::Neutral; }
+
             /**
              * @brief Accessor for neutralEnemies.
              * @return All neutral enemies as a const reference.
@@ -316,18 +438,54 @@ namespace WarzonePlayer {
 
             //-- Class Methods --//
 
+            /**
+             * @brief Accessor for the strategy driving this player's decisions
+             * @return Attached strategy, or nullptr if the player uses the built-in default behaviour
+             */
+            PlayerStrategy* getStrategy() const;
+
+            /**
+             * @brief Attaches a strategy to this player. The player takes ownership and deletes the previous one.
+             * @param newStrategy Heap-allocated strategy, or nullptr to go back to the default behaviour
+             */
+            void setStrategy(PlayerStrategy* newStrategy);
+
+            /**
+             * @brief Accessor for the per-turn decision RNG, for strategies that need randomness
+             * @return Reference to the player's seeded random generator
+             */
+            mt19937& getDecisionRng();
+
+            /**
+             * @brief Reseeds the random generator used by this player's order decisions (deploy amounts, card choice).
+             * @param seed Seed derived by the engine from the game seed, the turn and the player's position
+             */
+            void seedDecisionRng(unsigned int seed);
+
+            /**
+             * @brief Returns every card played during a deck-less issueOrder() call to the deck, in the order they were played.
+             * @param gameDeck Deck to return the cards to
+             */
+            void returnPendingCards(Deck* gameDeck);
+
+            /**
+             * @brief Releases everything allocated from this player's scratch arena.
+             * Called at the start of every issueOrder(); tables returned by toAttack()/toDefend() are invalid afterwards.
+             */
+            void resetScratchArena();
+
             /**
              * @brief Determines the optimal attack targets for each owned territory.
              *
              * For every territory owned by the player, this method evaluates adjacent enemy
-             * territories and selects the weakest as its preferred attack target. Territories
-             * without any valid enemy neighbors are mapped to nullptr.
+             * territories and selects the weakest as its preferred attack target (single argmax pass,
+             * no sorting). Territories without any valid enemy neighbors are mapped to nullptr.
              * 
-             * @return An unordered_map where each key is one of the player’s owned territories,
-             *         and each value is the weakest valid enemy territory to attack (or nullptr
-             *         if none are available).
+             * @return A flat table indexed by Territory::getIndex(), allocated from the scratch arena, where each
+             *         owned territory's slot holds the weakest valid enemy territory to attack (or nullptr
+             *         if none are available). Valid until the next resetScratchArena().
              */
-            unordered_map<Territory*, Territory*> toAttack();
+            TerritoryTable toAttack();
 
 
             /**
@@ -349,10 +507,11 @@ namespace WarzonePlayer {
             * This structure allows direct generation of defensive Advance orders by moving
             * troops along these precomputed reinforcement paths.
             *
-            * @return An unordered_map where each key is a territory owned by the player,
-            *         and each value is the territory that should receive reinforcements next.
+            * @return A flat table indexed by Territory::getIndex(), allocated from the scratch arena, where each
+            *         owned territory's slot holds the territory that should receive reinforcements next
+            *         (nullptr for borders and unreachable territories). Valid until the next resetScratchArena().
             */
-            unordered_map<Territory*, Territory*> toDefend();
+            TerritoryTable toDefend();
 
 
 
@@ -364,8 +523,7 @@ namespace WarzonePlayer {
 
             /**
              * @brief Method to handle deployment logic
-             *  This method identifies all enemy-adjacent territories (frontlines) using the defensive routing map returned
-             * by toDefend(). Armies are distributed primarily among these territories, with weaker ones prioritized first.
+             *  This method identifies all enemy-adjacent territories (frontlines) using getTerritoriesAdjacentToEnemy(). Armies are distributed primarily among these territories, with weaker ones prioritized first.
              * 
              * Distribution logic:
              * - Evenly divide remaining armies among all frontlines (rounded up).
@@ -418,16 +576,31 @@ namespace WarzonePlayer {
              *
              * @param output Reference to the ostringstream used for collecting log outputs.
              * @param surpressOutput If true, disables console output; otherwise logs actions.
-             * @param gameDeck Pointer to the game’s Deck object for returning used cards.
+             * @param gameDeck Pointer to the game’s Deck object for returning used cards. If nullptr, used cards are
+             *                 held until returnPendingCards(), so the shared deck is never touched (parallel issuing).
              */
             void issueCardOrders(ostringstream& output, bool surpressOutput, Deck* gameDeck);
 
 
+            /**
+             * @brief Plays one card from the hand as a placeholder order (targets are finalized by the engine).
+             *
+             * The card is removed from the hand and returned to the deck (or held, if gameDeck is nullptr).
+             *
+             * @param orderType 0: Bomb, 1: Blockade, 2: Airlift, 3: Negotiate
+             * @param output Reference to the ostringstream used for collecting log outputs.
+             * @param surpressOutput If true, disables console output; otherwise logs actions.
+             * @param gameDeck Pointer to the game’s Deck object for returning the used card.
+             * @return true if the player held a matching card and the order was added
+             */
+            bool playCardOrder(int orderType, ostringstream& output, bool surpressOutput, Deck* gameDeck);
+
             /**
              * @brief Creates an empty order, and adds it to the player’s order list.
-             * Also deploys a random amount of armies to territories
+             * Also deploys a random amount of armies to territories.
+             * If a strategy is attached, it decides everything instead of the built-in behaviour.
              * @param surpressOutput reduce the amount of information saved during executions
-             * @param gameDeck Deck pointer to return issued card to
+             * @param gameDeck Deck pointer to return issued card to (nullptr defers the return, see returnPendingCards())
              * @param neutralPlayer Pointer to the set neutral player
              * @return A string to detail the execution of the method
              */
@@ -0,0 +1,658 @@
+#include "PlayerStrategies.h"
+
+using namespace std;
+
+namespace WarzonePlayer {
+
+    namespace {
+
+        //Card order indices, as used by Player::canIssueCardOrder() and Player::playCardOrder()
+        const int CARD_ORDER_BOMB = 0;
+        const int CARD_ORDER_BLOCKADE = 1;
+        const int CARD_ORDER_AIRLIFT = 2;
+        const int CARD_ORDER_NEGOTIATE = 3;
+
+        /**
+         * @brief Plays the first card order in preference order that the player both holds and can use
+         * @return true if a card was played
+         */
+        bool playPreferredCard(Player* p, const vector<int>& preference, ostringstream& output, bool surpressOutput, Deck* gameDeck) {
+
+            for(int orderType : preference) {
+
+                if(!p -> canIssueCardOrder(orderType)) { continue; }
+                if(p -> playCardOrder(orderType, output, surpressOutput, gameDeck)) { return true; }
+
+            }
+
+            if(!surpressOutput) { output << "[IssueOrder] " << p -> getPlayerName() << " had no valid card orders to issue.\n"; }
+            return false;
+
+        }
+
+        /**
+         * @brief Adds a Deploy order and logs it
+         */
+        void addDeploy(Player* p, Territory* target, int armies, ostringstream& output, bool surpressOutput) {
+
+            p -> getPlayerOrders() -> addOrder(new WarzoneOrder::Deploy(p, target, armies));
+
+            if(!surpressOutput) {
+
+                output << "[IssueOrder] " << p -> getPlayerName()
+                    << " adds " << armies
+                    << " army/armies to " << target -> getID() << "\n";
+
+            }
+
+        }
+
+        /**
+         * @brief Adds an Advance order and logs it
+         */
+        void addAdvance(Player* p, Territory* source, Territory* target, int armies, ostringstream& output, bool surpressOutput) {
+
+            p -> getPlayerOrders() -> addOrder(new WarzoneOrder::Advance(p, source, target, armies));
+
+            if(!surpressOutput) {
+
+                output << "[IssueOrder] " << p -> getPlayerName() << " orders an Advance from "
+                    << source -> getID() << " (" << source -> getNumArmies() << " armies)"
+                    << " to " << target -> getID() << " ("
+                    << target -> getNumArmies() << " armies) with "
+                    << armies << " armies.\n";
+
+            }
+
+        }
+
+        /**
+         * @brief Whether the owner is currently under a truce with the player
+         */
+        bool isTrucePartner(const Player* p, const Player* owner) {
+
+            const vector<Player*>& truces = p -> getNeutralEnemies();
+            return find(truces.begin(), truces.end(), owner) != truces.end();
+
+        }
+
+        /**
+         * @brief Reads one trimmed line from the console
+         */
+        string readConsoleLine(const string& prompt) {
+
+            cout << prompt;
+
+            string line;
+            if(!getline(cin, line)) { return ""; }
+
+            size_t first = line.find_first_not_of(" \t\r");
+            size_t last = line.find_last_not_of(" \t\r");
+
+            if(first == string::npos) { return ""; }
+            return line.substr(first, last - first + 1);
+
+        }
+
+        /**
+         * @brief Finds a territory by ID among a list
+         */
+        Territory* findTerritoryByID(const vector<Territory*>& territories, const string& id) {
+
+            for(Territory* t : territories) {
+
+                if(t != nullptr && t -> getID() == id) { return t; }
+
+            }
+
+            return nullptr;
+
+        }
+
+    }
+
+    // ================= PlayerStrategy ================= //
+
+    //-- Class Methods --//
+
+    void PlayerStrategy::issueOrder(Player* p, ostringstream& output, bool surpressOutput, Deck* gameDeck, Player* neutralPlayer) {
+
+        if(p == nullptr || p -> getPlayerOrders() == nullptr) { return; }
+
+        deployReinforcements(p, output, surpressOutput);
+        issueCardOrders(p, output, surpressOutput, gameDeck);
+        issueAttackOrders(p, output, surpressOutput, neutralPlayer);
+        issueDefendOrders(p, output, surpressOutput);
+
+    }
+
+    // ================= DefaultPlayerStrategy ================= //
+
+    PlayerStrategy* DefaultPlayerStrategy::clone() const { return new DefaultPlayerStrategy(*this); }
+
+    string DefaultPlayerStrategy::getStrategyName() const { return "default"; }
+
+    void DefaultPlayerStrategy::deployReinforcements(Player* p, ostringstream& output, bool surpressOutput) {
+
+        p -> deployReinforcements(output, surpressOutput);
+
+    }
+
+    void DefaultPlayerStrategy::issueCardOrders(Player* p, ostringstream& output, bool surpressOutput, Deck* gameDeck) {
+
+        p -> issueCardOrders(output, surpressOutput, gameDeck);
+
+    }
+
+    void DefaultPlayerStrategy::issueAttackOrders(Player* p, ostringstream& output, bool surpressOutput, Player* neutralPlayer) {
+
+        p -> issueAttackOrders(output, surpressOutput, neutralPlayer);
+
+    }
+
+    void DefaultPlayerStrategy::issueDefendOrders(Player* p, ostringstream& output, bool surpressOutput) {
+
+        p -> issueDefendOrders(output, surpressOutput);
+
+    }
+
+    // ================= AggressivePlayerStrategy ================= //
+
+    PlayerStrategy* AggressivePlayerStrategy::clone() const { return new AggressivePlayerStrategy(*this); }
+
+    string AggressivePlayerStrategy::getStrategyName() const { return "aggressive"; }
+
+    void AggressivePlayerStrategy::deployReinforcements(Player* p, ostringstream& output, bool surpressOutput) {
+
+        int pool = p -> getReinforcementPool();
+        if(pool <= 0) { return; }
+
+        //Frontlines come sorted weakest first, so the strongest one is at the back
+        vector<Territory*> frontlines = p -> getTerritoriesAdjacentToEnemy();
+
+        if(frontlines.empty() || frontlines.back() == nullptr) {
+
+            output << "[IssueOrder] " << p -> getPlayerName()
+                << " has no frontline territories; skipping deployment of " << pool << " armies.\n";
+
+            p -> setReinforcementPool(0);
+            return;
+
+        }
+
+        addDeploy(p, frontlines.back(), pool, output, surpressOutput);
+        p -> setReinforcementPool(0);
+
+    }
+
+    void AggressivePlayerStrategy::issueCardOrders(Player* p, ostringstream& output, bool surpressOutput, Deck* gameDeck) {
+
+        playPreferredCard(p, { CARD_ORDER_BOMB, CARD_ORDER_AIRLIFT }, output, surpressOutput, gameDeck);
+
+    }
+
+    void AggressivePlayerStrategy::issueAttackOrders(Player* p, ostringstream& output, bool surpressOutput, Player* neutralPlayer) {
+
+        (void) neutralPlayer; //Neutral territories are fair game
+
+        TerritoryTable attackTable = p -> toAttack();
+
+        for(Territory* source : p -> getTerritoriesAdjacentToEnemy()) {
+
+            if(source == nullptr || source -> getNumArmies() <= 1) { continue; } //Cannot move last defender
+            if(source -> getIndex() < 0 || source -> getIndex() >= (int) attackTable.size()) { continue; }
+
+            Territory* target = attackTable[source -> getIndex()];
+            if(target == nullptr || target -> getOwner() == p || isTrucePartner(p, target -> getOwner())) { continue; }
+
+            addAdvance(p, source, target, source -> getNumArmies() - 1, output, surpressOutput);
+
+        }
+
+    }
+
+    void AggressivePlayerStrategy::issueDefendOrders(Player* p, ostringstream& output, bool surpressOutput) {
+
+        p -> issueDefendOrders(output, surpressOutput); //Already funnels every interior army to the border
+
+    }
+
+    // ================= DefensivePlayerStrategy ================= //
+
+    PlayerStrategy* DefensivePlayerStrategy::clone() const { return new DefensivePlayerStrategy(*this); }
+
+    string DefensivePlayerStrategy::getStrategyName() const { return "defensive"; }
+
+    void DefensivePlayerStrategy::deployReinforcements(Player* p, ostringstream& output, bool surpressOutput) {
+
+        int pool = p -> getReinforcementPool();
+        if(pool <= 0) { return; }
+
+        vector<Territory*> frontlines = p -> getTerritoriesAdjacentToEnemy(); //Weakest first
+
+        if(frontlines.empty()) {
+
+            output << "[IssueOrder] " << p -> getPlayerName()
+                << " has no frontline territories; skipping deployment of " << pool << " armies.\n";
+
+            p -> setReinforcementPool(0);
+            return;
+
+        }
+
+        //Even split, the remainder goes to the weakest frontlines
+        int share = pool / static_cast<int>(frontlines.size());
+        int remainder = pool % static_cast<int>(frontlines.size());
+
+        for(size_t i = 0; i < frontlines.size(); i++) {
+
+            int armies = share + (static_cast<int>(i) < remainder ? 1 : 0);
+            if(armies <= 0 || frontlines[i] == nullptr) { continue; }
+
+            addDeploy(p, frontlines[i], armies, output, surpressOutput);
+
+        }
+
+        p -> setReinforcementPool(0);
+
+    }
+
+    void DefensivePlayerStrategy::issueCardOrders(Player* p, ostringstream& output, bool surpressOutput, Deck* gameDeck) {
+
+        playPreferredCard(p, { CARD_ORDER_NEGOTIATE, CARD_ORDER_AIRLIFT }, output, surpressOutput, gameDeck);
+
+    }
+
+    void DefensivePlayerStrategy::issueAttackOrders(Player* p, ostringstream& output, bool surpressOutput, Player* neutralPlayer) {
+
+        (void) neutralPlayer;
+
+        if(!surpressOutput) { output << "[IssueOrder] " << p -> getPlayerName() << " holds its lines and does not attack.\n"; }
+
+    }
+
+    void DefensivePlayerStrategy::issueDefendOrders(Player* p, ostringstream& output, bool surpressOutput) {
+
+        p -> issueDefendOrders(output, surpressOutput);
+
+    }
+
+    // ================= BenevolentPlayerStrategy ================= //
+
+    PlayerStrategy* BenevolentPlayerStrategy::clone() const { return new BenevolentPlayerStrategy(*this); }
+
+    string BenevolentPlayerStrategy::getStrategyName() const { return "benevolent"; }
+
+    void BenevolentPlayerStrategy::deployReinforcements(Player* p, ostringstream& output, bool surpressOutput) {
+
+        int pool = p -> getReinforcementPool();
+        if(pool <= 0) { return; }
+
+        vector<Territory*> owned = p -> getOwnedTerritories().getTerritories();
+        owned.erase(remove(owned.begin(), owned.end(), nullptr), owned.end());
+
+        if(owned.empty()) {
+
+            p -> setReinforcementPool(0);
+            return;
+
+        }
+
+        stable_sort(owned.begin(), owned.end(), Territory::territoryNumArmiesCompareAscend);
+
+        //Spread evenly across the weakest half of the empire
+        size_t targets = max<size_t>(1, owned.size() / 2);
+        targets = min(targets, static_cast<size_t>(pool));
+
+        int share = pool / static_cast<int>(targets);
+        int remainder = pool % static_cast<int>(targets);
+
+        for(size_t i = 0; i < targets; i++) {
+
+            int armies = share + (static_cast<int>(i) < remainder ? 1 : 0);
+            if(armies > 0) { addDeploy(p, owned[i], armies, output, surpressOutput); }
+
+        }
+
+        p -> setReinforcementPool(0);
+
+    }
+
+    void BenevolentPlayerStrategy::issueCardOrders(Player* p, ostringstream& output, bool surpressOutput, Deck* gameDeck) {
+
+        playPreferredCard(p, { CARD_ORDER_NEGOTIATE, CARD_ORDER_AIRLIFT }, output, surpressOutput, gameDeck);
+
+    }
+
+    void BenevolentPlayerStrategy::issueAttackOrders(Player* p, ostringstream& output, bool surpressOutput, Player* neutralPlayer) {
+
+        (void) neutralPlayer;
+
+        if(!surpressOutput) { output << "[IssueOrder] " << p -> getPlayerName() << " never attacks.\n"; }
+
+    }
+
+    void BenevolentPlayerStrategy::issueDefendOrders(Player* p, ostringstream& output, bool surpressOutput) {
+
+        //Each territory shares half the difference with its weakest owned neighbour
+        for(Territory* source : p -> getOwnedTerritories().getTerritories()) {
+
+            if(source == nullptr || source -> getNumArmies() <= 1) { continue; }
+
+            Territory* weakest = nullptr;
+
+            for(Territory* neighbor : source -> getNeighbors()) {
+
+                if(neighbor == nullptr || neighbor -> getOwner() != p) { continue; }
+                if(weakest == nullptr || neighbor -> getNumArmies() < weakest -> getNumArmies()) { weakest = neighbor; }
+
+            }
+
+            if(weakest == nullptr) { continue; }
+
+            int armies = (source -> getNumArmies() - weakest -> getNumArmies()) / 2;
+            armies = min(armies, source -> getNumArmies() - 1);
+
+            if(armies > 0) { addAdvance(p, source, weakest, armies, output, surpressOutput); }
+
+        }
+
+    }
+
+    // ================= RandomPlayerStrategy ================= //
+
+    PlayerStrategy* RandomPlayerStrategy::clone() const { return new RandomPlayerStrategy(*this); }
+
+    string RandomPlayerStrategy::getStrategyName() const { return "random"; }
+
+    void RandomPlayerStrategy::deployReinforcements(Player* p, ostringstream& output, bool surpressOutput) {
+
+        int pool = p -> getReinforcementPool();
+        const vector<Territory*>& owned = p -> getOwnedTerritories().getTerritories();
+
+        if(pool <= 0 || owned.empty()) {
+
+            p -> setReinforcementPool(0);
+            return;
+
+        }
+
+        mt19937& rng = p -> getDecisionRng();
+
+        while(pool > 0) {
+
+            Territory* target = owned[rng() % owned.size()];
+            int armies = static_cast<int>(rng() % pool) + 1;
+
+            if(target != nullptr) { addDeploy(p, target, armies, output, surpressOutput); }
+            pool -= armies;
+
+        }
+
+        p -> setReinforcementPool(0);
+
+    }
+
+    void RandomPlayerStrategy::issueCardOrders(Player* p, ostringstream& output, bool surpressOutput, Deck* gameDeck) {
+
+        p -> issueCardOrders(output, surpressOutput, gameDeck); //Already a uniform pick over playable cards
+
+    }
+
+    void RandomPlayerStrategy::issueAttackOrders(Player* p, ostringstream& output, bool surpressOutput, Player* neutralPlayer) {
+
+        (void) neutralPlayer;
+
+        mt19937& rng = p -> getDecisionRng();
+
+        for(Territory* source : p -> getTerritoriesAdjacentToEnemy()) {
+
+            if(source == nullptr || source -> getNumArmies() <= 1 || rng() % 2 == 0) { continue; } //Coin flip per frontline
+
+            vector<Territory*> enemies;
+            for(Territory* neighbor : source -> getNeighbors()) {
+
+                if(neighbor != nullptr && neighbor -> getOwner() != nullptr && neighbor -> getOwner() != p) { enemies.push_back(neighbor); }
+
+            }
+
+            if(enemies.empty()) { continue; }
+
+            Territory* target = enemies[rng() % enemies.size()];
+            int armies = static_cast<int>(rng() % (source -> getNumArmies() - 1)) + 1;
+
+            addAdvance(p, source, target, armies, output, surpressOutput);
+
+        }
+
+    }
+
+    void RandomPlayerStrategy::issueDefendOrders(Player* p, ostringstream& output, bool surpressOutput) {
+
+        mt19937& rng = p -> getDecisionRng();
+
+        for(Territory* source : p -> getOwnedTerritories().getTerritories()) {
+
+            if(source == nullptr || source -> getNumArmies() <= 1 || rng() % 2 == 0) { continue; }
+
+            vector<Territory*> friendly;
+            for(Territory* neighbor : source -> getNeighbors()) {
+
+                if(neighbor != nullptr && neighbor -> getOwner() == p) { friendly.push_back(neighbor); }
+
+            }
+
+            if(friendly.empty()) { continue; }
+
+            Territory* target = friendly[rng() % friendly.size()];
+            int armies = static_cast<int>(rng() % (source -> getNumArmies() - 1)) + 1;
+
+            addAdvance(p, source, target, armies, output, surpressOutput);
+
+        }
+
+    }
+
+    // ================= CheaterPlayerStrategy ================= //
+
+    PlayerStrategy* CheaterPlayerStrategy::clone() const { return new CheaterPlayerStrategy(*this); }
+
+    string CheaterPlayerStrategy::getStrategyName() const { return "cheater"; }
+
+    bool CheaterPlayerStrategy::canIssueConcurrently() const { return false; }
+
+    void CheaterPlayerStrategy::deployReinforcements(Player* p, ostringstream& output, bool surpressOutput) {
+
+        p -> deployReinforcements(output, surpressOutput);
+
+    }
+
+    void CheaterPlayerStrategy::issueCardOrders(Player* p, ostringstream& output, bool surpressOutput, Deck* gameDeck) {
+
+        (void) p;
+        (void) output;
+        (void) surpressOutput;
+        (void) gameDeck; //Does not need cards
+
+    }
+
+    void CheaterPlayerStrategy::issueAttackOrders(Player* p, ostringstream& output, bool surpressOutput, Player* neutralPlayer) {
+
+        (void) neutralPlayer;
+
+        //Collect first, conquering while iterating would grow the owned list under us
+        vector<Territory*> conquered;
+
+        for(Territory* owned : p -> getOwnedTerritories().getTerritories()) {
+
+            if(owned == nullptr) { continue; }
+
+            for(Territory* neighbor : owned -> getNeighbors()) {
+
+                if(neighbor == nullptr || neighbor -> getOwner() == nullptr || neighbor -> getOwner() == p) { continue; }
+                if(isTrucePartner(p, neighbor -> getOwner())) { continue; }
+                if(find(conquered.begin(), conquered.end(), neighbor) != conquered.end()) { continue; }
+
+                conquered.push_back(neighbor);
+
+            }
+
+        }
+
+        for(Territory* t : conquered) {
+
+            if(!surpressOutput) {
+
+                output << "[IssueOrder] " << p -> getPlayerName() << " takes over " << t -> getID()
+                    << " from " << t -> getOwner() -> getPlayerName() << ".\n";
+
+            }
+
+            p -> addOwnedTerritories(t);
+
+        }
+
+    }
+
+    void CheaterPlayerStrategy::issueDefendOrders(Player* p, ostringstream& output, bool surpressOutput) {
+
+        p -> issueDefendOrders(output, surpressOutput);
+
+    }
+
+    // ================= HumanPlayerStrategy ================= //
+
+    PlayerStrategy* HumanPlayerStrategy::clone() const { return new HumanPlayerStrategy(*this); }
+
+    string HumanPlayerStrategy::getStrategyName() const { return "human"; }
+
+    bool HumanPlayerStrategy::canIssueConcurrently() const { return false; }
+
+    bool HumanPlayerStrategy::readsConsole() const { return true; }
+
+    void HumanPlayerStrategy::deployReinforcements(Player* p, ostringstream& output, bool surpressOutput) {
+
+        int pool = p -> getReinforcementPool();
+
+        while(pool > 0) {
+
+            string line = readConsoleLine(p -> getPlayerName() + ", deploy armies (" + to_string(pool) + " left) as \"<territoryID> <amount>\": ");
+            if(line.empty() && !cin) { break; } //Console closed
+
+            istringstream in(line);
+            string id;
+            int armies = 0;
+
+            if(!(in >> id >> armies) || armies <= 0 || armies > pool) {
+
+                cerr << "Invalid deployment, expected an owned territory and an amount between 1 and " << pool << "." << endl;
+                continue;
+
+            }
+
+            Territory* target = findTerritoryByID(p -> getOwnedTerritories().getTerritories(), id);
+
+            if(target == nullptr) {
+
+                cerr << "You do not own territory " << id << "." << endl;
+                continue;
+
+            }
+
+            addDeploy(p, target, armies, output, surpressOutput);
+            pool -= armies;
+
+        }
+
+        p -> setReinforcementPool(0);
+
+    }
+
+    void HumanPlayerStrategy::issueCardOrders(Player* p, ostringstream& output, bool surpressOutput, Deck* gameDeck) {
+
+        if(p -> getHand() == nullptr) { return; }
+
+        string line = readConsoleLine(p -> getPlayerName() + ", play a card (bomb, blockade, airlift, negotiate, or none): ");
+        transform(line.begin(), line.end(), line.begin(), ::tolower);
+
+        int orderType = -1;
+        if(line == "bomb") { orderType = CARD_ORDER_BOMB; }
+        else if(line == "blockade") { orderType = CARD_ORDER_BLOCKADE; }
+        else if(line == "airlift") { orderType = CARD_ORDER_AIRLIFT; }
+        else if(line == "negotiate") { orderType = CARD_ORDER_NEGOTIATE; }
+
+        if(orderType == -1) { return; }
+
+        if(!p -> canIssueCardOrder(orderType) || !p -> playCardOrder(orderType, output, surpressOutput, gameDeck)) {
+
+            cerr << "Cannot play a " << line << " card right now." << endl;
+
+        }
+
+    }
+
+    void HumanPlayerStrategy::issueAttackOrders(Player* p, ostringstream& output, bool surpressOutput, Player* neutralPlayer) {
+
+        (void) neutralPlayer;
+
+        //Attacks and moves share the same prompt, an Advance is an attack when the target is not owned
+        while(true) {
+
+            string line = readConsoleLine(p -> getPlayerName() + ", advance as \"<sourceID> <targetID> <armies>\" (or done): ");
+            if(line.empty() || line == "done") { break; }
+
+            istringstream in(line);
+            string sourceID, targetID;
+            int armies = 0;
+
+            if(!(in >> sourceID >> targetID >> armies) || armies <= 0) {
+
+                cerr << "Invalid advance, expected a source, an adjacent target and a positive amount." << endl;
+                continue;
+
+            }
+
+            Territory* source = findTerritoryByID(p -> getOwnedTerritories().getTerritories(), sourceID);
+            Territory* target = source == nullptr ? nullptr : findTerritoryByID(source -> getNeighbors(), targetID);
+
+            if(source == nullptr || target == nullptr) {
+
+                cerr << "Source must be owned, and the target adjacent to it." << endl;
+                continue;
+
+            }
+
+            addAdvance(p, source, target, armies, output, surpressOutput);
+
+        }
+
+    }
+
+    void HumanPlayerStrategy::issueDefendOrders(Player* p, ostringstream& output, bool surpressOutput) {
+
+        (void) p;
+        (void) output;
+        (void) surpressOutput; //Handled by the advance prompt in issueAttackOrders()
+
+    }
+
+    //-- Free Functions --//
+
+    PlayerStrategy* createStrategy(const string& name) {
+
+        string lowered = name;
+        transform(lowered.begin(), lowered.end(), lowered.begin(), ::tolower);
+
+        if(lowered == "default") { return new DefaultPlayerStrategy(); }
+        if(lowered == "aggressive") { return new AggressivePlayerStrategy(); }
+        if(lowered == "defensive") { return new DefensivePlayerStrategy(); }
+        if(lowered == "benevolent") { return new BenevolentPlayerStrategy(); }
+        if(lowered == "random") { return new RandomPlayerStrategy(); }
+        if(lowered == "cheater") { return new CheaterPlayerStrategy(); }
+        if(lowered == "human") { return new HumanPlayerStrategy(); }
+
+        return nullptr;
+
+    }
+
+}
@@ -0,0 +1,275 @@
+#pragma once
+
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "Player.h"
+
+using namespace std;
+
+namespace WarzonePlayer {
+
+    // ================= PlayerStrategy ================= //
+    /**
+     * @class PlayerStrategy
+     * @brief Decides which orders a Player issues every turn.
+     *
+     * A strategy is attached per player with Player::setStrategy() and splits a turn into the same four
+     * steps the built-in AI uses: deploy, card, attack and defend. Strategies hold no per-player state,
+     * so one instance can also drive several players through issueOrderWith().
+     *
+     * Placeholder card orders (no targets) are finalized by GameEngine::handle*Order, exactly as for the default AI.
+     */
+    class PlayerStrategy {
+
+        public:
+
+            //-- Constructors, Destructor --//
+
+            /**
+             * @brief Virtual destructor
+             */
+            virtual ~PlayerStrategy() = default;
+
+            /**
+             * @brief Polymorphic copy, used when a Player is copied
+             * @return Heap-allocated copy of this strategy
+             */
+            virtual PlayerStrategy* clone() const = 0;
+
+            //-- Accessors --//
+
+            /**
+             * @brief Name of the strategy, as accepted by createStrategy()
+             * @return Lowercase strategy name
+             */
+            virtual string getStrategyName() const = 0;
+
+            /**
+             * @brief Whether this strategy may run concurrently with other players during the issue orders phase.
+             * Strategies that change the board or read the console while issuing must return false.
+             * @return true if issuing only reads the board and writes to the player's own orders/hand
+             */
+            virtual bool canIssueConcurrently() const { return true; }
+
+            /**
+             * @brief Whether issuing orders waits for console input, so a scheduler must not run it on a worker thread
+             * @return true if issueOrder() reads from cin
+             */
+            virtual bool readsConsole() const { return false; }
+
+            //-- Class Methods --//
+
+            /**
+             * @brief Creates Deploy orders for the player's reinforcement pool, and empties the pool.
+             * @param p Player issuing orders
+             * @param output Shared log stream to record order actions.
+             * @param surpressOutput If true, suppresses console/log output.
+             */
+            virtual void deployReinforcements(Player* p, ostringstream& output, bool surpressOutput) = 0;
+
+            /**
+             * @brief Plays at most one card from the player's hand.
+             * @param p Player issuing orders
+             * @param output Shared log stream to record order actions.
+             * @param surpressOutput If true, suppresses console/log output.
+             * @param gameDeck Deck the card is returned to (nullptr to defer, see Player::returnPendingCards())
+             */
+            virtual void issueCardOrders(Player* p, ostringstream& output, bool surpressOutput, Deck* gameDeck) = 0;
+
+            /**
+             * @brief Creates offensive Advance orders.
+             * @param p Player issuing orders
+             * @param output Shared log stream to record order actions.
+             * @param surpressOutput If true, suppresses console/log output.
+             * @param neutralPlayer Pointer to the set neutral player
+             */
+            virtual void issueAttackOrders(Player* p, ostringstream& output, bool surpressOutput, Player* neutralPlayer) = 0;
+
+            /**
+             * @brief Creates Advance orders moving armies between the player's own territories.
+             * @param p Player issuing orders
+             * @param output Shared log stream to record order actions.
+             * @param surpressOutput If true, suppresses console/log output.
+             */
+            virtual void issueDefendOrders(Player* p, ostringstream& output, bool surpressOutput) = 0;
+
+            /**
+             * @brief Runs all four steps in order (deploy, card, attack, defend) through virtual dispatch.
+             * @param p Player issuing orders
+             * @param output Shared log stream to record order actions.
+             * @param surpressOutput If true, suppresses console/log output.
+             * @param gameDeck Deck used cards are returned to (nullptr to defer)
+             * @param neutralPlayer Pointer to the set neutral player
+             */
+            void issueOrder(Player* p, ostringstream& output, bool surpressOutput, Deck* gameDeck, Player* neutralPlayer);
+
+    };
+
+    // ================= DefaultPlayerStrategy ================= //
+    /**
+     * @brief The original AI: weakest-frontline deployment, random card, 6/7 strength attacks, inward-to-border reinforcement.
+     * Equivalent to a Player without any strategy attached.
+     */
+    class DefaultPlayerStrategy final : public PlayerStrategy {
+
+        public:
+
+            PlayerStrategy* clone() const override;
+            string getStrategyName() const override;
+            void deployReinforcements(Player* p, ostringstream& output, bool surpressOutput) override;
+            void issueCardOrders(Player* p, ostringstream& output, bool surpressOutput, Deck* gameDeck) override;
+            void issueAttackOrders(Player* p, ostringstream& output, bool surpressOutput, Player* neutralPlayer) override;
+            void issueDefendOrders(Player* p, ostringstream& output, bool surpressOutput) override;
+
+    };
+
+    // ================= AggressivePlayerStrategy ================= //
+    /**
+     * @brief Stacks all reinforcements on its strongest frontline, attacks from every frontline with all but one army,
+     * prefers Bomb/Airlift cards, and funnels interior armies to the border.
+     */
+    class AggressivePlayerStrategy final : public PlayerStrategy {
+
+        public:
+
+            PlayerStrategy* clone() const override;
+            string getStrategyName() const override;
+            void deployReinforcements(Player* p, ostringstream& output, bool surpressOutput) override;
+            void issueCardOrders(Player* p, ostringstream& output, bool surpressOutput, Deck* gameDeck) override;
+            void issueAttackOrders(Player* p, ostringstream& output, bool surpressOutput, Player* neutralPlayer) override;
+            void issueDefendOrders(Player* p, ostringstream& output, bool surpressOutput) override;
+
+    };
+
+    // ================= DefensivePlayerStrategy ================= //
+    /**
+     * @brief Spreads reinforcements over its frontlines (weakest first), never attacks, prefers Negotiate/Airlift cards,
+     * and funnels interior armies to the border.
+     */
+    class DefensivePlayerStrategy final : public PlayerStrategy {
+
+        public:
+
+            PlayerStrategy* clone() const override;
+            string getStrategyName() const override;
+            void deployReinforcements(Player* p, ostringstream& output, bool surpressOutput) override;
+            void issueCardOrders(Player* p, ostringstream& output, bool surpressOutput, Deck* gameDeck) override;
+            void issueAttackOrders(Player* p, ostringstream& output, bool surpressOutput, Player* neutralPlayer) override;
+            void issueDefendOrders(Player* p, ostringstream& output, bool surpressOutput) override;
+
+    };
+
+    // ================= BenevolentPlayerStrategy ================= //
+    /**
+     * @brief Reinforces its weakest territories, never attacks or plays harmful cards,
+     * and evens out armies between neighbouring owned territories.
+     */
+    class BenevolentPlayerStrategy final : public PlayerStrategy {
+
+        public:
+
+            PlayerStrategy* clone() const override;
+            string getStrategyName() const override;
+            void deployReinforcements(Player* p, ostringstream& output, bool surpressOutput) override;
+            void issueCardOrders(Player* p, ostringstream& output, bool surpressOutput, Deck* gameDeck) override;
+            void issueAttackOrders(Player* p, ostringstream& output, bool surpressOutput, Player* neutralPlayer) override;
+            void issueDefendOrders(Player* p, ostringstream& output, bool surpressOutput) override;
+
+    };
+
+    // ================= RandomPlayerStrategy ================= //
+    /**
+     * @brief Deploys to random territories, plays a random card, and advances random amounts to random neighbours.
+     * All randomness comes from the player's seeded decision RNG, so games stay reproducible.
+     */
+    class RandomPlayerStrategy final : public PlayerStrategy {
+
+        public:
+
+            PlayerStrategy* clone() const override;
+            string getStrategyName() const override;
+            void deployReinforcements(Player* p, ostringstream& output, bool surpressOutput) override;
+            void issueCardOrders(Player* p, ostringstream& output, bool surpressOutput, Deck* gameDeck) override;
+            void issueAttackOrders(Player* p, ostringstream& output, bool surpressOutput, Player* neutralPlayer) override;
+            void issueDefendOrders(Player* p, ostringstream& output, bool surpressOutput) override;
+
+    };
+
+    // ================= CheaterPlayerStrategy ================= //
+    /**
+     * @brief Once per turn, takes over every adjacent enemy territory (except truce partners) directly while issuing orders.
+     * Changes the board during the issue phase, so it can never run concurrently.
+     */
+    class CheaterPlayerStrategy final : public PlayerStrategy {
+
+        public:
+
+            PlayerStrategy* clone() const override;
+            string getStrategyName() const override;
+            bool canIssueConcurrently() const override;
+            void deployReinforcements(Player* p, ostringstream& output, bool surpressOutput) override;
+            void issueCardOrders(Player* p, ostringstream& output, bool surpressOutput, Deck* gameDeck) override;
+            void issueAttackOrders(Player* p, ostringstream& output, bool surpressOutput, Player* neutralPlayer) override;
+            void issueDefendOrders(Player* p, ostringstream& output, bool surpressOutput) override;
+
+    };
+
+    // ================= HumanPlayerStrategy ================= //
+    /**
+     * @brief Reads every decision from the console (deploys, card, advances).
+     * Prompts are always printed, even when output is suppressed.
+     */
+    class HumanPlayerStrategy final : public PlayerStrategy {
+
+        public:
+
+            PlayerStrategy* clone() const override;
+            string getStrategyName() const override;
+            bool canIssueConcurrently() const override;
+            bool readsConsole() const override;
+            void deployReinforcements(Player* p, ostringstream& output, bool surpressOutput) override;
+            void issueCardOrders(Player* p, ostringstream& output, bool surpressOutput, Deck* gameDeck) override;
+            void issueAttackOrders(Player* p, ostringstream& output, bool surpressOutput, Player* neutralPlayer) override;
+            void issueDefendOrders(Player* p, ostringstream& output, bool surpressOutput) override;
+
+    };
+
+    //-- Free Functions --//
+
+    /**
+     * @brief Builds a strategy from its name.
+     * @param name One of: default, aggressive, defensive, benevolent, random, cheater, human (case insensitive)
+     * @return Heap-allocated strategy, or nullptr if the name is unknown
+     */
+    PlayerStrategy* createStrategy(const string& name);
+
+    /**
+     * @brief Statically dispatched equivalent of PlayerStrategy::issueOrder().
+     *
+     * Strategy is a concrete (final) strategy type, so every step call binds at compile time and can be inlined.
+     * Meant for batch simulations where every player uses the same strategy (see GameEngine::issueOrdersPhaseWith).
+     *
+     * @param strategy Strategy instance (shared between players, strategies are stateless)
+     * @param p Player issuing orders
+     * @param output Shared log stream to record order actions.
+     * @param surpressOutput If true, suppresses console/log output.
+     * @param gameDeck Deck used cards are returned to (nullptr to defer)
+     * @param neutralPlayer Pointer to the set neutral player
+     */
+    template<typename Strategy>
+    void issueOrderWith(Strategy& strategy, Player* p, ostringstream& output, bool surpressOutput, Deck* gameDeck, Player* neutralPlayer) {
+
+        static_assert(is_base_of<PlayerStrategy, Strategy>::value, "Strategy must derive from PlayerStrategy");
+
+        strategy.deployReinforcements(p, output, surpressOutput);
+        strategy.issueCardOrders(p, output, surpressOutput, gameDeck);
+        strategy.issueAttackOrders(p, output, surpressOutput, neutralPlayer);
+        strategy.issueDefendOrders(p, output, surpressOutput);
+
+    }
+
+}